@@ -46,15 +46,49 @@ ASTNode *ast_create_chr_lit(char val, int line) {
     return node;
 }
 
-ASTNode *ast_create_str_lit(const char *val, int line) {
+/* The one copy of a token's text, with escapes processed when present */
+static char *slice_copy(TokenSlice s) {
+    char *out = malloc((size_t)s.len + 1);
+    if (!out) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    if (!s.escaped) {
+        memcpy(out, s.text, (size_t)s.len);
+        out[s.len] = '\0';
+        return out;
+    }
+
+    int oi = 0;
+    for (int i = 0; i < s.len; ++i) {
+        if (s.text[i] == '\\' && i + 1 < s.len) {
+            ++i;
+            switch (s.text[i]) {
+                case 'n':  out[oi++] = '\n'; break;
+                case 't':  out[oi++] = '\t'; break;
+                case '\\': out[oi++] = '\\'; break;
+                case '\'': out[oi++] = '\''; break;
+                case '\"': out[oi++] = '\"'; break;
+                case '0':  out[oi++] = '\0'; break;
+                default:   out[oi++] = s.text[i]; break;
+            }
+        } else {
+            out[oi++] = s.text[i];
+        }
+    }
+    out[oi] = '\0';
+    return out;
+}
+
+ASTNode *ast_create_str_lit(TokenSlice val, int line) {
     ASTNode *node = ast_alloc(NODE_STR_LIT, line);
-    node->data.strVal = strdup(val);
+    node->data.strVal = slice_copy(val);
     return node;
 }
 
-ASTNode *ast_create_ident(const char *name, int line) {
+ASTNode *ast_create_ident(Atom name, int line) {
     ASTNode *node = ast_alloc(NODE_IDENT, line);
-    node->data.strVal = strdup(name);
+    node->data.ident = name;
     return node;
 }
 
@@ -76,27 +110,27 @@ ASTNode *ast_create_decl_list(ASTNode *left, ASTNode *right, int line) {
     return node;
 }
 
-ASTNode *ast_create_decl(VarType type, const char *name, ASTNode *init, int line) {
+ASTNode *ast_create_decl(VarType type, Atom name, ASTNode *init, int line) {
     ASTNode *node = ast_alloc(NODE_DECL, line);
     node->data.decl.varType = type;
-    node->data.decl.varName = strdup(name);
+    node->data.decl.varName = name;
     node->data.decl.initExpr = init;
     return node;
 }
 
 
 
-ASTNode *ast_create_assign(const char *name, ASTNode *expr, int line) {
+ASTNode *ast_create_assign(Atom name, ASTNode *expr, int line) {
     ASTNode *node = ast_alloc(NODE_ASSIGN, line);
-    node->data.assign.varName = strdup(name);
+    node->data.assign.varName = name;
     node->data.assign.op = OP_ASSIGN;
     node->data.assign.expr = expr;
     return node;
 }
 
-ASTNode *ast_create_compound_assign(const char *name, OpType op, ASTNode *expr, int line) {
+ASTNode *ast_create_compound_assign(Atom name, OpType op, ASTNode *expr, int line) {
     ASTNode *node = ast_alloc(NODE_COMPOUND_ASSIGN, line);
-    node->data.assign.varName = strdup(name);
+    node->data.assign.varName = name;
     node->data.assign.op = op;
     node->data.assign.expr = expr;
     return node;
@@ -130,15 +164,15 @@ ASTNode *ast_create_name_list(ASTNode *left, ASTNode *right, int line) {
     return node;
 }
 
-ASTNode *ast_create_name_item_typed(const char *name, ASTNode *init, VarType type, int line) {
+ASTNode *ast_create_name_item_typed(Atom name, ASTNode *init, VarType type, int line) {
     ASTNode *node = ast_alloc(NODE_NAME_ITEM, line);
-    node->data.nameItem.name = strdup(name);
+    node->data.nameItem.name = name;
     node->data.nameItem.initExpr = init;
     node->data.nameItem.varType = type;
     return node;
 }
 
-ASTNode *ast_create_name_item(const char *name, ASTNode *init, int line) {
+ASTNode *ast_create_name_item(Atom name, ASTNode *init, int line) {
     return ast_create_name_item_typed(name, init, TYPE_NMBR, line);
 }
 
@@ -161,33 +195,33 @@ static void print_indent(int indent) {
     for (int i = 0; i < indent; i++) printf("  ");
 }
 
-void ast_build_symbol_table(ASTNode *node, int *error_count) {
+void ast_build_symbol_table(SymbolTable *st, ASTNode *node, int *error_count) {
     if (!node) return;
     
     switch (node->type) {
         case NODE_PROGRAM:
             for (int i = 0; i < node->data.stmtList.count; i++) {
-                ast_build_symbol_table(node->data.stmtList.stmts[i], error_count);
+                ast_build_symbol_table(st, node->data.stmtList.stmts[i], error_count);
             }
             break;
             
         case NODE_DECL: {
-            Symbol *s = insert(node->data.decl.varName, node->data.decl.varType, node->line, error_count);
+            Symbol *s = insert(st, node->data.decl.varName, node->data.decl.varType, node->line, error_count);
             break;
         }
         
         case NODE_DECL_LIST:
-            ast_build_symbol_table(node->data.declList.left, error_count);
-            ast_build_symbol_table(node->data.declList.right, error_count);
+            ast_build_symbol_table(st, node->data.declList.left, error_count);
+            ast_build_symbol_table(st, node->data.declList.right, error_count);
             break;
             
         case NODE_NAME_LIST:
-            ast_build_symbol_table(node->data.nameList.left, error_count);
-            ast_build_symbol_table(node->data.nameList.right, error_count);
+            ast_build_symbol_table(st, node->data.nameList.left, error_count);
+            ast_build_symbol_table(st, node->data.nameList.right, error_count);
             break;
             
         case NODE_NAME_ITEM: {
-            Symbol *s = insert(node->data.nameItem.name, node->data.nameItem.varType, node->line, error_count);
+            Symbol *s = insert(st, node->data.nameItem.name, node->data.nameItem.varType, node->line, error_count);
             break;
         }
             
@@ -221,7 +255,7 @@ void ast_print(ASTNode *node, int indent) {
             printf("StrLit(\"%s\")\n", node->data.strVal);
             break;
         case NODE_IDENT:
-            printf("Ident(%s)\n", node->data.strVal);
+            printf("Ident(%s)\n", node->data.ident);
             break;
         case NODE_BINOP:
             printf("BinOp(%s)\n", op_to_string(node->data.binop.op));
@@ -296,7 +330,7 @@ static int is_constant_zero(ASTNode *node) {
 }
 
 /* Recursively check semantics of expressions */
-static int check_expr_semantics(ASTNode *node, int *error_count) {
+static int check_expr_semantics(SymbolTable *st, ASTNode *node, int *error_count) {
     if (!node) return 1;
     
     switch (node->type) {
@@ -307,10 +341,10 @@ static int check_expr_semantics(ASTNode *node, int *error_count) {
             
         case NODE_IDENT: {
             /* Variable is already checked during parsing */
-            Symbol *s = lookup(node->data.strVal);
+            Symbol *s = lookup_atom(st, node->data.ident);
             if (!s) {
                 fprintf(stderr, "error at %d: Undefined variable '%s'\n", 
-                        node->line, node->data.strVal);
+                        node->line, node->data.ident);
                 (*error_count)++;
                 return 0;
             }
@@ -321,8 +355,8 @@ static int check_expr_semantics(ASTNode *node, int *error_count) {
             int valid = 1;
             
             /* Check left and right operands first */
-            valid &= check_expr_semantics(node->data.binop.left, error_count);
-            valid &= check_expr_semantics(node->data.binop.right, error_count);
+            valid &= check_expr_semantics(st, node->data.binop.left, error_count);
+            valid &= check_expr_semantics(st, node->data.binop.right, error_count);
             
             /* Check for division by zero */
             if (node->data.binop.op == OP_DIV) {
@@ -337,8 +371,8 @@ static int check_expr_semantics(ASTNode *node, int *error_count) {
         }
         
         case NODE_CONCAT:
-            check_expr_semantics(node->data.shw.left, error_count);
-            check_expr_semantics(node->data.shw.right, error_count);
+            check_expr_semantics(st, node->data.shw.left, error_count);
+            check_expr_semantics(st, node->data.shw.right, error_count);
             return 1;
             
         default:
@@ -347,37 +381,37 @@ static int check_expr_semantics(ASTNode *node, int *error_count) {
 }
 
 /*Main semantic checks*/
-int ast_check_semantics(ASTNode *node, int *error_count) {
+int ast_check_semantics(SymbolTable *st, ASTNode *node, int *error_count) {
     if (!node) return 1;
     
     switch (node->type) {
         case NODE_PROGRAM:
             for (int i = 0; i < node->data.stmtList.count; i++) {
-                ast_check_semantics(node->data.stmtList.stmts[i], error_count);
+                ast_check_semantics(st, node->data.stmtList.stmts[i], error_count);
             }
             break;
             
         case NODE_DECL:
             if (node->data.decl.initExpr) {
-                check_expr_semantics(node->data.decl.initExpr, error_count);
+                check_expr_semantics(st, node->data.decl.initExpr, error_count);
             }
             break;
             
         case NODE_DECL_LIST:
-            ast_check_semantics(node->data.declList.left, error_count);
-            ast_check_semantics(node->data.declList.right, error_count);
+            ast_check_semantics(st, node->data.declList.left, error_count);
+            ast_check_semantics(st, node->data.declList.right, error_count);
             break;
             
         case NODE_ASSIGN:
-            check_expr_semantics(node->data.assign.expr, error_count);
+            check_expr_semantics(st, node->data.assign.expr, error_count);
             break;
             
         case NODE_COMPOUND_ASSIGN:
-            check_expr_semantics(node->data.assign.expr, error_count);
+            check_expr_semantics(st, node->data.assign.expr, error_count);
             break;
             
         case NODE_SHW:
-            check_expr_semantics(node->data.shw.left, error_count);
+            check_expr_semantics(st, node->data.shw.left, error_count);
             break;
             
         default:
@@ -398,15 +432,15 @@ void ast_free(ASTNode *node) {
             free(node->data.stmtList.stmts);
             break;
         case NODE_STR_LIT:
-        case NODE_IDENT:
             free(node->data.strVal);
             break;
+        case NODE_IDENT:
+            break;
         case NODE_BINOP:
             ast_free(node->data.binop.left);
             ast_free(node->data.binop.right);
             break;
         case NODE_DECL:
-            free(node->data.decl.varName);
             ast_free(node->data.decl.initExpr);
             break;
         case NODE_DECL_LIST:
@@ -415,7 +449,6 @@ void ast_free(ASTNode *node) {
             break;
         case NODE_ASSIGN:
         case NODE_COMPOUND_ASSIGN:
-            free(node->data.assign.varName);
             ast_free(node->data.assign.expr);
             break;
         case NODE_SHW:
@@ -6,6 +6,15 @@
 
 typedef struct ASTNode ASTNode;
 
+/* Token text as a slice of the source buffer (not NUL-terminated). The
+   parser interns names and the AST copies string literals; escaped marks a
+   literal holding a backslash, the one case that needs escape processing. */
+typedef struct {
+    const char *text;
+    int len;
+    int escaped;
+} TokenSlice;
+
 typedef enum {
     NODE_PROGRAM,
     NODE_STMT_LIST,
@@ -45,6 +54,7 @@ struct ASTNode {
         int numVal;
         char chrVal;
         char *strVal;
+        Atom ident;
         
         struct {
             OpType op;
@@ -54,7 +64,7 @@ struct ASTNode {
         
         struct {
             VarType varType;
-            char *varName;
+            Atom varName;
             ASTNode *initExpr;
         } decl;
         
@@ -64,7 +74,7 @@ struct ASTNode {
         } declList;
         
         struct {
-            char *varName;
+            Atom varName;
             OpType op;
             ASTNode *expr;
         } assign;
@@ -91,7 +101,7 @@ struct ASTNode {
         } nameList;
         
         struct {
-            char *name;
+            Atom name;
             ASTNode *initExpr;
             VarType varType;  
         } nameItem;
@@ -104,14 +114,14 @@ ASTNode *ast_add_stmt(ASTNode *program, ASTNode *stmt);
 
 ASTNode *ast_create_num_lit(int val, int line);
 ASTNode *ast_create_chr_lit(char val, int line);
-ASTNode *ast_create_str_lit(const char *val, int line);
-ASTNode *ast_create_ident(const char *name, int line);
+ASTNode *ast_create_str_lit(TokenSlice val, int line);
+ASTNode *ast_create_ident(Atom name, int line);
 
 ASTNode *ast_create_binop(OpType op, ASTNode *left, ASTNode *right, int line);
-ASTNode *ast_create_decl(VarType type, const char *name, ASTNode *init, int line);
+ASTNode *ast_create_decl(VarType type, Atom name, ASTNode *init, int line);
 ASTNode *ast_create_decl_list(ASTNode *left, ASTNode *right, int line);
-ASTNode *ast_create_assign(const char *name, ASTNode *expr, int line);
-ASTNode *ast_create_compound_assign(const char *name, OpType op, ASTNode *expr, int line);
+ASTNode *ast_create_assign(Atom name, ASTNode *expr, int line);
+ASTNode *ast_create_compound_assign(Atom name, OpType op, ASTNode *expr, int line);
 ASTNode *ast_create_shw(ASTNode *expr, int line);
 ASTNode *ast_create_concat(ASTNode *left, ASTNode *right, int line);
 ASTNode *ast_create_stmt_list(ASTNode *left, ASTNode *right, int line);
@@ -119,13 +129,13 @@ ASTNode *ast_create_stmt_list(ASTNode *left, ASTNode *right, int line);
 /* New declaration functions */
 ASTNode *ast_create_type_decl_list(VarType type, ASTNode *nameList, int line);
 ASTNode *ast_create_name_list(ASTNode *left, ASTNode *right, int line);
-ASTNode *ast_create_name_item(const char *name, ASTNode *init, int line);
-ASTNode *ast_create_name_item_typed(const char *name, ASTNode *init, VarType type, int line);
+ASTNode *ast_create_name_item(Atom name, ASTNode *init, int line);
+ASTNode *ast_create_name_item_typed(Atom name, ASTNode *init, VarType type, int line);
 
 
-void ast_build_symbol_table(ASTNode *node, int *error_count);    
+void ast_build_symbol_table(SymbolTable *st, ASTNode *node, int *error_count);    
 void ast_print(ASTNode *node, int indent);
-int ast_check_semantics(ASTNode *node, int *error_count);
+int ast_check_semantics(SymbolTable *st, ASTNode *node, int *error_count);
 void ast_free(ASTNode *node);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,493 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "batch.h"
+#include "cache.h"
+#include "native.h"
+#include "source.h"
+#include "textbuf.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+/* One input line and, after a run, its output line */
+typedef struct {
+    const char *text;
+    size_t len;
+    int lineNo;
+    int bad;            // not a usable JSON object
+    TextBuf result;
+} Item;
+
+/* Items [top, bottom) of a thread's slice are still to do. The owner
+   takes from the bottom, thieves from the top. */
+typedef struct {
+    pthread_mutex_t lock;
+    int top;
+    int bottom;
+} Deque;
+
+typedef struct {
+    Item *items;
+    int count;
+    Deque *deques;
+    int threads;
+    const ColangOptions *opts;
+    ColangCache *cache;
+    long steals;
+    pthread_mutex_t statsLock;
+} Batch;
+
+typedef struct {
+    Batch *batch;
+    int id;
+} Worker;
+
+static int cpu_count(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+#endif
+}
+
+/* ---- JSON ---- */
+
+static const char *skip_ws(const char *p, const char *end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')) p++;
+    return p;
+}
+
+/* End of the string starting at the quote p, just past its closing quote */
+static const char *skip_string(const char *p, const char *end) {
+    for (p++; p < end; p++) {
+        if (*p == '\\') p++;
+        else if (*p == '"') return p + 1;
+    }
+    return NULL;
+}
+
+/* End of any JSON value at p; nested values are skipped by bracket depth */
+static const char *skip_value(const char *p, const char *end) {
+    if (p >= end) return NULL;
+    if (*p == '"') return skip_string(p, end);
+    if (*p == '{' || *p == '[') {
+        int depth = 0;
+        while (p < end) {
+            if (*p == '"') {
+                p = skip_string(p, end);
+                if (!p) return NULL;
+                continue;
+            }
+            if (*p == '{' || *p == '[') depth++;
+            else if (*p == '}' || *p == ']') {
+                if (--depth == 0) return p + 1;
+            }
+            p++;
+        }
+        return NULL;
+    }
+    const char *start = p;
+    while (p < end && *p != ',' && *p != '}' && *p != ']' && *p != ' ' && *p != '\t' && *p != '\r') p++;
+    return p > start ? p : NULL;
+}
+
+static int hex_digit(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+static void put_utf8(TextBuf *out, unsigned cp) {
+    char b[4];
+    size_t n;
+    if (cp < 0x80) {
+        b[0] = (char)cp;
+        n = 1;
+    } else if (cp < 0x800) {
+        b[0] = (char)(0xC0 | cp >> 6);
+        b[1] = (char)(0x80 | (cp & 0x3F));
+        n = 2;
+    } else if (cp < 0x10000) {
+        b[0] = (char)(0xE0 | cp >> 12);
+        b[1] = (char)(0x80 | (cp >> 6 & 0x3F));
+        b[2] = (char)(0x80 | (cp & 0x3F));
+        n = 3;
+    } else {
+        b[0] = (char)(0xF0 | cp >> 18);
+        b[1] = (char)(0x80 | (cp >> 12 & 0x3F));
+        b[2] = (char)(0x80 | (cp >> 6 & 0x3F));
+        b[3] = (char)(0x80 | (cp & 0x3F));
+        n = 4;
+    }
+    textbuf_append(out, b, n);
+}
+
+static int read_hex4(const char *p, const char *end, unsigned *cp) {
+    if (end - p < 4) return 0;
+    *cp = 0;
+    for (int i = 0; i < 4; i++) {
+        int d = hex_digit(p[i]);
+        if (d < 0) return 0;
+        *cp = *cp << 4 | (unsigned)d;
+    }
+    return 1;
+}
+
+/* Decode the string at the quote p into out. Returns 0 when malformed. */
+static int decode_string(const char *p, const char *end, TextBuf *out) {
+    for (p++; p < end; p++) {
+        char c = *p;
+        if (c == '"') return 1;
+        if (c != '\\') {
+            textbuf_append(out, p, 1);
+            continue;
+        }
+        if (++p >= end) return 0;
+        switch (*p) {
+            case '"':  textbuf_append(out, "\"", 1); break;
+            case '\\': textbuf_append(out, "\\", 1); break;
+            case '/':  textbuf_append(out, "/", 1); break;
+            case 'b':  textbuf_append(out, "\b", 1); break;
+            case 'f':  textbuf_append(out, "\f", 1); break;
+            case 'n':  textbuf_append(out, "\n", 1); break;
+            case 'r':  textbuf_append(out, "\r", 1); break;
+            case 't':  textbuf_append(out, "\t", 1); break;
+            case 'u': {
+                unsigned cp, low;
+                if (!read_hex4(p + 1, end, &cp)) return 0;
+                p += 4;
+                // A surrogate pair encodes one code point above U+FFFF
+                if (cp >= 0xD800 && cp < 0xDC00 && end - p > 6 && p[1] == '\\' && p[2] == 'u'
+                        && read_hex4(p + 3, end, &low) && low >= 0xDC00 && low < 0xE000) {
+                    cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                    p += 6;
+                }
+                put_utf8(out, cp);
+                break;
+            }
+            default:
+                return 0;
+        }
+    }
+    return 0;
+}
+
+/* Find "source" and "id" in the object on one line. The source is decoded
+   into source; id is left as the raw JSON text (NULL when absent). */
+static int parse_line(const char *p, const char *end, TextBuf *source,
+                      const char **id, size_t *idLen) {
+    int haveSource = 0;
+    *id = NULL;
+    p = skip_ws(p, end);
+    if (p >= end || *p != '{') return 0;
+    p = skip_ws(p + 1, end);
+    if (p < end && *p == '}') return 0;
+
+    for (;;) {
+        if (p >= end || *p != '"') return 0;
+        const char *key = p + 1;
+        const char *keyEnd = skip_string(p, end);
+        if (!keyEnd) return 0;
+        size_t keyLen = (size_t)(keyEnd - key - 1);
+        p = skip_ws(keyEnd, end);
+        if (p >= end || *p != ':') return 0;
+        p = skip_ws(p + 1, end);
+
+        const char *value = p;
+        p = skip_value(p, end);
+        if (!p) return 0;
+        if (keyLen == 6 && memcmp(key, "source", 6) == 0) {
+            if (*value != '"' || !decode_string(value, end, source)) return 0;
+            haveSource = 1;
+        } else if (keyLen == 2 && memcmp(key, "id", 2) == 0) {
+            *id = value;
+            *idLen = (size_t)(p - value);
+        }
+
+        p = skip_ws(p, end);
+        if (p < end && *p == ',') {
+            p = skip_ws(p + 1, end);
+            continue;
+        }
+        return p < end && *p == '}' && haveSource;
+    }
+}
+
+/* Length of the UTF-8 sequence at s for a code point of U+0100 or above,
+   or 0 when the bytes are not one (overlong, surrogate, out of range or cut
+   short). Code points below U+0100 are left to the \u00XX byte escape, so
+   that escape always stands for a single byte. */
+static size_t utf8_sequence(const unsigned char *s, size_t len) {
+    size_t n;
+    unsigned cp;
+    if (s[0] >= 0xC4 && s[0] < 0xE0) {
+        n = 2;
+        cp = s[0] & 0x1F;
+    } else if (s[0] >= 0xE0 && s[0] < 0xF0) {
+        n = 3;
+        cp = s[0] & 0x0F;
+    } else if (s[0] >= 0xF0 && s[0] < 0xF5) {
+        n = 4;
+        cp = s[0] & 0x07;
+    } else {
+        return 0;
+    }
+    if (n > len) return 0;
+    for (size_t k = 1; k < n; k++) {
+        if ((s[k] & 0xC0) != 0x80) return 0;
+        cp = cp << 6 | (s[k] & 0x3F);
+    }
+    if ((n == 3 && cp < 0x800) || (n == 4 && cp < 0x10000)) return 0;
+    if ((cp >= 0xD800 && cp < 0xE000) || cp > 0x10FFFF) return 0;
+    return n;
+}
+
+/* Console bytes as a JSON string, with the byte mapping batch.h describes */
+static void put_json_string(TextBuf *out, const char *s, size_t len) {
+    const unsigned char *u = (const unsigned char *)s;
+    textbuf_append(out, "\"", 1);
+    size_t run = 0;
+    for (size_t i = 0; i < len; i++) {
+        unsigned char c = u[i];
+        if (c >= 0x20 && c < 0x80 && c != '"' && c != '\\') continue;
+        size_t n = c >= 0x80 ? utf8_sequence(u + i, len - i) : 0;
+        if (n) {
+            i += n - 1;
+            continue;
+        }
+        textbuf_append(out, s + run, i - run);
+        run = i + 1;
+        switch (c) {
+            case '"':  textbuf_append(out, "\\\"", 2); break;
+            case '\\': textbuf_append(out, "\\\\", 2); break;
+            case '\n': textbuf_append(out, "\\n", 2); break;
+            case '\r': textbuf_append(out, "\\r", 2); break;
+            case '\t': textbuf_append(out, "\\t", 2); break;
+            default:   textbuf_printf(out, "\\u%04x", c); break;
+        }
+    }
+    textbuf_append(out, s + run, len - run);
+    textbuf_append(out, "\"", 1);
+}
+
+/* ---- Work ---- */
+
+static void run_item(Item *item, ColangContext *ctx, const ColangOptions *opts, TextBuf *source) {
+    const char *id;
+    size_t idLen = 0;
+    TextBuf *out = &item->result;
+
+    textbuf_clear(out);
+    textbuf_clear(source);
+    item->bad = !parse_line(item->text, item->text + item->len, source, &id, &idLen);
+
+    textbuf_puts(out, "{\"id\":");
+    if (!item->bad && id) textbuf_append(out, id, idLen);
+    else textbuf_printf(out, "%d", item->lineNo);
+    if (item->bad) {
+        textbuf_puts(out, ",\"status\":\"bad input\"}\n");
+        return;
+    }
+
+    ColangResult r;
+    colang_run(ctx, source->data ? source->data : "", source->len, opts, &r);
+    textbuf_puts(out, ",\"status\":");
+    put_json_string(out, colang_status_name(r.status), strlen(colang_status_name(r.status)));
+    textbuf_printf(out, ",\"error_line\":%d,\"instructions\":%ld,\"words\":%d,\"console\":",
+                   r.errorLine, r.instructions, r.words);
+    put_json_string(out, r.console.data, r.console.len);
+    textbuf_puts(out, "}\n");
+}
+
+/* Next item for worker w: its own bottom, else half of another slice */
+static int take(Batch *b, int w) {
+    Deque *own = &b->deques[w];
+    pthread_mutex_lock(&own->lock);
+    int idx = own->bottom > own->top ? --own->bottom : -1;
+    pthread_mutex_unlock(&own->lock);
+    if (idx >= 0) return idx;
+
+    for (int k = 1; k < b->threads; k++) {
+        Deque *victim = &b->deques[(w + k) % b->threads];
+        pthread_mutex_lock(&victim->lock);
+        int left = victim->bottom - victim->top;
+        int start = victim->top;
+        int half = (left + 1) / 2;
+        victim->top += half;
+        pthread_mutex_unlock(&victim->lock);
+        if (half == 0) continue;
+
+        // Own slice is empty and only its owner refills it
+        pthread_mutex_lock(&own->lock);
+        own->top = start + 1;
+        own->bottom = start + half;
+        pthread_mutex_unlock(&own->lock);
+        pthread_mutex_lock(&b->statsLock);
+        b->steals++;
+        pthread_mutex_unlock(&b->statsLock);
+        return start;
+    }
+    return -1;
+}
+
+static void *worker_main(void *arg) {
+    Worker *wk = arg;
+    Batch *b = wk->batch;
+    ColangContext *ctx = colang_create();
+    colang_set_cache(ctx, b->cache);
+    TextBuf source;
+    textbuf_init(&source);
+
+    int idx;
+    while ((idx = take(b, wk->id)) >= 0) run_item(&b->items[idx], ctx, b->opts, &source);
+
+    textbuf_free(&source);
+    colang_free(ctx);
+    return NULL;
+}
+
+/* Run every item on `threads` threads; returns the wall time in ms */
+static double run_pool(Batch *b, int threads) {
+    b->threads = threads;
+    b->steals = 0;
+    for (int t = 0; t < threads; t++) {
+        b->deques[t].top = (int)((long)b->count * t / threads);
+        b->deques[t].bottom = (int)((long)b->count * (t + 1) / threads);
+    }
+
+    pthread_t *tids = calloc((size_t)threads, sizeof(pthread_t));
+    Worker *workers = calloc((size_t)threads, sizeof(Worker));
+    if (!tids || !workers) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    double start = native_now_ms();
+    for (int t = 0; t < threads; t++) {
+        workers[t].batch = b;
+        workers[t].id = t;
+        pthread_create(&tids[t], NULL, worker_main, &workers[t]);
+    }
+    for (int t = 0; t < threads; t++) pthread_join(tids[t], NULL);
+    double elapsed = native_now_ms() - start;
+    free(tids);
+    free(workers);
+    return elapsed;
+}
+
+/* Every item's result concatenated, to compare whole runs */
+static void collect(const Batch *b, TextBuf *all) {
+    textbuf_clear(all);
+    for (int i = 0; i < b->count; i++) textbuf_append(all, b->items[i].result.data, b->items[i].result.len);
+}
+
+static int split_lines(Source *src, Batch *b) {
+    int cap = 1024;
+    b->items = malloc((size_t)cap * sizeof(Item));
+    if (!b->items) return -1;
+
+    const char *p = src->text, *end = src->text + src->size;
+    int lineNo = 0;
+    while (p < end) {
+        const char *nl = memchr(p, '\n', (size_t)(end - p));
+        const char *lineEnd = nl ? nl : end;
+        lineNo++;
+        if (skip_ws(p, lineEnd) < lineEnd) {
+            if (b->count == cap) {
+                cap *= 2;
+                Item *grown = realloc(b->items, (size_t)cap * sizeof(Item));
+                if (!grown) return -1;
+                b->items = grown;
+            }
+            Item *item = &b->items[b->count++];
+            memset(item, 0, sizeof(*item));
+            item->text = p;
+            item->len = (size_t)(lineEnd - p);
+            item->lineNo = lineNo;
+            textbuf_init(&item->result);
+        }
+        p = lineEnd + 1;
+    }
+    return 0;
+}
+
+int batch_run(FILE *in, FILE *out, const ColangOptions *opts, int threads, int scaling,
+              ColangCache *cache, FILE *report) {
+    if (threads <= 0) threads = cpu_count();
+
+    Source src;
+    if (source_load(in, &src) != 0) return 1;
+    Batch b;
+    memset(&b, 0, sizeof(b));
+    b.opts = opts;
+    b.cache = cache;
+    if (split_lines(&src, &b) != 0) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    b.deques = calloc((size_t)threads, sizeof(Deque));
+    if (!b.deques) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (int t = 0; t < threads; t++) pthread_mutex_init(&b.deques[t].lock, NULL);
+    pthread_mutex_init(&b.statsLock, NULL);
+
+    if (scaling) {
+        TextBuf first, again;
+        textbuf_init(&first);
+        textbuf_init(&again);
+        int identical = 1;
+        double base = 0;
+        fprintf(report, "programs: %d (%zu bytes)\n", b.count, src.size);
+        fprintf(report, "%7s %12s %8s %7s\n", "threads", "programs/s", "speedup", "steals");
+        for (int n = 1; ; n = n * 2 < threads ? n * 2 : threads) {
+            double ms = run_pool(&b, n);
+            double rate = ms > 0 ? b.count * 1000.0 / ms : 0;
+            if (n == 1) base = rate;
+            fprintf(report, "%7d %12.1f %8.2f %7ld\n", n, rate, base > 0 ? rate / base : 0, b.steals);
+            if (n == 1) {
+                collect(&b, &first);
+            } else {
+                collect(&b, &again);
+                if (again.len != first.len || memcmp(again.data, first.data, first.len) != 0) identical = 0;
+            }
+            if (n == threads) break;
+        }
+        fprintf(report, "results: %s at every thread count\n", identical ? "identical" : "DIFFERENT");
+        textbuf_free(&first);
+        textbuf_free(&again);
+    } else {
+        run_pool(&b, threads);
+    }
+
+    int bad = 0;
+    for (int i = 0; i < b.count; i++) {
+        fwrite(b.items[i].result.data, 1, b.items[i].result.len, out);
+        bad += b.items[i].bad;
+        textbuf_free(&b.items[i].result);
+    }
+    if (bad) fprintf(stderr, "%d line(s) were not {\"source\": ...} objects\n", bad);
+    if (cache) {
+        TextBuf stats;
+        textbuf_init(&stats);
+        cache_report(cache, &stats);
+        fwrite(stats.data, 1, stats.len, report);
+        textbuf_free(&stats);
+    }
+
+    for (int t = 0; t < threads; t++) pthread_mutex_destroy(&b.deques[t].lock);
+    pthread_mutex_destroy(&b.statsLock);
+    free(b.deques);
+    free(b.items);
+    source_free(&src);
+    return bad ? 1 : 0;
+}
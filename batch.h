@@ -0,0 +1,42 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <stdio.h>
+#include "colang.h"
+
+/* Batch driver (--batch). Every non-blank input line is a JSON object
+   with the program in "source" and optionally an "id" of any JSON type;
+   other members are ignored. Each program is compiled and run with
+   colang_run and gets one JSON line in the output, in input order:
+
+     {"id":..., "status":"ok", "error_line":0, "instructions":12,
+      "words":9, "console":"..."}
+
+   "id" is copied through as written, or is the input line number when
+   there is none. Lines that are not such an object get
+   "status":"bad input".
+
+   "console" holds raw bytes (a chr can print any of 0x00-0xFF) but the
+   line is always valid UTF-8 JSON. Valid UTF-8 for a code point of U+0100
+   or above is copied as is; every other byte, including each byte of a
+   UTF-8 sequence for U+0080-U+00FF, is escaped as \u00XX with XX its
+   value. To get the bytes back, decode the string and turn each code point
+   below U+0100 into that one byte and every other one into its UTF-8.
+
+   Programs are spread over a work-stealing pool: each thread starts with
+   an equal slice of the input and, once its own slice is done, takes half
+   of what is left in another thread's. Results are kept per input line,
+   so the output does not depend on the thread count. */
+
+/* Run the batch on `threads` threads (<= 0: one per online CPU) and write
+   the results to out. With scaling, the batch is first timed at 1, 2,
+   4, ... threads up to that count and the programs/s at each are reported
+   on report, along with whether every run produced the same output.
+   With a cache (may be NULL), repeated programs are replayed from it and
+   its report follows; the passes of a scaling run share it, so after the
+   first they mostly measure cache hits. Returns 0 when every line was
+   read and run. */
+int batch_run(FILE *in, FILE *out, const ColangOptions *opts, int threads, int scaling,
+              ColangCache *cache, FILE *report);
+
+#endif
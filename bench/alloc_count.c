@@ -0,0 +1,63 @@
+/* Allocation counter for LD_PRELOAD: counts the calls that reach malloc,
+   calloc and realloc and prints the totals to stderr at exit.
+
+   gcc -shared -fPIC -O2 -o alloc_count.so alloc_count.c -ldl
+   LD_PRELOAD=./alloc_count.so ./scanner.exe < program.cl > /dev/null */
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <stdio.h>
+#include <stddef.h>
+#include <unistd.h>
+
+static long mallocs, callocs, reallocs;
+static void *(*real_malloc)(size_t);
+static void *(*real_realloc)(void *, size_t);
+
+/* dlsym may itself call calloc before the real one is known; serve that
+   from a small static pool */
+static char pool[4096];
+static size_t poolUsed;
+
+void *malloc(size_t size) {
+    if (!real_malloc) real_malloc = (void *(*)(size_t))dlsym(RTLD_NEXT, "malloc");
+    mallocs++;
+    return real_malloc(size);
+}
+
+void *calloc(size_t count, size_t size) {
+    static void *(*real_calloc)(size_t, size_t);
+    static int resolving;
+    if (!real_calloc) {
+        if (resolving) {
+            size_t n = (count * size + 15) & ~(size_t)15;
+            if (poolUsed + n > sizeof(pool)) return NULL;
+            poolUsed += n;
+            return pool + poolUsed - n;     // static storage is already zero
+        }
+        resolving = 1;
+        real_calloc = (void *(*)(size_t, size_t))dlsym(RTLD_NEXT, "calloc");
+        resolving = 0;
+    }
+    callocs++;
+    return real_calloc(count, size);
+}
+
+void *realloc(void *ptr, size_t size) {
+    if (!real_realloc) real_realloc = (void *(*)(void *, size_t))dlsym(RTLD_NEXT, "realloc");
+    reallocs++;
+    return real_realloc(ptr, size);
+}
+
+void free(void *ptr) {
+    static void (*real_free)(void *);
+    if ((char *)ptr >= pool && (char *)ptr < pool + sizeof(pool)) return;
+    if (!real_free) real_free = (void (*)(void *))dlsym(RTLD_NEXT, "free");
+    real_free(ptr);
+}
+
+__attribute__((destructor)) static void report(void) {
+    char line[128];
+    int n = snprintf(line, sizeof(line), "allocations: malloc %ld, calloc %ld, realloc %ld\n",
+                     mallocs, callocs, reallocs);
+    if (n > 0) write(2, line, (size_t)n);
+}
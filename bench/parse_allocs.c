@@ -0,0 +1,18 @@
+/* Front end only: read a program from stdin and parse it, so the
+   allocation counter sees the scanner, parser and AST and nothing else.
+   Built by parse_allocs.sh. */
+#include <stdio.h>
+#include "compiler.h"
+#include "source.h"
+
+int main(void) {
+    Source src;
+    if (source_load(stdin, &src) != 0) return 1;
+    Compiler *cc = compiler_create();
+    int result = compiler_parse(cc, src.text, src.size);
+    fprintf(stderr, "parse: %s, %zu bytes, %ld token text copies\n",
+            result == 0 ? "ok" : "failed", src.size, cc->textCopies);
+    compiler_free(cc);
+    source_free(&src);
+    return result;
+}
@@ -0,0 +1,22 @@
+#!/bin/sh
+# Count the allocations the front end makes parsing a generated 60,900-line
+# program (900 declarations, then 40,000 compound assignments and 20,000
+# shw lines). Run from the repository root; needs gcc and LD_PRELOAD.
+set -e
+out=${TMPDIR:-/tmp}/colang-bench
+mkdir -p "$out"
+
+gcc -shared -fPIC -O2 -o "$out/alloc_count.so" bench/alloc_count.c -ldl
+gcc -O2 -DCOLANG_HAND_SCANNER -I. -o "$out/parse_allocs" bench/parse_allocs.c \
+    $(ls *.c | grep -v -e '^main\.c$' -e '^lex\.yy\.c$') -lpthread
+
+awk 'BEGIN {
+    for (i = 0; i < 900; i++) printf "nmbr v%d : %d\n", i, i
+    for (i = 0; i < 20000; i++) {
+        printf "v%d +: v%d * 3\n", (i * 7919) % 900, (i * 104729) % 900
+        printf "shw \"value of v%d is \".v%d\n", (i * 31) % 900, (i * 31) % 900
+        printf "v%d +: v%d * 3\n", (i * 613) % 900, (i * 4441) % 900
+    }
+}' > "$out/program.cl"
+
+LD_PRELOAD="$out/alloc_count.so" "$out/parse_allocs" < "$out/program.cl"
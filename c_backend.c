@@ -0,0 +1,227 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "c_backend.h"
+#include "native.h"
+#include "vm.h"
+#include "symbol_table.h"
+
+/* Runtime prelude of every generated unit */
+static const char *c_prelude =
+    "#include <stdio.h>\n"
+    "#include <string.h>\n"
+    "\n"
+    "/* Wrapping arithmetic, as the interpreter does on its host */\n"
+    "#define ADD(a, b) ((int)((unsigned)(a) + (unsigned)(b)))\n"
+    "#define SUB(a, b) ((int)((unsigned)(a) - (unsigned)(b)))\n"
+    "#define MUL(a, b) ((int)((unsigned)(a) * (unsigned)(b)))\n"
+    "\n"
+    "static char out_buf[65536];\n"
+    "static size_t out_len;\n"
+    "\n"
+    "static void out_flush(void) {\n"
+    "    fwrite(out_buf, 1, out_len, stdout);\n"
+    "    out_len = 0;\n"
+    "}\n"
+    "\n"
+    "static void out_bytes(const char *s, size_t n) {\n"
+    "    if (out_len + n > sizeof(out_buf)) {\n"
+    "        out_flush();\n"
+    "        if (n > sizeof(out_buf)) {\n"
+    "            fwrite(s, 1, n, stdout);\n"
+    "            return;\n"
+    "        }\n"
+    "    }\n"
+    "    memcpy(out_buf + out_len, s, n);\n"
+    "    out_len += n;\n"
+    "}\n"
+    "\n"
+    "static void out_str(const char *s) { out_bytes(s, strlen(s)); }\n"
+    "static void out_chr(int v) { char c = (char)v; out_bytes(&c, 1); }\n"
+    "\n"
+    "static void out_num(int v) {\n"
+    "    char tmp[16];\n"
+    "    int n = snprintf(tmp, sizeof(tmp), \"%d\", v);\n"
+    "    out_bytes(tmp, (size_t)n);\n"
+    "}\n"
+    "\n"
+    "static int div_error(int line) {\n"
+    "    out_flush();\n"
+    "    fflush(stdout);\n"
+    "    fprintf(stderr, \"Runtime error at line %d: Division by zero\\n\", line);\n"
+    "    return 1;\n"
+    "}\n"
+    "\n";
+
+/* C name of a frame slot */
+static void slot_name(const VMProgram *vm, int slot, char *buf, size_t size) {
+    if (slot < vm->varCount) {
+        snprintf(buf, size, "v_%s", vm->symbols->entries[slot].name);
+    } else if (slot < vm->slotCount - 1) {
+        snprintf(buf, size, "t%d", slot - vm->varCount);
+    } else {
+        snprintf(buf, size, "scratch");
+    }
+}
+
+static void imm_text(int v, char *buf, size_t size) {
+    if (v == INT_MIN) snprintf(buf, size, "(-2147483647 - 1)");
+    else snprintf(buf, size, "%d", v);
+}
+
+static void operand_text(const VMProgram *vm, int isImm, int v, char *buf, size_t size) {
+    if (isImm) imm_text(v, buf, size);
+    else slot_name(vm, v, buf, size);
+}
+
+static void emit_string_literal(FILE *out, const char *s) {
+    fputc('"', out);
+    for (const unsigned char *p = (const unsigned char *)s; *p; p++) {
+        if (*p == '"' || *p == '\\' || *p == '?') {
+            fprintf(out, "\\%c", *p);
+        } else if (*p < 0x20 || *p >= 0x7F) {
+            fprintf(out, "\\%03o", *p);
+        } else {
+            fputc(*p, out);
+        }
+    }
+    fputc('"', out);
+}
+
+static void emit_declarations(TACProgram *prog, const VMProgram *vm, FILE *out) {
+    char name[256];
+    for (int i = 0; i < vm->varCount; i++) {
+        slot_name(vm, i, name, sizeof(name));
+        fprintf(out, "    int %s = 0;    /* %s %s */\n", name, type_to_string(vm->symbols->entries[i].type), vm->symbols->entries[i].name);
+    }
+
+    /* Only the temps the code refers to */
+    int temps = vm->slotCount - 1 - vm->varCount;
+    unsigned char *used = calloc(temps > 0 ? temps : 1, 1);
+    if (!used) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (TACInstr *instr = prog->head; instr; instr = instr->next) {
+        TACOperand ops[3] = { instr->result, instr->arg1, instr->arg2 };
+        for (int k = 0; k < 3; k++) {
+            if (ops[k].type == OPERAND_TEMP) used[ops[k].val.tempNum] = 1;
+        }
+    }
+    for (int t = 0; t < temps; t++) {
+        if (used[t]) fprintf(out, "    int t%d = 0;\n", t);
+    }
+    free(used);
+    fprintf(out, "    int scratch = 0;\n\n");
+}
+
+static void emit_body(const VMProgram *vm, FILE *out) {
+    char d[256], a[256], b[256];
+    for (int i = 0; i < vm->count; i += vm_op_length[vm->code[i].i]) {
+        const VMWord *pc = &vm->code[i];
+        int op = pc[0].i;
+
+        if (op >= VM_ADD_SS && op <= VM_DIV_IS) {
+            int kind = (op - VM_ADD_SS) % 3;
+            slot_name(vm, pc[1].i, d, sizeof(d));
+            operand_text(vm, kind == 2, pc[2].i, a, sizeof(a));
+            operand_text(vm, kind == 1, pc[3].i, b, sizeof(b));
+            switch ((op - VM_ADD_SS) / 3) {
+                case 0: fprintf(out, "    %s = ADD(%s, %s);\n", d, a, b); break;
+                case 1: fprintf(out, "    %s = SUB(%s, %s);\n", d, a, b); break;
+                case 2: fprintf(out, "    %s = MUL(%s, %s);\n", d, a, b); break;
+                default:
+                    if (kind != 1 || pc[3].i == 0)
+                        fprintf(out, "    if (%s == 0) return div_error(%d);\n", b, pc[4].i);
+                    fprintf(out, "    %s = %s / %s;\n", d, a, b);
+                    break;
+            }
+            continue;
+        }
+
+        switch (op) {
+            case VM_LOADI:
+                slot_name(vm, pc[1].i, d, sizeof(d));
+                imm_text(pc[2].i, a, sizeof(a));
+                fprintf(out, "    %s = %s;\n", d, a);
+                break;
+            case VM_MOV:
+                slot_name(vm, pc[1].i, d, sizeof(d));
+                slot_name(vm, pc[2].i, a, sizeof(a));
+                fprintf(out, "    %s = %s;\n", d, a);
+                break;
+            case VM_TRUNC:
+                slot_name(vm, pc[1].i, d, sizeof(d));
+                fprintf(out, "    %s = (char)%s;\n", d, d);
+                break;
+            case VM_TAG_NUM:
+                // Prints already know the flex tag, only the VM keeps it
+                break;
+            case VM_TAG_CHR:
+                slot_name(vm, pc[1].i, d, sizeof(d));
+                fprintf(out, "    %s = (char)%s;\n", d, d);
+                break;
+            case VM_PRINT_NUM:
+            case VM_PRINT_CHR:
+                slot_name(vm, pc[1].i, d, sizeof(d));
+                fprintf(out, "    %s(%s);\n", op == VM_PRINT_NUM ? "out_num" : "out_chr", d);
+                break;
+            case VM_PRINT_NUM_I:
+            case VM_PRINT_CHR_I:
+                imm_text(pc[1].i, a, sizeof(a));
+                fprintf(out, "    %s(%s);\n", op == VM_PRINT_NUM_I ? "out_num" : "out_chr", a);
+                break;
+            case VM_PRINT_STR:
+                fprintf(out, "    out_str(");
+                emit_string_literal(out, pc[1].str);
+                fprintf(out, ");\n");
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+void c_backend_emit(TACProgram *prog, FILE *out) {
+    VMProgram *vm = vm_compile(prog);
+
+    fprintf(out, "/* Generated by the Colang C backend */\n");
+    fputs(c_prelude, out);
+    fprintf(out, "int main(void) {\n");
+    emit_declarations(prog, vm, out);
+    emit_body(vm, out);
+    fprintf(out, "\n    out_flush();\n    return 0;\n}\n");
+
+    vm_free(vm);
+}
+
+int c_backend_run(TACProgram *prog, const char *cPath) {
+    FILE *out = fopen(cPath, "w");
+    if (!out) {
+        fprintf(stderr, "Could not open '%s' for writing\n", cPath);
+        return 1;
+    }
+    c_backend_emit(prog, out);
+    fclose(out);
+
+    const char *cc = native_compiler();
+    if (!cc) {
+        fprintf(stderr, "No C compiler found; wrote '%s' without building it\n", cPath);
+        return 0;
+    }
+
+    char exePath[1024];
+    native_exe_path(cPath, exePath, sizeof(exePath));
+    if (native_build(cc, cPath, exePath) != 0) {
+        fprintf(stderr, "C backend: '%s' failed to compile\n", cPath);
+        return 1;
+    }
+
+    NativeResult res;
+    if (native_check(prog, exePath, 1, &res) != 0) {
+        fprintf(stderr, "C backend: output of '%s' differs from tac_execute\n", exePath);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,18 @@
+#ifndef C_BACKEND_H
+#define C_BACKEND_H
+
+#include <stdio.h>
+#include "tac.h"
+
+/* Emit a self-contained C translation unit for the program: variables and
+   temps become locals of main, shw output goes through a write buffer.
+   Symbols start out zeroed, as they do before tac_execute. */
+void c_backend_emit(TACProgram *prog, FILE *out);
+
+/* Write the translation unit to cPath and, when a C compiler is available
+   ($CC, else cc), build it next to the source and check that its output
+   and exit status match tac_execute. Returns 0 when the file was written
+   and, if it could be built, behaves the same as the interpreter. */
+int c_backend_run(TACProgram *prog, const char *cPath);
+
+#endif
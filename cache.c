@@ -0,0 +1,412 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include "cache.h"
+
+#ifdef _WIN32
+#include <direct.h>
+#include <process.h>
+#define make_dir(path) _mkdir(path)
+#define process_id() _getpid()
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#define make_dir(path) mkdir(path, 0777)
+#define process_id() getpid()
+#endif
+
+/* Bump when the result of a compile can change for the same source and
+   options, so old directory entries stop matching */
+#define CACHE_TAG "colang-cache 1"
+
+/* Directory entry: "CLC1", key, status, limit, error line, error count,
+   instructions, words and the four text lengths as big-endian u32, then
+   the texts back to back */
+#define FILE_MAGIC "CLC1"
+#define FILE_HEADER (4 + SHA256_SIZE + 4 * (6 + CACHE_TEXTS))
+
+typedef struct Entry {
+    unsigned char key[SHA256_SIZE];
+    struct Entry *chain;            // next in the same bucket
+    struct Entry *newer, *older;    // LRU list
+    size_t bytes;                   // charged against maxBytes
+    ColangStatus status;
+    ColangLimit limit;
+    int errorLine;
+    int errorCount;
+    long instructions;
+    int words;
+    size_t len[CACHE_TEXTS];
+    char *text[CACHE_TEXTS];        // in the same block, after the entry
+} Entry;
+
+struct ColangCache {
+    pthread_mutex_t lock;
+    Entry **buckets;
+    size_t bucketCount;             // power of two
+    Entry *newest;
+    Entry *oldest;
+    char *dir;                      // NULL: memory only
+    long fileSeq;                   // for unique temporary file names
+    ColangCacheStats stats;
+};
+
+static void *xmalloc(size_t size) {
+    void *p = malloc(size);
+    if (!p) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    return p;
+}
+
+static void put_u32(unsigned char *p, uint32_t v) {
+    p[0] = (unsigned char)(v >> 24);
+    p[1] = (unsigned char)(v >> 16);
+    p[2] = (unsigned char)(v >> 8);
+    p[3] = (unsigned char)v;
+}
+
+static uint32_t get_u32(const unsigned char *p) {
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+/* ---- Keys ---- */
+
+static void hash_u64(Sha256 *h, uint64_t v) {
+    unsigned char bytes[8];
+    for (int i = 0; i < 8; i++) bytes[i] = (unsigned char)(v >> (56 - 8 * i));
+    sha256_update(h, bytes, 8);
+}
+
+void cache_key(const ColangOptions *opts, const char *source, size_t len, unsigned char key[SHA256_SIZE]) {
+    Sha256 h;
+    sha256_init(&h);
+    sha256_update(&h, CACHE_TAG, sizeof(CACHE_TAG));
+    hash_u64(&h, (uint64_t)opts->engine);
+    hash_u64(&h, opts->artifacts & COLANG_ARTIFACT_ALL);
+    hash_u64(&h, opts->peephole != 0);
+    hash_u64(&h, opts->schedule != 0);
+    hash_u64(&h, opts->peval != 0);
+    hash_u64(&h, opts->pevalVars != 0);
+    hash_u64(&h, opts->maxSourceBytes);
+    hash_u64(&h, (uint64_t)opts->maxInstructions);
+    hash_u64(&h, opts->maxOutputBytes);
+    hash_u64(&h, len);
+    sha256_update(&h, source, len);
+    sha256_final(&h, key);
+}
+
+/* ---- Entries ---- */
+
+static Entry *entry_new(const size_t len[CACHE_TEXTS]) {
+    size_t bytes = sizeof(Entry);
+    for (int i = 0; i < CACHE_TEXTS; i++) bytes += len[i] + 1;
+    Entry *e = xmalloc(bytes);
+    memset(e, 0, sizeof(Entry));
+    e->bytes = bytes;
+    char *p = (char *)(e + 1);
+    for (int i = 0; i < CACHE_TEXTS; i++) {
+        e->len[i] = len[i];
+        e->text[i] = p;
+        p[len[i]] = '\0';
+        p += len[i] + 1;
+    }
+    return e;
+}
+
+static Entry *entry_from_result(const unsigned char *key, const ColangResult *r) {
+    const ColangText *texts[CACHE_TEXTS] = { &r->console, &r->assembly, &r->binary, &r->hex };
+    size_t len[CACHE_TEXTS];
+    for (int i = 0; i < CACHE_TEXTS; i++) len[i] = texts[i]->len;
+    Entry *e = entry_new(len);
+    memcpy(e->key, key, SHA256_SIZE);
+    e->status = r->status;
+    e->limit = r->limit;
+    e->errorLine = r->errorLine;
+    e->errorCount = r->errorCount;
+    e->instructions = r->instructions;
+    e->words = r->words;
+    for (int i = 0; i < CACHE_TEXTS; i++) memcpy(e->text[i], texts[i]->data, len[i]);
+    return e;
+}
+
+static void entry_to_result(const Entry *e, ColangResult *r, TextBuf *texts[CACHE_TEXTS]) {
+    r->status = e->status;
+    r->limit = e->limit;
+    r->errorLine = e->errorLine;
+    r->errorCount = e->errorCount;
+    r->instructions = e->instructions;
+    r->words = e->words;
+    for (int i = 0; i < CACHE_TEXTS; i++) {
+        textbuf_clear(texts[i]);
+        textbuf_append(texts[i], e->text[i], e->len[i]);
+    }
+}
+
+/* ---- Table and LRU list (callers hold the lock) ---- */
+
+static Entry **bucket_of(ColangCache *cache, const unsigned char *key) {
+    // The key is a hash already; any eight bytes of it spread evenly
+    size_t h;
+    memcpy(&h, key, sizeof(h));
+    return &cache->buckets[h & (cache->bucketCount - 1)];
+}
+
+static Entry *find(ColangCache *cache, const unsigned char *key) {
+    for (Entry *e = *bucket_of(cache, key); e; e = e->chain)
+        if (memcmp(e->key, key, SHA256_SIZE) == 0) return e;
+    return NULL;
+}
+
+static void lru_unlink(ColangCache *cache, Entry *e) {
+    if (e->newer) e->newer->older = e->older;
+    else cache->newest = e->older;
+    if (e->older) e->older->newer = e->newer;
+    else cache->oldest = e->newer;
+    e->newer = e->older = NULL;
+}
+
+static void lru_push(ColangCache *cache, Entry *e) {
+    e->newer = NULL;
+    e->older = cache->newest;
+    if (cache->newest) cache->newest->newer = e;
+    else cache->oldest = e;
+    cache->newest = e;
+}
+
+static void evict_oldest(ColangCache *cache) {
+    Entry *e = cache->oldest;
+    Entry **link = bucket_of(cache, e->key);
+    while (*link != e) link = &(*link)->chain;
+    *link = e->chain;
+    lru_unlink(cache, e);
+    cache->stats.entries--;
+    cache->stats.bytes -= e->bytes;
+    cache->stats.evictions++;
+    cache->stats.evictedBytes += e->bytes;
+    free(e);
+}
+
+static void grow(ColangCache *cache) {
+    size_t count = cache->bucketCount * 2;
+    Entry **buckets = calloc(count, sizeof(Entry *));
+    if (!buckets) return;       // keep the longer chains
+    for (size_t i = 0; i < cache->bucketCount; i++) {
+        Entry *next;
+        for (Entry *e = cache->buckets[i]; e; e = next) {
+            next = e->chain;
+            size_t h;
+            memcpy(&h, e->key, sizeof(h));
+            Entry **b = &buckets[h & (count - 1)];
+            e->chain = *b;
+            *b = e;
+        }
+    }
+    free(cache->buckets);
+    cache->buckets = buckets;
+    cache->bucketCount = count;
+}
+
+/* Takes e over: added as the newest entry, or freed when it cannot stay */
+static void insert(ColangCache *cache, Entry *e) {
+    // Another thread may have stored the same program meanwhile
+    if (e->bytes > cache->stats.maxBytes || find(cache, e->key)) {
+        free(e);
+        return;
+    }
+    while (cache->stats.bytes + e->bytes > cache->stats.maxBytes) evict_oldest(cache);
+    if ((size_t)cache->stats.entries >= cache->bucketCount) grow(cache);
+    Entry **b = bucket_of(cache, e->key);
+    e->chain = *b;
+    *b = e;
+    lru_push(cache, e);
+    cache->stats.entries++;
+    cache->stats.bytes += e->bytes;
+    cache->stats.stores++;
+}
+
+/* ---- Directory ---- */
+
+static void file_path(const ColangCache *cache, const unsigned char *key, char *path, size_t size) {
+    char hex[2 * SHA256_SIZE + 1];
+    for (int i = 0; i < SHA256_SIZE; i++) sprintf(hex + 2 * i, "%02x", key[i]);
+    snprintf(path, size, "%s/%s", cache->dir, hex);
+}
+
+/* The entry stored under key, NULL when there is none or it is damaged */
+static Entry *disk_read(ColangCache *cache, const unsigned char *key, int *damaged) {
+    char path[4096];
+    file_path(cache, key, path, sizeof(path));
+    FILE *f = fopen(path, "rb");
+    if (!f) return NULL;
+
+    Entry *e = NULL;
+    unsigned char head[FILE_HEADER];
+    *damaged = 1;
+    if (fread(head, 1, FILE_HEADER, f) == FILE_HEADER && memcmp(head, FILE_MAGIC, 4) == 0 &&
+        memcmp(head + 4, key, SHA256_SIZE) == 0) {
+        const unsigned char *p = head + 4 + SHA256_SIZE;
+        size_t len[CACHE_TEXTS], total = FILE_HEADER;
+        for (int i = 0; i < CACHE_TEXTS; i++) total += len[i] = get_u32(p + 4 * (6 + i));
+        // The lengths must add up to the file, before anything is allocated
+        long size = fseek(f, 0, SEEK_END) == 0 ? ftell(f) : -1;
+        if (size >= 0 && (size_t)size == total && get_u32(p) <= COLANG_LIMIT_EXCEEDED &&
+            get_u32(p + 4) <= COLANG_LIMIT_OUTPUT && fseek(f, FILE_HEADER, SEEK_SET) == 0) {
+            e = entry_new(len);
+            memcpy(e->key, key, SHA256_SIZE);
+            e->status = (ColangStatus)get_u32(p);
+            e->limit = (ColangLimit)get_u32(p + 4);
+            e->errorLine = (int)get_u32(p + 8);
+            e->errorCount = (int)get_u32(p + 12);
+            e->instructions = (long)get_u32(p + 16);
+            e->words = (int)get_u32(p + 20);
+            int ok = 1;
+            for (int i = 0; ok && i < CACHE_TEXTS; i++) ok = fread(e->text[i], 1, len[i], f) == len[i];
+            if (ok) {
+                *damaged = 0;
+            } else {
+                free(e);
+                e = NULL;
+            }
+        }
+    }
+    fclose(f);
+    return e;
+}
+
+/* Write to a temporary name and rename, so readers never see half a file */
+static int disk_write(ColangCache *cache, const Entry *e, long seq) {
+    char path[4096], tmp[4200];
+    file_path(cache, e->key, path, sizeof(path));
+    snprintf(tmp, sizeof(tmp), "%s.%ld.%ld.tmp", path, (long)process_id(), seq);
+
+    unsigned char head[FILE_HEADER];
+    memcpy(head, FILE_MAGIC, 4);
+    memcpy(head + 4, e->key, SHA256_SIZE);
+    unsigned char *p = head + 4 + SHA256_SIZE;
+    put_u32(p, (uint32_t)e->status);
+    put_u32(p + 4, (uint32_t)e->limit);
+    put_u32(p + 8, (uint32_t)e->errorLine);
+    put_u32(p + 12, (uint32_t)e->errorCount);
+    put_u32(p + 16, (uint32_t)e->instructions);
+    put_u32(p + 20, (uint32_t)e->words);
+    for (int i = 0; i < CACHE_TEXTS; i++) put_u32(p + 4 * (6 + i), (uint32_t)e->len[i]);
+
+    FILE *f = fopen(tmp, "wb");
+    if (!f) return -1;
+    int ok = fwrite(head, 1, FILE_HEADER, f) == FILE_HEADER;
+    for (int i = 0; ok && i < CACHE_TEXTS; i++) ok = fwrite(e->text[i], 1, e->len[i], f) == e->len[i];
+    if (fclose(f) != 0) ok = 0;
+    if (ok && rename(tmp, path) == 0) return 0;
+    remove(tmp);    // on Windows rename fails when another writer got there first
+    return -1;
+}
+
+/* ---- Lookups ---- */
+
+int cache_lookup(ColangCache *cache, const unsigned char key[SHA256_SIZE],
+                 ColangResult *result, TextBuf *texts[CACHE_TEXTS]) {
+    pthread_mutex_lock(&cache->lock);
+    Entry *e = find(cache, key);
+    if (e) {
+        lru_unlink(cache, e);
+        lru_push(cache, e);
+        entry_to_result(e, result, texts);
+        cache->stats.hits++;
+        pthread_mutex_unlock(&cache->lock);
+        return 1;
+    }
+    pthread_mutex_unlock(&cache->lock);
+
+    int damaged = 0;
+    e = cache->dir ? disk_read(cache, key, &damaged) : NULL;
+    if (e) entry_to_result(e, result, texts);
+
+    pthread_mutex_lock(&cache->lock);
+    if (e) {
+        cache->stats.diskHits++;
+        insert(cache, e);
+    } else {
+        cache->stats.misses++;
+        cache->stats.diskErrors += damaged;
+    }
+    pthread_mutex_unlock(&cache->lock);
+    return e != NULL;
+}
+
+void cache_store(ColangCache *cache, const unsigned char key[SHA256_SIZE], const ColangResult *result) {
+    Entry *e = entry_from_result(key, result);
+    long seq = 0;
+    if (cache->dir) {
+        pthread_mutex_lock(&cache->lock);
+        seq = cache->fileSeq++;
+        pthread_mutex_unlock(&cache->lock);
+    }
+    int written = cache->dir ? disk_write(cache, e, seq) : 1;
+
+    pthread_mutex_lock(&cache->lock);
+    if (written == 0) cache->stats.diskWrites++;
+    else if (written < 0) cache->stats.diskErrors++;
+    insert(cache, e);
+    pthread_mutex_unlock(&cache->lock);
+}
+
+void cache_report(ColangCache *cache, TextBuf *out) {
+    ColangCacheStats s;
+    colang_cache_stats(cache, &s);
+    long lookups = s.hits + s.diskHits + s.misses;
+    textbuf_printf(out, "cache lookups: %ld, %ld hit(s), %ld from disk, %ld miss(es) (%.1f%% hit rate)\n",
+                   lookups, s.hits, s.diskHits, s.misses,
+                   lookups ? (s.hits + s.diskHits) * 100.0 / lookups : 0.0);
+    textbuf_printf(out, "cache memory: %ld entr%s, %zu of %zu bytes, %ld stored\n",
+                   s.entries, s.entries == 1 ? "y" : "ies", s.bytes, s.maxBytes, s.stores);
+    textbuf_printf(out, "cache evictions: %ld (%zu bytes)\n", s.evictions, s.evictedBytes);
+    if (cache->dir) textbuf_printf(out, "cache directory: %ld write(s), %ld error(s)\n", s.diskWrites, s.diskErrors);
+}
+
+/* ---- API ---- */
+
+ColangCache *colang_cache_create(size_t maxBytes, const char *dir) {
+    if (dir && make_dir(dir) != 0 && errno != EEXIST) {
+        fprintf(stderr, "Cannot create cache directory '%s': %s\n", dir, strerror(errno));
+        return NULL;
+    }
+    ColangCache *cache = xmalloc(sizeof(ColangCache));
+    memset(cache, 0, sizeof(*cache));
+    pthread_mutex_init(&cache->lock, NULL);
+    cache->bucketCount = 64;
+    cache->buckets = calloc(cache->bucketCount, sizeof(Entry *));
+    if (!cache->buckets) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    cache->stats.maxBytes = maxBytes;
+    if (dir) {
+        size_t n = strlen(dir);
+        cache->dir = xmalloc(n + 1);
+        memcpy(cache->dir, dir, n + 1);
+    }
+    return cache;
+}
+
+void colang_cache_free(ColangCache *cache) {
+    if (!cache) return;
+    Entry *older;
+    for (Entry *e = cache->newest; e; e = older) {
+        older = e->older;
+        free(e);
+    }
+    free(cache->buckets);
+    free(cache->dir);
+    pthread_mutex_destroy(&cache->lock);
+    free(cache);
+}
+
+void colang_cache_stats(ColangCache *cache, ColangCacheStats *stats) {
+    pthread_mutex_lock(&cache->lock);
+    *stats = cache->stats;
+    pthread_mutex_unlock(&cache->lock);
+}
@@ -0,0 +1,27 @@
+#ifndef CACHE_H
+#define CACHE_H
+
+#include "colang.h"
+#include "sha256.h"
+#include "textbuf.h"
+
+/* Inside of the libcolang result cache; the API is in colang.h */
+
+/* Texts a cached result carries, in this order */
+enum { CACHE_CONSOLE, CACHE_ASSEMBLY, CACHE_BINARY, CACHE_HEX, CACHE_TEXTS };
+
+/* SHA-256 over a format tag, every field of opts and the source */
+void cache_key(const ColangOptions *opts, const char *source, size_t len, unsigned char key[SHA256_SIZE]);
+
+/* On a hit, set result's status and counters, replace texts[] with the
+   cached texts and return 1. The timings are left to the caller. */
+int cache_lookup(ColangCache *cache, const unsigned char key[SHA256_SIZE],
+                 ColangResult *result, TextBuf *texts[CACHE_TEXTS]);
+
+/* Keep a copy of result and its texts under key */
+void cache_store(ColangCache *cache, const unsigned char key[SHA256_SIZE], const ColangResult *result);
+
+/* Counters, hit rate and memory use, one per line */
+void cache_report(ColangCache *cache, TextBuf *out);
+
+#endif
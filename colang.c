@@ -0,0 +1,239 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "colang.h"
+#include "compiler.h"
+#include "tac.h"
+#include "mips_sched.h"
+#include "mips_peephole.h"
+#include "vm.h"
+#include "jit.h"
+#include "peval.h"
+#include "native.h"
+#include "output.h"
+#include "textbuf.h"
+#include "cache.h"
+
+struct ColangContext {
+    Compiler *cc;
+    char *text;         // source copy the scanner works on in place
+    size_t textCap;
+    TextBuf console;
+    TextBuf assembly;
+    TextBuf binary;
+    TextBuf hex;
+    ColangCache *cache; // shared, not owned
+};
+
+ColangContext *colang_create(void) {
+    ColangContext *ctx = calloc(1, sizeof(ColangContext));
+    if (!ctx) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    ctx->cc = compiler_create();
+    textbuf_init(&ctx->console);
+    textbuf_init(&ctx->assembly);
+    textbuf_init(&ctx->binary);
+    textbuf_init(&ctx->hex);
+    return ctx;
+}
+
+void colang_free(ColangContext *ctx) {
+    if (!ctx) return;
+    compiler_free(ctx->cc);
+    free(ctx->text);
+    textbuf_free(&ctx->console);
+    textbuf_free(&ctx->assembly);
+    textbuf_free(&ctx->binary);
+    textbuf_free(&ctx->hex);
+    free(ctx);
+}
+
+void colang_set_cache(ColangContext *ctx, ColangCache *cache) {
+    ctx->cache = cache;
+}
+
+void colang_options_init(ColangOptions *opts) {
+    memset(opts, 0, sizeof(*opts));
+    opts->engine = COLANG_ENGINE_TAC;
+    opts->artifacts = COLANG_ARTIFACT_ALL;
+    opts->peephole = 1;
+    opts->schedule = 1;
+}
+
+const char *colang_status_name(ColangStatus status) {
+    switch (status) {
+        case COLANG_OK:             return "ok";
+        case COLANG_SYNTAX_ERROR:   return "syntax error";
+        case COLANG_SEMANTIC_ERROR: return "semantic error";
+        case COLANG_RUNTIME_ERROR:  return "runtime error";
+        case COLANG_LIMIT_EXCEEDED: return "limit exceeded";
+        default:                    return "unknown";
+    }
+}
+
+/* Copy the source with the two trailing NULs the scanner needs. The copy
+   is a whole number of 16-byte blocks, so the scanner's aligned vector
+   loads stay inside it rather than touching a neighbouring allocation. */
+static char *load_text(ColangContext *ctx, const char *source, size_t len) {
+    size_t need = (len + 2 + 15) & ~(size_t)15;
+    if (need > ctx->textCap) {
+        char *text = realloc(ctx->text, need);
+        if (!text) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        ctx->text = text;
+        ctx->textCap = need;
+    }
+    memcpy(ctx->text, source, len);
+    ctx->text[len] = '\0';
+    ctx->text[len + 1] = '\0';
+    return ctx->text;
+}
+
+static long count_instructions(const TACProgram *prog) {
+    long n = 0;
+    for (TACInstr *i = prog->head; i; i = i->next) n++;
+    return n;
+}
+
+/* Run on the chosen engine with console output captured into ctx */
+static int execute(ColangContext *ctx, TACProgram *prog, ColangEngine engine, int *errorLine) {
+    output_capture(1);
+    output_clear();
+
+    int status;
+    JITProgram *jit = engine == COLANG_ENGINE_JIT ? jit_compile(prog) : NULL;
+    if (jit) {
+        status = jit_execute(jit);
+        jit_free(jit);
+    } else if (engine == COLANG_ENGINE_VM) {
+        VMProgram *vm = vm_compile(prog);
+        status = vm_execute(vm);
+        vm_free(vm);
+    } else {
+        status = tac_evaluate(prog);
+        if (status && prog->fault) *errorLine = prog->fault->line;
+    }
+
+    size_t len;
+    const char *out = output_buffer(&len);
+    textbuf_append(&ctx->console, out, len);
+    output_capture(0);
+    return status;
+}
+
+static void set_text(ColangText *t, const TextBuf *b) {
+    t->data = b->data ? b->data : "";
+    t->len = b->len;
+}
+
+static ColangStatus finish(ColangContext *ctx, ColangResult *result, ColangStatus status) {
+    result->status = status;
+    set_text(&result->console, &ctx->console);
+    set_text(&result->assembly, &ctx->assembly);
+    set_text(&result->binary, &ctx->binary);
+    set_text(&result->hex, &ctx->hex);
+    return status;
+}
+
+/* Same pipeline as main: parse, symbol table, semantics, TAC, run */
+static ColangStatus compile_and_run(ColangContext *ctx, const char *source, size_t len,
+                                    const ColangOptions *opts, ColangResult *result) {
+    Compiler *cc = ctx->cc;
+    double start = native_now_ms();
+    int parsed = compiler_parse(cc, load_text(ctx, source, len), len);
+    result->errorCount = cc->errorCount;
+    if (parsed != 0 || !cc->root) {
+        if (!result->errorCount) result->errorCount = 1;
+        return finish(ctx, result, COLANG_SYNTAX_ERROR);
+    }
+    if (cc->errorCount > 0) return finish(ctx, result, COLANG_SYNTAX_ERROR);
+
+    ast_build_symbol_table(&cc->symbols, cc->root, &cc->errorCount);
+    if (cc->errorCount > 0 || Semantic_analysis(cc) != 0) {
+        result->errorCount = cc->errorCount > 0 ? cc->errorCount : 1;
+        return finish(ctx, result, COLANG_SEMANTIC_ERROR);
+    }
+
+    TACProgram *tac = tac_generate(cc->root, &cc->symbols);
+    compute_symbol_offsets(&cc->symbols);
+    result->instructions = count_instructions(tac);
+    if (opts->maxInstructions && result->instructions > opts->maxInstructions) {
+        tac_free(tac);
+        result->limit = COLANG_LIMIT_INSTRUCTIONS;
+        return finish(ctx, result, COLANG_LIMIT_EXCEEDED);
+    }
+    if (opts->peval) {
+        TACProgram *residual = tac_partial_eval(tac, opts->pevalVars);
+        tac_free(tac);
+        tac = residual;
+    }
+    result->compileMs = native_now_ms() - start;
+
+    start = native_now_ms();
+    int failed = execute(ctx, tac, opts->engine, &result->errorLine);
+    result->runMs = native_now_ms() - start;
+
+    ColangStatus status = COLANG_OK;
+    if (opts->maxOutputBytes && ctx->console.len > opts->maxOutputBytes) {
+        ctx->console.len = opts->maxOutputBytes;
+        ctx->console.data[ctx->console.len] = '\0';
+        result->limit = COLANG_LIMIT_OUTPUT;
+        status = COLANG_LIMIT_EXCEEDED;
+    }
+    if (failed) {
+        tac_free(tac);
+        return finish(ctx, result, COLANG_RUNTIME_ERROR);
+    }
+
+    if (opts->artifacts & COLANG_ARTIFACT_ALL) {
+        MIPSCode *code = tac_assemble(tac);
+        if (opts->peephole) mips_peephole(code, NULL);
+        if (opts->schedule) mips_schedule(code);
+        tac_render_text(code,
+                        opts->artifacts & COLANG_ARTIFACT_ASSEMBLY ? &ctx->assembly : NULL,
+                        opts->artifacts & COLANG_ARTIFACT_BINARY ? &ctx->binary : NULL,
+                        opts->artifacts & COLANG_ARTIFACT_HEX ? &ctx->hex : NULL);
+        result->words = code->count;
+        mips_code_free(code);
+    }
+    tac_free(tac);
+    return finish(ctx, result, status);
+}
+
+ColangStatus colang_run(ColangContext *ctx, const char *source, size_t len,
+                        const ColangOptions *opts, ColangResult *result) {
+    ColangOptions defaults;
+    if (!opts) {
+        colang_options_init(&defaults);
+        opts = &defaults;
+    }
+    memset(result, 0, sizeof(*result));
+    textbuf_clear(&ctx->console);
+    textbuf_clear(&ctx->assembly);
+    textbuf_clear(&ctx->binary);
+    textbuf_clear(&ctx->hex);
+
+    if (opts->maxSourceBytes && len > opts->maxSourceBytes) {
+        result->limit = COLANG_LIMIT_SOURCE;
+        return finish(ctx, result, COLANG_LIMIT_EXCEEDED);
+    }
+    if (!ctx->cache) return compile_and_run(ctx, source, len, opts, result);
+
+    // A program seen before with the same options is replayed, not run
+    unsigned char key[SHA256_SIZE];
+    TextBuf *texts[CACHE_TEXTS] = { &ctx->console, &ctx->assembly, &ctx->binary, &ctx->hex };
+    double start = native_now_ms();
+    cache_key(opts, source, len, key);
+    if (cache_lookup(ctx->cache, key, result, texts)) {
+        result->cached = 1;
+        result->compileMs = native_now_ms() - start;
+        return finish(ctx, result, result->status);
+    }
+    compile_and_run(ctx, source, len, opts, result);
+    cache_store(ctx->cache, key, result);
+    return result->status;
+}
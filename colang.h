@@ -0,0 +1,131 @@
+#ifndef COLANG_H
+#define COLANG_H
+
+#include <stddef.h>
+
+/* libcolang: compile and run Colang programs in-process.
+
+   A ColangContext owns a compiler, the copy of the source it scans and
+   the result buffers. Reusing one context for request after request keeps
+   all of that memory, so a warm run allocates little beyond the AST and
+   TAC. A context is used by one thread at a time; separate contexts can
+   run on separate threads.
+
+   Compile errors are still reported on stderr as the command line
+   compiler reports them; the result carries the status and, for runtime
+   errors, the line. */
+
+typedef struct ColangContext ColangContext;
+
+typedef enum {
+    COLANG_ENGINE_TAC,      // tac_execute, the reference interpreter
+    COLANG_ENGINE_VM,
+    COLANG_ENGINE_JIT,      // falls back to tac_execute where there is no JIT
+} ColangEngine;
+
+/* Artifacts to produce after a successful run, as bit flags */
+#define COLANG_ARTIFACT_ASSEMBLY    0x1     // EduMIPS64 .data/.code listing
+#define COLANG_ARTIFACT_BINARY      0x2     // one 32-digit word per line
+#define COLANG_ARTIFACT_HEX         0x4     // one 0x%08X word per line
+#define COLANG_ARTIFACT_ALL         0x7
+
+typedef struct {
+    ColangEngine engine;
+    unsigned artifacts;
+    int peephole;           // MIPS peephole pass, on by default
+    int schedule;           // MIPS scheduler, on by default
+    int peval;              // partial evaluation before running
+    int pevalVars;          // ... also folding variables (--peval-vars)
+
+    /* Limits; 0 means none. Colang programs have no loops, so the number
+       of TAC instructions bounds the work a run does. */
+    size_t maxSourceBytes;
+    long maxInstructions;
+    size_t maxOutputBytes;  // console output beyond this is cut off
+} ColangOptions;
+
+typedef enum {
+    COLANG_OK,
+    COLANG_SYNTAX_ERROR,        // scanner or parser errors
+    COLANG_SEMANTIC_ERROR,      // symbol table or semantic check errors
+    COLANG_RUNTIME_ERROR,       // division by zero
+    COLANG_LIMIT_EXCEEDED,      // see limit in the result
+} ColangStatus;
+
+typedef enum {
+    COLANG_LIMIT_NONE,
+    COLANG_LIMIT_SOURCE,
+    COLANG_LIMIT_INSTRUCTIONS,
+    COLANG_LIMIT_OUTPUT,
+} ColangLimit;
+
+/* A buffer owned by the context: valid until its next run or free. data
+   is NUL-terminated and never NULL. */
+typedef struct {
+    const char *data;
+    size_t len;
+} ColangText;
+
+typedef struct {
+    ColangStatus status;
+    ColangLimit limit;
+    int errorLine;          // line of the runtime error, 0 when none is known
+    int errorCount;         // compile errors
+    long instructions;      // TAC instructions
+    int words;              // MIPS64 instruction words, when encoded
+    double compileMs;       // parse through TAC generation; the lookup when cached
+    double runMs;           // execution; 0 when cached
+    int cached;             // replayed from the result cache, nothing was run
+    ColangText console;     // what the program printed, even after a runtime error
+    ColangText assembly;
+    ColangText binary;
+    ColangText hex;
+} ColangResult;
+
+ColangContext *colang_create(void);
+void colang_free(ColangContext *ctx);
+
+/* Defaults: TAC engine, all artifacts, peephole and scheduling on, no
+   partial evaluation and no limits */
+void colang_options_init(ColangOptions *opts);
+
+/* Compile and run the len bytes at source (no NUL needed). opts may be
+   NULL for the defaults. Fills *result and returns its status. */
+ColangStatus colang_run(ColangContext *ctx, const char *source, size_t len,
+                        const ColangOptions *opts, ColangResult *result);
+
+const char *colang_status_name(ColangStatus status);
+
+/* Result cache, keyed by the SHA-256 of the source and every option, so
+   a resubmitted program gets its status, console output and artifacts
+   back without being parsed or run. Entries live in memory up to
+   maxBytes, least recently used first out; with a directory they are
+   also written there, one file per key, and read back on a memory miss
+   (the directory is never pruned). One cache can serve any number of
+   contexts on any threads. Compile errors are not repeated on stderr
+   for a cached result. */
+typedef struct ColangCache ColangCache;
+
+typedef struct {
+    long hits;              // served from memory
+    long diskHits;          // served from the directory
+    long misses;
+    long stores;            // results added to memory
+    long evictions;
+    size_t evictedBytes;
+    long entries;           // in memory now
+    size_t bytes;
+    size_t maxBytes;
+    long diskWrites;
+    long diskErrors;        // directory files that could not be written or read
+} ColangCacheStats;
+
+/* dir may be NULL for memory only. Returns NULL when dir cannot be used. */
+ColangCache *colang_cache_create(size_t maxBytes, const char *dir);
+void colang_cache_free(ColangCache *cache);
+void colang_cache_stats(ColangCache *cache, ColangCacheStats *stats);
+
+/* Look results up in cache (NULL: none) before every run of ctx */
+void colang_set_cache(ColangContext *ctx, ColangCache *cache);
+
+#endif
@@ -0,0 +1,57 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "compiler.h"
+
+Compiler *compiler_create(void) {
+    Compiler *cc = calloc(1, sizeof(Compiler));
+    if (!cc) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    symtab_init(&cc->symbols);
+    cc->lineCount = 1;
+    return cc;
+}
+
+void compiler_reset(Compiler *cc) {
+    if (cc->root) ast_free(cc->root);
+    cc->root = NULL;
+    symtab_reset(&cc->symbols);
+    cc->errorCount = 0;
+    cc->lineCount = 1;
+    cc->declType = TYPE_NMBR;
+    cc->textCopies = 0;
+    cc->textBytes = 0;
+}
+
+void compiler_free(Compiler *cc) {
+    if (!cc) return;
+    if (cc->root) ast_free(cc->root);
+    symtab_free(&cc->symbols);
+    free(cc);
+}
+
+int compiler_parse(Compiler *cc, char *text, size_t size) {
+    compiler_reset(cc);
+    scanner_init(&cc->scanner, text, size);
+    return yyparse(cc);
+}
+
+int Semantic_analysis(Compiler *cc){
+    if(cc->debug) printf("\n=== Semantic Analysis ===\n\n");
+
+    if(cc->errorCount > 0){
+        if(cc->debug) printf("Skipping semantic analysis due to %d previous error(s).\n", cc->errorCount);
+        return 1;
+    }
+
+    int semantic_errors = 0;
+    if (ast_check_semantics(&cc->symbols, cc->root, &semantic_errors)) {
+        if(cc->debug) printf("Semantic analysis passed.\n");
+    } else {
+        if(cc->debug) printf("Semantic analysis failed with %d error(s).\n", semantic_errors);
+        if(cc->debug) printf("\n=== Compilation Failed ===\n");
+        return 1;
+    }
+    return 0;
+}
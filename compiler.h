@@ -0,0 +1,40 @@
+#ifndef COMPILER_H
+#define COMPILER_H
+
+#include <stddef.h>
+#include "ast.h"
+#include "symbol_table.h"
+#include "scanner.h"
+
+/* Front-end state of one compilation. The parser is pure and the scanner
+   keeps its position in here, so independent Compilers can parse on
+   separate threads at the same time. */
+typedef struct Compiler {
+    Scanner scanner;
+    SymbolTable symbols;    // names are interned here while parsing
+    ASTNode *root;
+    int errorCount;
+    int lineCount;          // line the parser is on, for diagnostics
+    VarType declType;       // type a comma-separated name inherits
+    int debug;              // print the AST, TAC and symbol table
+    long textCopies;        // string literal text copied into the AST
+    long textBytes;
+} Compiler;
+
+Compiler *compiler_create(void);
+
+/* Drop the AST and empty the symbol table so the Compiler can take the
+   next program; the tables' memory is kept */
+void compiler_reset(Compiler *cc);
+void compiler_free(Compiler *cc);
+
+/* Reset, then parse text into cc->root. text[size] and text[size + 1]
+   must be NUL; the text can be freed once this returns. Returns
+   yyparse's result. */
+int compiler_parse(Compiler *cc, char *text, size_t size);
+
+/* Check the parsed program against the symbol table built from it.
+   Returns 0 when it may be lowered, 1 after any error. */
+int Semantic_analysis(Compiler *cc);
+
+#endif
@@ -0,0 +1,149 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "intern.h"
+
+#define INTERN_CHUNK 65536
+#define INTERN_SLOTS 1024
+
+struct InternChunk {
+    InternChunk *next;
+    size_t size;
+    char *data;
+};
+
+/* Each atom's text is preceded by its header in the arena */
+typedef struct {
+    int slot;
+    int len;
+} AtomHeader;
+
+#define HEADER(atom)    ((AtomHeader *)((char *)(atom) - sizeof(AtomHeader)))
+
+static uint32_t hash_text(const char *text, size_t len) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        h ^= (unsigned char)text[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static void *intern_alloc(size_t size) {
+    void *p = calloc(1, size);
+    if (!p) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    return p;
+}
+
+void intern_init(InternTable *t) {
+    memset(t, 0, sizeof(*t));
+}
+
+void intern_reset(InternTable *t) {
+    if (t->chunks) {
+        while (t->chunks->next) {
+            InternChunk *next = t->chunks->next;
+            t->chunks->next = next->next;
+            t->arenaBytes -= (long)next->size;
+            free(next);
+        }
+    }
+    if (t->slots) memset(t->slots, 0, t->capacity * sizeof(Atom));
+    t->count = 0;
+    t->chunkUsed = 0;
+}
+
+void intern_free(InternTable *t) {
+    while (t->chunks) {
+        InternChunk *next = t->chunks->next;
+        free(t->chunks);
+        t->chunks = next;
+    }
+    free(t->slots);
+    intern_init(t);
+}
+
+/* Chunks are only freed by a reset, atoms stay valid until then */
+static Atom arena_store(InternTable *t, const char *text, size_t len) {
+    size_t need = (sizeof(AtomHeader) + len + 1 + sizeof(int) - 1) & ~(sizeof(int) - 1);
+    if (!t->chunks || t->chunkUsed + need > t->chunks->size) {
+        size_t size = need > INTERN_CHUNK ? need : INTERN_CHUNK;
+        InternChunk *c = intern_alloc(sizeof(InternChunk) + size);
+        c->size = size;
+        c->data = (char *)(c + 1);
+        c->next = t->chunks;
+        t->chunks = c;
+        t->chunkUsed = 0;
+        t->arenaBytes += (long)size;
+    }
+    AtomHeader *h = (AtomHeader *)(t->chunks->data + t->chunkUsed);
+    t->chunkUsed += need;
+    h->slot = 0;
+    h->len = (int)len;
+    char *out = (char *)(h + 1);
+    memcpy(out, text, len);
+    out[len] = '\0';
+    return out;
+}
+
+static void grow_table(InternTable *t) {
+    size_t newCap = t->capacity ? t->capacity * 2 : INTERN_SLOTS;
+    Atom *newSlots = intern_alloc(newCap * sizeof(Atom));
+    for (size_t i = 0; i < t->capacity; i++) {
+        Atom a = t->slots[i];
+        if (!a) continue;
+        size_t j = hash_text(a, (size_t)HEADER(a)->len) & (newCap - 1);
+        while (newSlots[j]) j = (j + 1) & (newCap - 1);
+        newSlots[j] = a;
+    }
+    free(t->slots);
+    t->slots = newSlots;
+    t->capacity = newCap;
+}
+
+/* Index of text's entry, or of the empty slot where it belongs */
+static size_t probe(const InternTable *t, const char *text, size_t len) {
+    size_t i = hash_text(text, len) & (t->capacity - 1);
+    while (t->slots[i]) {
+        Atom a = t->slots[i];
+        if ((size_t)HEADER(a)->len == len && memcmp(a, text, len) == 0) break;
+        i = (i + 1) & (t->capacity - 1);
+    }
+    return i;
+}
+
+Atom intern(InternTable *t, const char *text, size_t len) {
+    if ((t->count + 1) * 2 > t->capacity) grow_table(t);
+    size_t i = probe(t, text, len);
+    if (!t->slots[i]) {
+        t->slots[i] = arena_store(t, text, len);
+        t->count++;
+    }
+    return t->slots[i];
+}
+
+Atom intern_cstr(InternTable *t, const char *text) {
+    return intern(t, text, strlen(text));
+}
+
+Atom intern_find(const InternTable *t, const char *text) {
+    if (!t->capacity) return NULL;
+    return t->slots[probe(t, text, strlen(text))];
+}
+
+int atom_slot(Atom atom) {
+    return HEADER(atom)->slot;
+}
+
+void atom_set_slot(Atom atom, int slot) {
+    HEADER(atom)->slot = slot;
+}
+
+void intern_stats(const InternTable *t, long *atoms, long *bytes) {
+    *atoms = (long)t->count;
+    *bytes = t->arenaBytes;
+}
@@ -0,0 +1,39 @@
+#ifndef INTERN_H
+#define INTERN_H
+
+#include <stddef.h>
+
+/* Interned identifier text. Every distinct name has exactly one Atom per
+   table, so two atoms from the same table are equal iff the pointers are
+   equal. Atoms are NUL-terminated and live until the table is reset. */
+typedef const char *Atom;
+
+typedef struct InternChunk InternChunk;
+
+typedef struct {
+    Atom *slots;            // open addressing, power-of-two capacity
+    size_t capacity;
+    size_t count;
+    InternChunk *chunks;    // arena holding the atoms, newest first
+    size_t chunkUsed;
+    long arenaBytes;
+} InternTable;
+
+void intern_init(InternTable *t);
+/* Forget every atom but keep the first chunk and the slots for reuse */
+void intern_reset(InternTable *t);
+void intern_free(InternTable *t);
+
+Atom intern(InternTable *t, const char *text, size_t len);
+Atom intern_cstr(InternTable *t, const char *text);
+
+/* The atom for text if it was ever interned, else NULL; adds nothing */
+Atom intern_find(const InternTable *t, const char *text);
+
+/* Per-atom slot the symbol table keys on: symbol index + 1, 0 for none */
+int atom_slot(Atom atom);
+void atom_set_slot(Atom atom, int slot);
+
+void intern_stats(const InternTable *t, long *atoms, long *bytes);
+
+#endif
@@ -0,0 +1,326 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "jit.h"
+#include "output.h"
+
+#if JIT_SUPPORTED
+
+#include <sys/mman.h>
+
+/* Generated code: int fn(int *slots, unsigned char *tags).
+   rbx holds the slot base, r12 the flex tag base. */
+typedef int (*JITEntry)(int *slots, unsigned char *tags);
+
+typedef struct {
+    unsigned char *buf;
+    size_t len;
+    size_t cap;
+    size_t *failPatches;    // rel32 jumps to the shared error exit
+    int failCount;
+    int failCap;
+} JITBuffer;
+
+/* Runtime helpers called from generated code */
+static void jit_print_num(int v) { output_num(v); }
+static void jit_print_chr(int v) { output_chr(v); }
+static void jit_print_str(const char *s) { output_str(s); }
+
+static void jit_div_error(int line) {
+    output_flush();
+    fprintf(stderr, "Runtime error at line %d: Division by zero\n", line);
+}
+
+static void emit_byte(JITBuffer *b, unsigned char v) {
+    if (b->len >= b->cap) {
+        b->cap = b->cap ? b->cap * 2 : 4096;
+        b->buf = realloc(b->buf, b->cap);
+        if (!b->buf) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+    }
+    b->buf[b->len++] = v;
+}
+
+static void emit_bytes(JITBuffer *b, const char *bytes, int n) {
+    for (int i = 0; i < n; i++) emit_byte(b, (unsigned char)bytes[i]);
+}
+
+static void emit_u32(JITBuffer *b, uint32_t v) {
+    for (int i = 0; i < 4; i++) emit_byte(b, (unsigned char)(v >> (i * 8)));
+}
+
+static void emit_u64(JITBuffer *b, uint64_t v) {
+    for (int i = 0; i < 8; i++) emit_byte(b, (unsigned char)(v >> (i * 8)));
+}
+
+static void patch_u32(JITBuffer *b, size_t at, uint32_t v) {
+    for (int i = 0; i < 4; i++) b->buf[at + i] = (unsigned char)(v >> (i * 8));
+}
+
+/* <op> reg, [rbx + slot*4]; modrm reg field already in `modrm` (mod=10, rm=rbx) */
+static void emit_slot_op(JITBuffer *b, const char *opcode, int n, int modrm, int slot) {
+    emit_bytes(b, opcode, n);
+    emit_byte(b, (unsigned char)modrm);
+    emit_u32(b, (uint32_t)(slot * 4));
+}
+
+#define MODRM_EAX 0x83      // eax, [rbx+disp32]
+#define MODRM_ECX 0x8B      // ecx, [rbx+disp32]
+#define MODRM_EDI 0xBB      // edi, [rbx+disp32]
+
+static void load_eax(JITBuffer *b, int isImm, int v) {
+    if (isImm) {
+        emit_byte(b, 0xB8);                         // mov eax, imm32
+        emit_u32(b, (uint32_t)v);
+    } else {
+        emit_slot_op(b, "\x8B", 1, MODRM_EAX, v);   // mov eax, [slot]
+    }
+}
+
+static void store_eax(JITBuffer *b, int slot) {
+    emit_slot_op(b, "\x89", 1, MODRM_EAX, slot);    // mov [slot], eax
+}
+
+static void emit_call(JITBuffer *b, void *fn) {
+    emit_bytes(b, "\x48\xB8", 2);                   // mov rax, imm64
+    emit_u64(b, (uint64_t)(uintptr_t)fn);
+    emit_bytes(b, "\xFF\xD0", 2);                   // call rax
+}
+
+static void emit_tag(JITBuffer *b, int slot, int value) {
+    emit_bytes(b, "\x41\xC6\x84\x24", 4);           // mov byte [r12+disp32], imm8
+    emit_u32(b, (uint32_t)slot);
+    emit_byte(b, (unsigned char)value);
+}
+
+static void emit_trunc(JITBuffer *b, int slot) {
+    emit_slot_op(b, "\x0F\xBE", 2, MODRM_EAX, slot); // movsx eax, byte [slot]
+    store_eax(b, slot);
+}
+
+static void add_fail_patch(JITBuffer *b, size_t at) {
+    if (b->failCount >= b->failCap) {
+        b->failCap = b->failCap ? b->failCap * 2 : 16;
+        b->failPatches = realloc(b->failPatches, b->failCap * sizeof(size_t));
+        if (!b->failPatches) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+    }
+    b->failPatches[b->failCount++] = at;
+}
+
+/* eax = a <op> b for ADD/SUB/MUL; kind 0 = SS, 1 = SI, 2 = IS */
+static void emit_arith(JITBuffer *b, int base, const VMWord *pc) {
+    int kind = pc[0].i - base;
+    int d = pc[1].i, x = pc[2].i, y = pc[3].i;
+
+    load_eax(b, kind == 2, x);
+    if (kind == 1) {
+        switch (base) {
+            case VM_ADD_SS: emit_byte(b, 0x05); break;          // add eax, imm32
+            case VM_SUB_SS: emit_byte(b, 0x2D); break;          // sub eax, imm32
+            default:        emit_bytes(b, "\x69\xC0", 2); break; // imul eax, eax, imm32
+        }
+        emit_u32(b, (uint32_t)y);
+    } else {
+        switch (base) {
+            case VM_ADD_SS: emit_slot_op(b, "\x03", 1, MODRM_EAX, y); break;
+            case VM_SUB_SS: emit_slot_op(b, "\x2B", 1, MODRM_EAX, y); break;
+            default:        emit_slot_op(b, "\x0F\xAF", 2, MODRM_EAX, y); break;
+        }
+    }
+    store_eax(b, d);
+}
+
+static void emit_div(JITBuffer *b, const VMWord *pc) {
+    int kind = pc[0].i - VM_DIV_SS;
+    int d = pc[1].i, x = pc[2].i, y = pc[3].i, line = pc[4].i;
+
+    if (kind == 1) {
+        emit_byte(b, 0xB9);                         // mov ecx, imm32
+        emit_u32(b, (uint32_t)y);
+    } else {
+        emit_slot_op(b, "\x8B", 1, MODRM_ECX, y);   // mov ecx, [slot]
+    }
+    emit_bytes(b, "\x85\xC9", 2);                   // test ecx, ecx
+    emit_bytes(b, "\x75", 1);                       // jnz over the error path
+    size_t skip = b->len;
+    emit_byte(b, 0);
+    emit_byte(b, 0xBF);                             // mov edi, line
+    emit_u32(b, (uint32_t)line);
+    emit_call(b, (void *)jit_div_error);
+    emit_byte(b, 0xE9);                             // jmp fail
+    add_fail_patch(b, b->len);
+    emit_u32(b, 0);
+    b->buf[skip] = (unsigned char)(b->len - skip - 1);
+
+    load_eax(b, kind == 2, x);
+    emit_byte(b, 0x99);                             // cdq
+    emit_bytes(b, "\xF7\xF9", 2);                   // idiv ecx
+    store_eax(b, d);
+}
+
+static void translate(JITBuffer *b, const VMProgram *vm) {
+    emit_byte(b, 0x53);                             // push rbx
+    emit_bytes(b, "\x41\x54", 2);                   // push r12
+    emit_bytes(b, "\x41\x55", 2);                   // push r13 (keeps rsp 16-aligned)
+    emit_bytes(b, "\x48\x89\xFB", 3);               // mov rbx, rdi
+    emit_bytes(b, "\x49\x89\xF4", 3);               // mov r12, rsi
+
+    for (int i = 0; i < vm->count; i += vm_op_length[vm->code[i].i]) {
+        const VMWord *pc = &vm->code[i];
+        switch (pc[0].i) {
+            case VM_HALT:
+                break;
+            case VM_LOADI:
+                emit_slot_op(b, "\xC7", 1, 0x83, pc[1].i);  // mov dword [slot], imm32
+                emit_u32(b, (uint32_t)pc[2].i);
+                break;
+            case VM_MOV:
+                load_eax(b, 0, pc[2].i);
+                store_eax(b, pc[1].i);
+                break;
+            case VM_ADD_SS: case VM_ADD_SI: case VM_ADD_IS:
+                emit_arith(b, VM_ADD_SS, pc);
+                break;
+            case VM_SUB_SS: case VM_SUB_SI: case VM_SUB_IS:
+                emit_arith(b, VM_SUB_SS, pc);
+                break;
+            case VM_MUL_SS: case VM_MUL_SI: case VM_MUL_IS:
+                emit_arith(b, VM_MUL_SS, pc);
+                break;
+            case VM_DIV_SS: case VM_DIV_SI: case VM_DIV_IS:
+                emit_div(b, pc);
+                break;
+            case VM_TRUNC:
+                emit_trunc(b, pc[1].i);
+                break;
+            case VM_TAG_NUM:
+                emit_tag(b, pc[1].i, 0);
+                break;
+            case VM_TAG_CHR:
+                emit_trunc(b, pc[1].i);
+                emit_tag(b, pc[1].i, 1);
+                break;
+            case VM_PRINT_NUM:
+            case VM_PRINT_CHR:
+                emit_slot_op(b, "\x8B", 1, MODRM_EDI, pc[1].i);     // mov edi, [slot]
+                emit_call(b, pc[0].i == VM_PRINT_NUM ? (void *)jit_print_num : (void *)jit_print_chr);
+                break;
+            case VM_PRINT_NUM_I:
+            case VM_PRINT_CHR_I:
+                emit_byte(b, 0xBF);                                 // mov edi, imm32
+                emit_u32(b, (uint32_t)pc[1].i);
+                emit_call(b, pc[0].i == VM_PRINT_NUM_I ? (void *)jit_print_num : (void *)jit_print_chr);
+                break;
+            case VM_PRINT_STR:
+                emit_bytes(b, "\x48\xBF", 2);                       // mov rdi, imm64
+                emit_u64(b, (uint64_t)(uintptr_t)pc[1].str);
+                emit_call(b, (void *)jit_print_str);
+                break;
+        }
+    }
+
+    emit_bytes(b, "\x31\xC0", 2);                   // xor eax, eax
+    size_t epilogue = b->len;
+    emit_bytes(b, "\x41\x5D\x41\x5C\x5B\xC3", 6);   // pop r13; pop r12; pop rbx; ret
+
+    size_t fail = b->len;
+    emit_byte(b, 0xB8);                             // mov eax, 1
+    emit_u32(b, 1);
+    emit_byte(b, 0xE9);                             // jmp epilogue
+    emit_u32(b, (uint32_t)(epilogue - (b->len + 4)));
+
+    for (int i = 0; i < b->failCount; i++) {
+        size_t at = b->failPatches[i];
+        patch_u32(b, at, (uint32_t)(fail - (at + 4)));
+    }
+}
+
+JITProgram *jit_compile(TACProgram *prog) {
+    if (!prog || !prog->head) return NULL;
+
+    JITBuffer b;
+    memset(&b, 0, sizeof(b));
+    VMProgram *vm = vm_compile(prog);
+    translate(&b, vm);
+    free(b.failPatches);
+
+    /* Write, then flip the mapping to read+execute */
+    unsigned char *mem = mmap(NULL, b.len, PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) {
+        free(b.buf);
+        vm_free(vm);
+        return NULL;
+    }
+    memcpy(mem, b.buf, b.len);
+    free(b.buf);
+    if (mprotect(mem, b.len, PROT_READ | PROT_EXEC) != 0) {
+        munmap(mem, b.len);
+        vm_free(vm);
+        return NULL;
+    }
+
+    JITProgram *jit = malloc(sizeof(JITProgram));
+    if (!jit) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    jit->vm = vm;
+    jit->code = mem;
+    jit->size = b.len;
+    return jit;
+}
+
+int jit_execute(JITProgram *jit) {
+    VMProgram *vm = jit->vm;
+    int *slots = calloc(vm->slotCount, sizeof(int));
+    unsigned char *tags = calloc(vm->varCount > 0 ? vm->varCount : 1, 1);
+    if (!slots || !tags) {
+        fprintf(stderr, "Failed to allocate temp storage\n");
+        free(slots);
+        free(tags);
+        return 1;
+    }
+    vm_load_frame(vm, slots, tags);
+
+    JITEntry entry;
+    memcpy(&entry, &jit->code, sizeof(entry));
+    int status = entry(slots, tags);
+    output_flush();
+
+    vm_write_back(vm, slots, tags);
+    free(slots);
+    free(tags);
+    return status;
+}
+
+void jit_free(JITProgram *jit) {
+    if (!jit) return;
+    munmap(jit->code, jit->size);
+    vm_free(jit->vm);
+    free(jit);
+}
+
+#else
+
+JITProgram *jit_compile(TACProgram *prog) {
+    (void)prog;
+    return NULL;
+}
+
+int jit_execute(JITProgram *jit) {
+    (void)jit;
+    return 1;
+}
+
+void jit_free(JITProgram *jit) {
+    (void)jit;
+}
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef JIT_H
+#define JIT_H
+
+#include "tac.h"
+#include "vm.h"
+
+/* Native x86-64 code for a TACProgram, built from the VM's resolved
+   bytecode. Variables live in the same flat frame as the VM; printing
+   goes through small runtime helpers. Only Linux/x86-64 hosts can run
+   the generated code. */
+
+#if defined(__x86_64__) && defined(__linux__)
+#define JIT_SUPPORTED 1
+#else
+#define JIT_SUPPORTED 0
+#endif
+
+typedef struct {
+    VMProgram *vm;          // frame layout and store set
+    unsigned char *code;    // executable mapping
+    size_t size;
+} JITProgram;
+
+/* Returns NULL when the host can't run generated code; callers fall back
+   to tac_execute */
+JITProgram *jit_compile(TACProgram *prog);
+
+/* Same contract as tac_execute: 0 on success, 1 on a runtime error */
+int jit_execute(JITProgram *jit);
+
+void jit_free(JITProgram *jit);
+
+#endif
@@ -0,0 +1,325 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "symbol_table.h"
+#include "ast.h"
+#include "tac.h"
+#include "mips_elf.h"
+#include "mips_sim.h"
+#include "rv64_sim.h"
+#include "mips_sched.h"
+#include "mips_peephole.h"
+#include "vm.h"
+#include "jit.h"
+#include "c_backend.h"
+#include "x86_backend.h"
+#include "peval.h"
+#include "source.h"
+#include "scanner.h"
+#include "compiler.h"
+#include "colang.h"
+#include "server.h"
+#include "batch.h"
+#include "native.h"
+
+void print_symbol_table(SymbolTable *st) {
+    printf("\n=== Symbol Table after Execution ===\n\n");
+    printf("%-15s %-10s %-10s %-10s %s\n", "Name", "Type", "Offset", "Size", "Value");
+    printf("%-15s %-10s %-10s %-10s %s\n", "----", "----", "------", "----", "-----");
+    
+    for (int i = 0; i < st->count; i++) {
+        Symbol *s = &st->entries[i];
+        printf("%-15s %-10s %-10d %-10d ", 
+                s->name, 
+                type_to_string(s->type),
+                s->memOffset,
+                s->size);
+        
+        FlexType kind = get_runtime_type(s);
+        char c = VALUE_CHR(s->value);
+        if (kind == FLEX_NUMBER) {
+            printf("%d\n", VALUE_NUM(s->value));
+        } else if (kind == FLEX_CHAR) {
+            if (c >= 32 && c <= 126) {
+                printf("'%c'\n", c);
+            } else if (c == '\0') {
+                printf("'\\0' (null)\n");
+            } else {
+                printf("(ASCII %d)\n", (int)c);
+            }
+        } else {
+            printf("(uninitialized)\n");
+        }
+    }
+    printf("\n");
+}
+
+int main(int argc, char **argv) {
+    const char *elf_path = NULL;
+    const char *c_path = NULL;
+    const char *x86_path = NULL;
+    const char *rv64_path = NULL;
+    bool simulate = false;
+    bool forwarding = true;
+    bool schedule = true;
+    bool peephole = true;
+    bool peephole_stats = false;
+    bool use_vm = false;
+    bool use_jit = false;
+    bool peval = false;
+    bool peval_vars = false;
+    bool parse_stats = false;
+    const char *serve_path = NULL;
+    const char *load_path = NULL;
+    int workers = 0;
+    int clients = 4;
+    int requests = 1000;
+    const char *batch_in = NULL;
+    const char *batch_out = NULL;
+    int threads = 0;
+    bool scaling = false;
+    long cache_mb = -1;
+    const char *cache_dir = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--elf") == 0 && i + 1 < argc) {
+            elf_path = argv[++i];
+        } else if (strcmp(argv[i], "--emit-c") == 0 && i + 1 < argc) {
+            c_path = argv[++i];
+        } else if (strcmp(argv[i], "--x86") == 0 && i + 1 < argc) {
+            x86_path = argv[++i];
+        } else if (strcmp(argv[i], "--rv64") == 0 && i + 1 < argc) {
+            rv64_path = argv[++i];
+        } else if (strcmp(argv[i], "--sim") == 0) {
+            simulate = true;
+        } else if (strcmp(argv[i], "--no-forwarding") == 0) {
+            forwarding = false;
+        } else if (strcmp(argv[i], "--no-sched") == 0) {
+            schedule = false;
+        } else if (strcmp(argv[i], "--no-peephole") == 0) {
+            peephole = false;
+        } else if (strcmp(argv[i], "--peephole-stats") == 0) {
+            peephole_stats = true;
+        } else if (strcmp(argv[i], "--vm") == 0) {
+            use_vm = true;
+        } else if (strcmp(argv[i], "--jit") == 0) {
+            use_jit = true;
+        } else if (strcmp(argv[i], "--parse-stats") == 0) {
+            parse_stats = true;
+        } else if (strcmp(argv[i], "--peval") == 0) {
+            peval = true;
+        } else if (strcmp(argv[i], "--peval-vars") == 0) {
+            peval = true;
+            peval_vars = true;
+        } else if (strcmp(argv[i], "--readelf") == 0 && i + 1 < argc) {
+            return mips_elf_dump(argv[++i], stdout);
+        } else if (strcmp(argv[i], "--scan-bench") == 0) {
+            return scanner_bench(stdin, stdout);
+        } else if (strcmp(argv[i], "--serve") == 0 && i + 1 < argc) {
+            serve_path = argv[++i];
+        } else if (strcmp(argv[i], "--workers") == 0 && i + 1 < argc) {
+            workers = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--load-test") == 0 && i + 1 < argc) {
+            load_path = argv[++i];
+        } else if (strcmp(argv[i], "--clients") == 0 && i + 1 < argc) {
+            clients = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--requests") == 0 && i + 1 < argc) {
+            requests = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--batch") == 0 && i + 2 < argc) {
+            batch_in = argv[++i];
+            batch_out = argv[++i];
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--scaling") == 0) {
+            scaling = true;
+        } else if (strcmp(argv[i], "--cache-mb") == 0 && i + 1 < argc) {
+            cache_mb = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--cache-dir") == 0 && i + 1 < argc) {
+            cache_dir = argv[++i];
+        } else if (strcmp(argv[i], "--cache-stats") == 0 && i + 1 < argc) {
+            return server_cache_stats(argv[++i], stdout);
+        }
+    }
+
+    // The result cache is for the long-running drivers, --serve and --batch
+    ColangCache *cache = NULL;
+    if ((serve_path || batch_in) && (cache_mb >= 0 || cache_dir)) {
+        cache = colang_cache_create((size_t)(cache_mb >= 0 ? cache_mb : 64) << 20, cache_dir);
+        if (!cache) return 1;
+    }
+    if (serve_path) {
+        int status = server_run(serve_path, workers, cache, stdout);
+        colang_cache_free(cache);
+        return status;
+    }
+    if (batch_in) {
+        FILE *in = fopen(batch_in, "rb");
+        if (!in) {
+            fprintf(stderr, "Cannot open '%s'\n", batch_in);
+            return 1;
+        }
+        FILE *out = fopen(batch_out, "wb");
+        if (!out) {
+            fprintf(stderr, "Cannot create '%s'\n", batch_out);
+            fclose(in);
+            return 1;
+        }
+        ColangOptions opts;
+        colang_options_init(&opts);
+        opts.engine = use_jit ? COLANG_ENGINE_JIT : use_vm ? COLANG_ENGINE_VM : COLANG_ENGINE_TAC;
+        opts.artifacts = COLANG_ARTIFACT_HEX;   // encode, for the word count
+        opts.peephole = peephole;
+        opts.schedule = schedule;
+        opts.peval = peval;
+        opts.pevalVars = peval_vars;
+        int status = batch_run(in, out, &opts, threads, scaling, cache, stdout);
+        fclose(in);
+        fclose(out);
+        colang_cache_free(cache);
+        return status;
+    }
+    if (load_path) {
+        // The program on stdin is sent with the engine and pass flags given
+        uint32_t options = (use_jit ? COLANG_ENGINE_JIT : use_vm ? COLANG_ENGINE_VM : COLANG_ENGINE_TAC)
+                         | COLANG_ARTIFACT_ALL << SERVER_ARTIFACT_SHIFT
+                         | (peephole ? 0 : SERVER_NO_PEEPHOLE)
+                         | (schedule ? 0 : SERVER_NO_SCHEDULE)
+                         | (peval ? SERVER_PEVAL : 0)
+                         | (peval_vars ? SERVER_PEVAL_VARS : 0);
+        Source src;
+        if (source_load(stdin, &src) != 0) return 1;
+        int status = server_load_test(load_path, src.text, src.size, clients, requests, options, stdout);
+        source_free(&src);
+        return status;
+    }
+
+    double start = native_now_ms();
+    printf("console:\"");
+    Source src;
+    if (source_load(stdin, &src) != 0) {
+        printf("\",\n");
+        return 1;
+    }
+    size_t source_size = src.size;
+    bool source_mapped = src.mapSize != 0;
+    Compiler *cc = compiler_create();
+    int result = compiler_parse(cc, src.text, src.size);
+    source_free(&src);
+        
+    if (result != 0 || !cc->root) {
+        printf("\",\n");
+        compiler_free(cc);
+        return 1;
+    }
+    
+    if (cc->debug) ast_print(cc->root, 0);
+
+    //before semantic analysis, build symbol table for right sequence
+    if (cc->debug) printf("\n=== Building Symbol Table ===\n");
+    ast_build_symbol_table(&cc->symbols, cc->root, &cc->errorCount);
+    if (cc->errorCount > 0) {
+        if (cc->debug) printf("Symbol table construction failed with %d error(s).\n", cc->errorCount);
+        printf("\",\n");
+        compiler_free(cc);
+        return 1;
+    }
+
+    // semantic analysis 
+    int sem_result = Semantic_analysis(cc);
+    if(sem_result != 0){
+        printf("\",\n");
+        compiler_free(cc);
+        return 1;
+    }
+
+    TACProgram *tac = tac_generate(cc->root, &cc->symbols);
+    compute_symbol_offsets(&cc->symbols);
+    if (peval) {
+        TACProgram *residual = tac_partial_eval(tac, peval_vars);
+        tac_free(tac);
+        tac = residual;
+    }
+    
+    int result_execute;
+    int status = 0;
+    JITProgram *jit = use_jit ? jit_compile(tac) : NULL;
+    if (jit) {
+        result_execute = jit_execute(jit);
+        jit_free(jit);
+    } else if (use_vm) {
+        VMProgram *vm = vm_compile(tac);
+        result_execute = vm_execute(vm);
+        vm_free(vm);
+    } else {
+        result_execute = tac_execute(tac);
+    }
+    double elapsed = native_now_ms() - start;
+    printf("\nExecution Time: %.3f ms\n", elapsed);
+    printf("\",\n");
+
+    if(result_execute == 0){
+        if(cc->debug) {
+            printf("\n=== Three-Address Code ===\n\n");
+            tac_print(tac);
+            printf("Parse result: %d, root: %p, error_count: %d\n", result, (void*)cc->root, cc->errorCount);
+            print_symbol_table(&cc->symbols);
+        }
+        MIPSCode *code = tac_assemble(tac);
+        MIPSPeepholeStats peephole_counts = {{0}};
+        if (peephole) mips_peephole(code, &peephole_counts);
+        if (schedule) mips_schedule(code);
+        tac_render_assembly(code);
+        if (elf_path) {
+            if (mips_elf_write(elf_path, code) != 0 || mips_elf_verify(elf_path, code) != 0) {
+                fprintf(stderr, "ELF image verification failed for '%s'\n", elf_path);
+                status = 1;
+            }
+        }
+        if (c_path && c_backend_run(tac, c_path) != 0) {
+            status = 1;
+        }
+        if (x86_path) {
+            printf(",\nx86:\n\"");
+            if (x86_backend_run(tac, x86_path, stdout) != 0) status = 1;
+            printf("\"");
+        }
+        if (rv64_path) {
+            RV64Code *rv = rv64_assemble(tac);
+            RV64SimStats rv_stats;
+            rv64_write_listing(rv, rv64_path);
+            rv64_simulate(rv, &rv_stats);
+            printf(",\nrv64:\n\"");
+            rv64_sim_report(&rv_stats, code->count, stdout);
+            printf("\"");
+            rv64_code_free(rv);
+        }
+        if (simulate) {
+            MIPSSimStats stats;
+            mips_simulate(code, forwarding, &stats);
+            printf(",\nsimulation:\n\"");
+            mips_sim_report(&stats, stdout);
+            printf("\"");
+        }
+        if (peephole_stats) {
+            printf(",\npeephole:\n\"");
+            mips_peephole_report(&peephole_counts, stdout);
+            printf("\"");
+        }
+        mips_code_free(code);
+    }
+    if (parse_stats) {
+        long atoms, atomBytes;
+        intern_stats(&cc->symbols.names, &atoms, &atomBytes);
+        printf(",\nparse:\n\"");
+        printf("source: %zu bytes (%s)\n", source_size, source_mapped ? "mapped" : "read");
+        printf("token text copies: %ld (%ld bytes)\n", cc->textCopies, cc->textBytes);
+        printf("interned names: %ld (%ld bytes of arena)\n", atoms, atomBytes);
+        printf("\"");
+    }
+    
+    tac_free(tac);
+    compiler_free(cc);
+
+    return status;
+}
@@ -0,0 +1,111 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "mips.h"
+#include "symbol_table.h"
+
+MIPSCode *mips_code_create(void) {
+    MIPSCode *code = malloc(sizeof(MIPSCode));
+    if (!code) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    code->words = NULL;
+    code->count = 0;
+    code->capacity = 0;
+    code->symbols = NULL;
+    return code;
+}
+
+void mips_code_append(MIPSCode *code, uint32_t word) {
+    if (code->count >= code->capacity) {
+        int newCap = code->capacity == 0 ? 64 : code->capacity * 2;
+        code->words = realloc(code->words, newCap * sizeof(uint32_t));
+        if (!code->words) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        code->capacity = newCap;
+    }
+    code->words[code->count++] = word;
+}
+
+void mips_code_free(MIPSCode *code) {
+    if (!code) return;
+    free(code->words);
+    free(code);
+}
+
+unsigned char *mips_data_image(const MIPSCode *code, int *size) {
+    SymbolTable *st = code->symbols;
+    int total = 0;
+    for (int i = 0; i < st->count; i++) {
+        if (st->entries[i].memOffset + st->entries[i].size > total)
+            total = st->entries[i].memOffset + st->entries[i].size;
+    }
+    
+    unsigned char *image = calloc(total > 0 ? total : 1, 1);
+    if (!image) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    
+    for (int i = 0; i < st->count; i++) {
+        Symbol *s = &st->entries[i];
+        if (!s->hasInitValue || s->memOffset < 0) continue;
+        unsigned char *p = image + s->memOffset;
+        uint32_t v = (uint32_t)s->initValue;
+        if (s->type == TYPE_CHR) {
+            p[0] = (unsigned char)v;
+        } else {
+            p[0] = (unsigned char)(v >> 24);
+            p[1] = (unsigned char)(v >> 16);
+            p[2] = (unsigned char)(v >> 8);
+            p[3] = (unsigned char)v;
+        }
+    }
+    
+    *size = total;
+    return image;
+}
+
+static const char *mem_mnemonic(int opcode) {
+    switch (opcode) {
+        case OPCODE_LB: return "lb";
+        case OPCODE_SB: return "sb";
+        case OPCODE_LW: return "lw";
+        case OPCODE_SW: return "sw";
+        case OPCODE_LD: return "ld";
+        case OPCODE_SD: return "sd";
+        default:        return NULL;
+    }
+}
+
+char *mips_disassemble(uint32_t word, char *buf, int size) {
+    int opcode = MIPS_OPCODE(word);
+    int rs = MIPS_RS(word), rt = MIPS_RT(word), rd = MIPS_RD(word);
+
+    if (opcode == OPCODE_SPECIAL) {
+        switch (MIPS_FUNCT(word)) {
+            case FUNCT_DADDU: snprintf(buf, size, "daddu r%d, r%d, r%d", rd, rs, rt); return buf;
+            case FUNCT_DSUBU: snprintf(buf, size, "dsubu r%d, r%d, r%d", rd, rs, rt); return buf;
+            case FUNCT_DMULT: snprintf(buf, size, "dmult r%d, r%d", rs, rt); return buf;
+            case FUNCT_DDIV:  snprintf(buf, size, "ddiv r%d, r%d", rs, rt); return buf;
+            case FUNCT_MFLO:  snprintf(buf, size, "mflo r%d", rd); return buf;
+            case FUNCT_ADDU:  snprintf(buf, size, "addu r%d, r%d, r%d", rd, rs, rt); return buf;
+            case FUNCT_SUBU:  snprintf(buf, size, "subu r%d, r%d, r%d", rd, rs, rt); return buf;
+            case FUNCT_MULT:  snprintf(buf, size, "mult r%d, r%d", rs, rt); return buf;
+            case FUNCT_DIV:   snprintf(buf, size, "div r%d, r%d", rs, rt); return buf;
+            default: break;
+        }
+    } else if (opcode == OPCODE_DADDIU || opcode == OPCODE_ADDIU) {
+        snprintf(buf, size, "%s r%d, r%d, %d",
+                 opcode == OPCODE_DADDIU ? "daddiu" : "addiu", rt, rs, MIPS_IMM(word));
+        return buf;
+    } else if (mem_mnemonic(opcode)) {
+        snprintf(buf, size, "%s r%d, %d(r%d)", mem_mnemonic(opcode), rt, MIPS_IMM(word), rs);
+        return buf;
+    }
+
+    snprintf(buf, size, ".word32 0x%08X", word);
+    return buf;
+}
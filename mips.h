@@ -0,0 +1,67 @@
+#ifndef MIPS_H
+#define MIPS_H
+
+#include <stdint.h>
+#include "symbol_table.h"
+
+/* MIPS64 Opcodes and Function Codes */
+#define OPCODE_SPECIAL  0x00
+#define OPCODE_DADDIU   0x19
+#define OPCODE_LD       0x37
+#define OPCODE_SD       0x3F
+
+/* Function codes for R-format instructions */
+#define FUNCT_DADDU     0x2D
+#define FUNCT_DSUBU     0x2F
+#define FUNCT_DMULT     0x1C
+#define FUNCT_DDIV      0x1E
+#define FUNCT_MFLO      0x12
+/* 32-bit forms: on MIPS64 they sign-extend their result, which is the
+   interpreter's wrapping int arithmetic */
+#define FUNCT_ADDU      0x21
+#define FUNCT_SUBU      0x23
+#define FUNCT_MULT      0x18
+#define FUNCT_DIV       0x1A
+
+#define OPCODE_LB       0x20   // Load byte
+#define OPCODE_SB       0x28   // Store byte
+#define OPCODE_LW       0x23   // Load word
+#define OPCODE_SW       0x2B   // Store word
+#define OPCODE_ADDIU    0x09   // Add immediate unsigned (32-bit)
+
+/* Pipeline latency model (cycles from EX until a consumer can use the
+   result, with forwarding). Shared by the simulator and the scheduler. */
+#define MIPS_LATENCY_ALU    1
+#define MIPS_LATENCY_LOAD   2
+#define MIPS_LATENCY_MULT   4
+#define MIPS_LATENCY_DIV    12
+
+/* Field extraction */
+#define MIPS_OPCODE(w)  (((w) >> 26) & 0x3F)
+#define MIPS_RS(w)      (((w) >> 21) & 0x1F)
+#define MIPS_RT(w)      (((w) >> 16) & 0x1F)
+#define MIPS_RD(w)      (((w) >> 11) & 0x1F)
+#define MIPS_FUNCT(w)   ((w) & 0x3F)
+#define MIPS_IMM(w)     ((int16_t)((w) & 0xFFFF))
+
+/* Encoded instruction stream produced by the backend.
+   This is the single source of truth: the textual listing, the hex/binary
+   dumps and the ELF image are all rendered from these words. */
+typedef struct {
+    uint32_t *words;
+    int count;
+    int capacity;
+    SymbolTable *symbols;   // variables .data is laid out from
+} MIPSCode;
+
+MIPSCode *mips_code_create(void);
+void mips_code_append(MIPSCode *code, uint32_t word);
+void mips_code_free(MIPSCode *code);
+
+/* Initial contents of .data (big-endian), built from the symbol table */
+unsigned char *mips_data_image(const MIPSCode *code, int *size);
+
+/* Render one instruction in EduMIPS64 syntax, returns buf */
+char *mips_disassemble(uint32_t word, char *buf, int size);
+
+#endif
@@ -0,0 +1,521 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "mips_elf.h"
+#include "symbol_table.h"
+
+/* ELF64 constants (kept local so the writer does not depend on <elf.h>) */
+#define EI_NIDENT        16
+#define ELFCLASS64       2
+#define ELFDATA2MSB      2
+#define EV_CURRENT       1
+#define ET_EXEC          2
+#define EM_MIPS          8
+#define EF_MIPS_ARCH_64  0x60000000u
+
+#define PT_LOAD          1
+#define PF_X             0x1
+#define PF_W             0x2
+#define PF_R             0x4
+
+#define SHT_NULL         0
+#define SHT_PROGBITS     1
+#define SHT_SYMTAB       2
+#define SHT_STRTAB       3
+
+#define SHF_WRITE        0x1
+#define SHF_ALLOC        0x2
+#define SHF_EXECINSTR    0x4
+
+#define STB_LOCAL        0
+#define STB_GLOBAL       1
+#define STT_OBJECT       1
+#define STT_FUNC         2
+
+#define EHDR_SIZE        64
+#define PHDR_SIZE        56
+#define SHDR_SIZE        64
+#define SYM_SIZE         24
+
+/* Load address of .data: the code's variable offsets are absolute */
+#define DATA_ADDR        0
+
+/* Program headers, one PT_LOAD per allocated section */
+enum { SEG_TEXT, SEG_DATA, SEG_COUNT };
+
+/* Section header indices, in file order */
+enum {
+    SEC_NULL,
+    SEC_TEXT,
+    SEC_DATA,
+    SEC_SYMTAB,
+    SEC_STRTAB,
+    SEC_SHSTRTAB,
+    SEC_COUNT
+};
+
+static const char *section_names[SEC_COUNT] = {
+    "", ".text", ".data", ".symtab", ".strtab", ".shstrtab"
+};
+
+/* Growable byte buffer for everything except .text */
+typedef struct {
+    unsigned char *data;
+    size_t len;
+    size_t cap;
+} ByteBuf;
+
+static void bb_reserve(ByteBuf *b, size_t extra) {
+    if (b->len + extra <= b->cap) return;
+    size_t newCap = b->cap == 0 ? 256 : b->cap;
+    while (newCap < b->len + extra) newCap *= 2;
+    b->data = realloc(b->data, newCap);
+    if (!b->data) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    b->cap = newCap;
+}
+
+static void bb_put8(ByteBuf *b, uint8_t v) {
+    bb_reserve(b, 1);
+    b->data[b->len++] = v;
+}
+
+static void bb_put16(ByteBuf *b, uint16_t v) {
+    bb_put8(b, (uint8_t)(v >> 8));
+    bb_put8(b, (uint8_t)v);
+}
+
+static void bb_put32(ByteBuf *b, uint32_t v) {
+    bb_put16(b, (uint16_t)(v >> 16));
+    bb_put16(b, (uint16_t)v);
+}
+
+static void bb_put64(ByteBuf *b, uint64_t v) {
+    bb_put32(b, (uint32_t)(v >> 32));
+    bb_put32(b, (uint32_t)v);
+}
+
+static void bb_bytes(ByteBuf *b, const void *src, size_t n) {
+    bb_reserve(b, n);
+    memcpy(b->data + b->len, src, n);
+    b->len += n;
+}
+
+static void bb_align(ByteBuf *b, size_t base, size_t align) {
+    while ((base + b->len) % align) bb_put8(b, 0);
+}
+
+static uint16_t get16(const unsigned char *p) { return (uint16_t)(p[0] << 8 | p[1]); }
+static uint32_t get32(const unsigned char *p) { return (uint32_t)get16(p) << 16 | get16(p + 2); }
+static uint64_t get64(const unsigned char *p) { return (uint64_t)get32(p) << 32 | get32(p + 4); }
+
+static int host_is_big_endian(void) {
+    uint16_t probe = 1;
+    return *(unsigned char *)&probe == 0;
+}
+
+/* Swap the code buffer between host order and big-endian in place */
+static void swap_words(MIPSCode *code) {
+    for (int i = 0; i < code->count; i++) {
+        uint32_t w = code->words[i];
+        code->words[i] = (w >> 24) | ((w >> 8) & 0xFF00) | ((w << 8) & 0xFF0000) | (w << 24);
+    }
+}
+
+static void put_sym(ByteBuf *b, uint32_t name, int bind, int type, uint16_t shndx,
+                    uint64_t value, uint64_t size) {
+    bb_put32(b, name);
+    bb_put8(b, (uint8_t)((bind << 4) | type));
+    bb_put8(b, 0);
+    bb_put16(b, shndx);
+    bb_put64(b, value);
+    bb_put64(b, size);
+}
+
+static void put_phdr(ByteBuf *b, uint32_t flags, uint64_t offset, uint64_t addr,
+                     uint64_t size, uint64_t align) {
+    bb_put32(b, PT_LOAD);
+    bb_put32(b, flags);
+    bb_put64(b, offset);
+    bb_put64(b, addr);          /* p_vaddr */
+    bb_put64(b, addr);          /* p_paddr */
+    bb_put64(b, size);          /* p_filesz */
+    bb_put64(b, size);          /* p_memsz */
+    bb_put64(b, align);
+}
+
+static void put_shdr(ByteBuf *b, uint32_t name, uint32_t type, uint64_t flags, uint64_t addr,
+                     uint64_t offset, uint64_t size, uint32_t link, uint32_t info,
+                     uint64_t align, uint64_t entsize) {
+    bb_put32(b, name);
+    bb_put32(b, type);
+    bb_put64(b, flags);
+    bb_put64(b, addr);
+    bb_put64(b, offset);
+    bb_put64(b, size);
+    bb_put32(b, link);
+    bb_put32(b, info);
+    bb_put64(b, align);
+    bb_put64(b, entsize);
+}
+
+int mips_elf_write(const char *path, MIPSCode *code) {
+    uint64_t textOff = EHDR_SIZE + SEG_COUNT * PHDR_SIZE;
+    uint64_t textSize = (uint64_t)code->count * 4;
+    uint64_t tailBase = textOff + textSize;
+
+    /* String tables */
+    ByteBuf strtab = {0}, shstrtab = {0};
+    uint32_t shname[SEC_COUNT];
+    for (int i = 0; i < SEC_COUNT; i++) {
+        shname[i] = (uint32_t)shstrtab.len;
+        bb_bytes(&shstrtab, section_names[i], strlen(section_names[i]) + 1);
+    }
+    bb_put8(&strtab, 0);
+
+    /* Everything after .text goes into one buffer */
+    ByteBuf tail = {0};
+
+    bb_align(&tail, tailBase, 8);
+    uint64_t dataOff = tailBase + tail.len;
+    int imageSize;
+    unsigned char *image = mips_data_image(code, &imageSize);
+    uint64_t dataLen = (uint64_t)imageSize;
+    bb_bytes(&tail, image, (size_t)imageSize);
+    free(image);
+
+    /* Variables are local data objects; the entry point is the only global */
+    bb_align(&tail, tailBase, 8);
+    uint64_t symOff = tailBase + tail.len;
+    put_sym(&tail, 0, 0, 0, 0, 0, 0);
+    for (int i = 0; i < code->symbols->count; i++) {
+        uint32_t name = (uint32_t)strtab.len;
+        bb_bytes(&strtab, code->symbols->entries[i].name, strlen(code->symbols->entries[i].name) + 1);
+        put_sym(&tail, name, STB_LOCAL, STT_OBJECT, SEC_DATA,
+                (uint64_t)code->symbols->entries[i].memOffset, (uint64_t)code->symbols->entries[i].size);
+    }
+    uint32_t firstGlobal = (uint32_t)code->symbols->count + 1;
+    uint32_t startName = (uint32_t)strtab.len;
+    bb_bytes(&strtab, "_start", 7);
+    put_sym(&tail, startName, STB_GLOBAL, STT_FUNC, SEC_TEXT, MIPS_ELF_TEXT_ADDR, textSize);
+    uint64_t symSize = tailBase + tail.len - symOff;
+
+    uint64_t strOff = tailBase + tail.len;
+    bb_bytes(&tail, strtab.data, strtab.len);
+    uint64_t shstrOff = tailBase + tail.len;
+    bb_bytes(&tail, shstrtab.data, shstrtab.len);
+
+    bb_align(&tail, tailBase, 8);
+    uint64_t shOff = tailBase + tail.len;
+    put_shdr(&tail, shname[SEC_NULL], SHT_NULL, 0, 0, 0, 0, 0, 0, 0, 0);
+    put_shdr(&tail, shname[SEC_TEXT], SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR, MIPS_ELF_TEXT_ADDR,
+             textOff, textSize, 0, 0, 4, 0);
+    put_shdr(&tail, shname[SEC_DATA], SHT_PROGBITS, SHF_ALLOC | SHF_WRITE, DATA_ADDR,
+             dataOff, dataLen, 0, 0, 8, 0);
+    put_shdr(&tail, shname[SEC_SYMTAB], SHT_SYMTAB, 0, 0,
+             symOff, symSize, SEC_STRTAB, firstGlobal, 8, SYM_SIZE);
+    put_shdr(&tail, shname[SEC_STRTAB], SHT_STRTAB, 0, 0,
+             strOff, strtab.len, 0, 0, 1, 0);
+    put_shdr(&tail, shname[SEC_SHSTRTAB], SHT_STRTAB, 0, 0,
+             shstrOff, shstrtab.len, 0, 0, 1, 0);
+
+    /* ELF header */
+    ByteBuf ehdr = {0};
+    static const unsigned char ident[EI_NIDENT] = {
+        0x7F, 'E', 'L', 'F', ELFCLASS64, ELFDATA2MSB, EV_CURRENT, 0
+    };
+    bb_bytes(&ehdr, ident, EI_NIDENT);
+    bb_put16(&ehdr, ET_EXEC);
+    bb_put16(&ehdr, EM_MIPS);
+    bb_put32(&ehdr, EV_CURRENT);
+    bb_put64(&ehdr, MIPS_ELF_TEXT_ADDR);
+    bb_put64(&ehdr, EHDR_SIZE);     /* e_phoff */
+    bb_put64(&ehdr, shOff);
+    bb_put32(&ehdr, EF_MIPS_ARCH_64);
+    bb_put16(&ehdr, EHDR_SIZE);
+    bb_put16(&ehdr, PHDR_SIZE);
+    bb_put16(&ehdr, SEG_COUNT);
+    bb_put16(&ehdr, SHDR_SIZE);
+    bb_put16(&ehdr, SEC_COUNT);
+    bb_put16(&ehdr, SEC_SHSTRTAB);
+    put_phdr(&ehdr, PF_R | PF_X, textOff, MIPS_ELF_TEXT_ADDR, textSize, 4);
+    put_phdr(&ehdr, PF_R | PF_W, dataOff, DATA_ADDR, dataLen, 8);
+
+    int status = 0;
+    FILE *fp = fopen(path, "wb");
+    if (!fp) {
+        fprintf(stderr, "Cannot open '%s' for writing\n", path);
+        status = 1;
+    } else {
+        /* .text is written straight out of the instruction buffer; on
+           little-endian hosts the words are swapped in place and back */
+        int swap = !host_is_big_endian();
+        if (swap) swap_words(code);
+        if (fwrite(ehdr.data, 1, ehdr.len, fp) != ehdr.len ||
+            fwrite(code->words, 4, (size_t)code->count, fp) != (size_t)code->count ||
+            fwrite(tail.data, 1, tail.len, fp) != tail.len) {
+            fprintf(stderr, "Failed writing '%s'\n", path);
+            status = 1;
+        }
+        if (swap) swap_words(code);
+        fclose(fp);
+    }
+
+    free(ehdr.data);
+    free(tail.data);
+    free(strtab.data);
+    free(shstrtab.data);
+    return status;
+}
+
+/* ---- Reader ---- */
+
+typedef struct {
+    uint32_t name;
+    uint32_t type;
+    uint64_t flags;
+    uint64_t addr;
+    uint64_t offset;
+    uint64_t size;
+    uint32_t link;
+    uint32_t info;
+    uint64_t entsize;
+} ElfSection;
+
+typedef struct {
+    unsigned char *data;
+    size_t size;
+    uint64_t entry;
+    int shnum;
+    int shstrndx;
+    ElfSection *sections;
+} ElfFile;
+
+static void elf_close(ElfFile *elf) {
+    free(elf->data);
+    free(elf->sections);
+}
+
+static int elf_open(const char *path, ElfFile *elf) {
+    memset(elf, 0, sizeof(*elf));
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
+        fprintf(stderr, "Cannot open '%s'\n", path);
+        return 1;
+    }
+    fseek(fp, 0, SEEK_END);
+    long len = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    if (len < EHDR_SIZE) {
+        fprintf(stderr, "%s: file too small for an ELF header\n", path);
+        fclose(fp);
+        return 1;
+    }
+    elf->size = (size_t)len;
+    elf->data = malloc(elf->size);
+    if (!elf->data || fread(elf->data, 1, elf->size, fp) != elf->size) {
+        fprintf(stderr, "%s: read failed\n", path);
+        fclose(fp);
+        elf_close(elf);
+        return 1;
+    }
+    fclose(fp);
+
+    const unsigned char *h = elf->data;
+    if (memcmp(h, "\177ELF", 4) != 0 || h[4] != ELFCLASS64 || h[5] != ELFDATA2MSB) {
+        fprintf(stderr, "%s: not an ELF64 big-endian file\n", path);
+        elf_close(elf);
+        return 1;
+    }
+    if (get16(h + 16) != ET_EXEC || get16(h + 18) != EM_MIPS) {
+        fprintf(stderr, "%s: not a MIPS executable image\n", path);
+        elf_close(elf);
+        return 1;
+    }
+    elf->entry = get64(h + 24);
+
+    uint64_t shoff = get64(h + 40);
+    elf->shnum = get16(h + 60);
+    elf->shstrndx = get16(h + 62);
+    if (get16(h + 58) != SHDR_SIZE || shoff + (uint64_t)elf->shnum * SHDR_SIZE > elf->size ||
+        elf->shstrndx >= elf->shnum) {
+        fprintf(stderr, "%s: bad section header table\n", path);
+        elf_close(elf);
+        return 1;
+    }
+
+    elf->sections = calloc(elf->shnum, sizeof(ElfSection));
+    for (int i = 0; i < elf->shnum; i++) {
+        const unsigned char *p = elf->data + shoff + (uint64_t)i * SHDR_SIZE;
+        ElfSection *s = &elf->sections[i];
+        s->name = get32(p);
+        s->type = get32(p + 4);
+        s->flags = get64(p + 8);
+        s->addr = get64(p + 16);
+        s->offset = get64(p + 24);
+        s->size = get64(p + 32);
+        s->link = get32(p + 40);
+        s->info = get32(p + 44);
+        s->entsize = get64(p + 56);
+        if (s->type != SHT_NULL && s->offset + s->size > elf->size) {
+            fprintf(stderr, "%s: section %d extends past end of file\n", path, i);
+            elf_close(elf);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Bounds-checked string from a string table section */
+static const char *elf_string(const ElfFile *elf, int strndx, uint32_t off) {
+    if (strndx <= 0 || strndx >= elf->shnum) return "";
+    const ElfSection *s = &elf->sections[strndx];
+    if (off >= s->size) return "";
+    const char *str = (const char *)elf->data + s->offset + off;
+    if (!memchr(str, '\0', s->size - off)) return "";
+    return str;
+}
+
+static int elf_find_section(const ElfFile *elf, const char *name) {
+    for (int i = 1; i < elf->shnum; i++) {
+        if (strcmp(elf_string(elf, elf->shstrndx, elf->sections[i].name), name) == 0)
+            return i;
+    }
+    return -1;
+}
+
+int mips_elf_verify(const char *path, const MIPSCode *code) {
+    ElfFile elf;
+    if (elf_open(path, &elf)) return 1;
+
+    int errors = 0;
+    int text = elf_find_section(&elf, ".text");
+    int data = elf_find_section(&elf, ".data");
+    int sym = elf_find_section(&elf, ".symtab");
+
+    if (text < 0 || data < 0 || sym < 0) {
+        fprintf(stderr, "%s: missing .text, .data or .symtab\n", path);
+        elf_close(&elf);
+        return 1;
+    }
+
+    /* Both sections at the addresses the code was generated for */
+    if (elf.entry != MIPS_ELF_TEXT_ADDR || elf.sections[text].addr != MIPS_ELF_TEXT_ADDR ||
+        elf.sections[data].addr != DATA_ADDR) {
+        fprintf(stderr, "%s: entry, .text or .data is not at its fixed address\n", path);
+        errors++;
+    }
+
+    /* .text must match the instruction buffer word for word */
+    const ElfSection *ts = &elf.sections[text];
+    if (ts->size != (uint64_t)code->count * 4) {
+        fprintf(stderr, "%s: .text has %llu bytes, expected %d\n", path,
+                (unsigned long long)ts->size, code->count * 4);
+        errors++;
+    } else {
+        for (int i = 0; i < code->count; i++) {
+            uint32_t w = get32(elf.data + ts->offset + (uint64_t)i * 4);
+            if (w != code->words[i]) {
+                fprintf(stderr, "%s: .text word %d is 0x%08X, expected 0x%08X\n",
+                        path, i, w, code->words[i]);
+                errors++;
+            }
+        }
+    }
+
+    int imageSize;
+    unsigned char *image = mips_data_image(code, &imageSize);
+    if (elf.sections[data].size != (uint64_t)imageSize) {
+        fprintf(stderr, "%s: .data has %llu bytes, expected %d\n", path,
+                (unsigned long long)elf.sections[data].size, imageSize);
+        errors++;
+    } else if (memcmp(elf.data + elf.sections[data].offset, image, (size_t)imageSize) != 0) {
+        fprintf(stderr, "%s: .data contents differ from the initial values\n", path);
+        errors++;
+    }
+    free(image);
+
+    /* Every variable must be present with its offset and size */
+    const ElfSection *ss = &elf.sections[sym];
+    int nsyms = ss->entsize ? (int)(ss->size / ss->entsize) : 0;
+    for (int i = 0; i < code->symbols->count; i++) {
+        int found = 0;
+        for (int j = 1; j < nsyms; j++) {
+            const unsigned char *p = elf.data + ss->offset + (uint64_t)j * SYM_SIZE;
+            if (strcmp(elf_string(&elf, (int)ss->link, get32(p)), code->symbols->entries[i].name) != 0)
+                continue;
+            found = 1;
+            if (get16(p + 6) != data || get64(p + 8) != (uint64_t)code->symbols->entries[i].memOffset ||
+                get64(p + 16) != (uint64_t)code->symbols->entries[i].size) {
+                fprintf(stderr, "%s: symbol '%s' has wrong section, value or size\n",
+                        path, code->symbols->entries[i].name);
+                errors++;
+            }
+            break;
+        }
+        if (!found) {
+            fprintf(stderr, "%s: symbol '%s' missing\n", path, code->symbols->entries[i].name);
+            errors++;
+        }
+    }
+
+    elf_close(&elf);
+    return errors;
+}
+
+static const char *section_type_name(uint32_t type) {
+    switch (type) {
+        case SHT_NULL:     return "NULL";
+        case SHT_PROGBITS: return "PROGBITS";
+        case SHT_SYMTAB:   return "SYMTAB";
+        case SHT_STRTAB:   return "STRTAB";
+        default:           return "?";
+    }
+}
+
+int mips_elf_dump(const char *path, FILE *out) {
+    ElfFile elf;
+    if (elf_open(path, &elf)) return 1;
+
+    fprintf(out, "ELF64 big-endian MIPS executable, fixed addresses, entry 0x%08llX, flags 0x%08X\n\n",
+            (unsigned long long)elf.entry, get32(elf.data + 48));
+    fprintf(out, "%-4s %-12s %-10s %-10s %-10s %-10s\n", "Nr", "Name", "Type", "Addr", "Offset", "Size");
+    for (int i = 0; i < elf.shnum; i++) {
+        const ElfSection *s = &elf.sections[i];
+        fprintf(out, "%-4d %-12s %-10s 0x%08llX 0x%08llX %llu\n", i,
+                elf_string(&elf, elf.shstrndx, s->name), section_type_name(s->type),
+                (unsigned long long)s->addr, (unsigned long long)s->offset, (unsigned long long)s->size);
+    }
+
+    int sym = elf_find_section(&elf, ".symtab");
+    if (sym >= 0) {
+        const ElfSection *ss = &elf.sections[sym];
+        int nsyms = ss->entsize ? (int)(ss->size / ss->entsize) : 0;
+        fprintf(out, "\n%-4s %-15s %-8s %-8s %-4s %s\n", "Num", "Name", "Value", "Size", "Ndx", "Bind");
+        for (int j = 1; j < nsyms; j++) {
+            const unsigned char *p = elf.data + ss->offset + (uint64_t)j * SYM_SIZE;
+            fprintf(out, "%-4d %-15s %-8llu %-8llu %-4u %s\n", j,
+                    elf_string(&elf, (int)ss->link, get32(p)),
+                    (unsigned long long)get64(p + 8), (unsigned long long)get64(p + 16),
+                    get16(p + 6), (p[4] >> 4) == STB_GLOBAL ? "GLOBAL" : "LOCAL");
+        }
+    }
+
+    int text = elf_find_section(&elf, ".text");
+    if (text >= 0) {
+        char line[64];
+        const ElfSection *ts = &elf.sections[text];
+        fprintf(out, "\nDisassembly of .text:\n");
+        for (uint64_t off = 0; off + 4 <= ts->size; off += 4) {
+            uint32_t w = get32(elf.data + ts->offset + off);
+            fprintf(out, "%6llu: 0x%08X  %s\n", (unsigned long long)off, w,
+                    mips_disassemble(w, line, sizeof(line)));
+        }
+    }
+
+    elf_close(&elf);
+    return 0;
+}
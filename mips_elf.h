@@ -0,0 +1,26 @@
+#ifndef MIPS_ELF_H
+#define MIPS_ELF_H
+
+#include <stdio.h>
+#include "mips.h"
+
+/* Write the encoded program as an ELF64 big-endian MIPS executable image
+   with .text, .data (laid out by compute_symbol_offsets) and a symbol table.
+   The code reaches variables as offsets from $zero, so the image is fixed
+   at its addresses and carries no relocations: .data loads at address 0
+   and .text, which has no branches, at MIPS_ELF_TEXT_ADDR. Returns 0 on
+   success. */
+int mips_elf_write(const char *path, MIPSCode *code);
+
+/* Where the image places .text and its entry point; past the 32 KB that
+   $zero-based loads and stores can reach */
+#define MIPS_ELF_TEXT_ADDR 0x10000u
+
+/* Read an image back and check it against the in-memory program and the
+   symbol table. Returns 0 when everything matches. */
+int mips_elf_verify(const char *path, const MIPSCode *code);
+
+/* readelf-style dump of sections and symbols */
+int mips_elf_dump(const char *path, FILE *out);
+
+#endif
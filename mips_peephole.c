@@ -0,0 +1,294 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "mips_peephole.h"
+
+#define PEEP_MAX_WINDOW 4
+
+/* Encoded sll r0, r0, 0: marks a deleted slot until the sweep compacts */
+#define PEEP_DELETED 0x00000000u
+
+/* Instruction classes a pattern position can require */
+typedef enum {
+    MATCH_STORE,        // sw/sd with an r0 base
+    MATCH_LOAD,         // lb/lw/ld with an r0 base
+    MATCH_MOVE,         // daddu rd, rs, r0 / daddu rd, r0, rt
+    MATCH_REG_WRITE,    // no effect besides writing one general register
+} MatchClass;
+
+typedef struct {
+    const char *name;
+    MatchClass pattern[PEEP_MAX_WINDOW];
+    int length;
+    int (*guard)(const uint32_t *begin, const uint32_t *w, const uint32_t *end);
+    void (*rewrite)(uint32_t *w, const uint32_t *end);
+} PeepholeRule;
+
+static int is_store(uint32_t w) {
+    int op = MIPS_OPCODE(w);
+    return (op == OPCODE_SW || op == OPCODE_SD) && MIPS_RS(w) == 0;
+}
+
+static int is_load(uint32_t w) {
+    int op = MIPS_OPCODE(w);
+    return (op == OPCODE_LB || op == OPCODE_LW || op == OPCODE_LD) && MIPS_RS(w) == 0;
+}
+
+static int is_move(uint32_t w) {
+    return MIPS_OPCODE(w) == OPCODE_SPECIAL && MIPS_FUNCT(w) == FUNCT_DADDU &&
+           (MIPS_RT(w) == 0 || MIPS_RS(w) == 0);
+}
+
+/* Destination register of a side-effect-free instruction, or -1 */
+static int written_reg(uint32_t w) {
+    int op = MIPS_OPCODE(w);
+    if (w == PEEP_DELETED) return -1;
+    if (op == OPCODE_SPECIAL) {
+        switch (MIPS_FUNCT(w)) {
+            case FUNCT_DADDU: case FUNCT_DSUBU: case FUNCT_MFLO:
+            case FUNCT_ADDU: case FUNCT_SUBU:
+                return MIPS_RD(w);
+            default: return -1;
+        }
+    }
+    if (op == OPCODE_DADDIU || op == OPCODE_ADDIU) return MIPS_RT(w);
+    if (op == OPCODE_LB || op == OPCODE_LW || op == OPCODE_LD) return MIPS_RT(w);
+    return -1;
+}
+
+static int reads_reg(uint32_t w, int reg) {
+    int op = MIPS_OPCODE(w);
+    if (w == PEEP_DELETED || reg == 0) return 0;
+    if (op == OPCODE_SPECIAL) {
+        if (MIPS_FUNCT(w) == FUNCT_MFLO) return 0;
+        return (int)MIPS_RS(w) == reg || (int)MIPS_RT(w) == reg;
+    }
+    if (op == OPCODE_SB || op == OPCODE_SW || op == OPCODE_SD)
+        return (int)MIPS_RS(w) == reg || (int)MIPS_RT(w) == reg;
+    return (int)MIPS_RS(w) == reg;
+}
+
+static int matches(MatchClass cls, uint32_t w) {
+    switch (cls) {
+        case MATCH_STORE:     return is_store(w);
+        case MATCH_LOAD:      return is_load(w);
+        case MATCH_MOVE:      return is_move(w);
+        case MATCH_REG_WRITE: return written_reg(w) > 0;
+        default:              return 0;
+    }
+}
+
+static uint32_t encode_move(int rd, int rs) {
+    return ((uint32_t)rs << 21) | ((uint32_t)rd << 11) | FUNCT_DADDU;
+}
+
+/* Source register of a move */
+static int move_source(uint32_t w) {
+    return MIPS_RT(w) == 0 ? (int)MIPS_RS(w) : (int)MIPS_RT(w);
+}
+
+/* The instruction that last wrote LO before w, or 0 */
+static uint32_t lo_writer(const uint32_t *begin, const uint32_t *w) {
+    for (const uint32_t *p = w - 1; p >= begin; p--) {
+        if (MIPS_OPCODE(*p) != OPCODE_SPECIAL || *p == PEEP_DELETED) continue;
+        switch (MIPS_FUNCT(*p)) {
+            case FUNCT_MULT: case FUNCT_DIV: case FUNCT_DMULT: case FUNCT_DDIV: return *p;
+            default: break;
+        }
+    }
+    return 0;
+}
+
+/* Does reg hold a sign-extended 32-bit value just before w? Values from
+   lw/lb, 16-bit immediates, the 32-bit arithmetic forms and moves of those
+   qualify; 64-bit arithmetic and anything unknown is taken to be wider. */
+static int sign_extended_32(const uint32_t *begin, const uint32_t *w, int reg) {
+    for (const uint32_t *p = w - 1; p >= begin; p--) {
+        if (written_reg(*p) != reg) continue;
+        switch (MIPS_OPCODE(*p)) {
+            case OPCODE_LW: case OPCODE_LB: case OPCODE_DADDIU: case OPCODE_ADDIU:
+                return MIPS_OPCODE(*p) != OPCODE_DADDIU || MIPS_RS(*p) == 0;
+            case OPCODE_SPECIAL:
+                if (MIPS_FUNCT(*p) == FUNCT_ADDU || MIPS_FUNCT(*p) == FUNCT_SUBU) return 1;
+                if (MIPS_FUNCT(*p) == FUNCT_MFLO) {
+                    uint32_t mul = lo_writer(begin, p);
+                    return MIPS_FUNCT(mul) == FUNCT_MULT || MIPS_FUNCT(mul) == FUNCT_DIV;
+                }
+                if (!is_move(*p)) return 0;
+                reg = move_source(*p);
+                if (reg == 0) return 1;
+                break;
+            default:
+                return 0;
+        }
+    }
+    return 0;
+}
+
+/* ---- Guards and rewrites ---- */
+
+/* Stored and reloaded at the same width from the same slot. sw keeps only
+   the low word and lw sign-extends it, so the register can stand in for
+   the load only when it already holds a sign-extended 32-bit value. */
+static int guard_store_load(const uint32_t *begin, const uint32_t *w, const uint32_t *end) {
+    (void)end;
+    int st = MIPS_OPCODE(w[0]), ld = MIPS_OPCODE(w[1]);
+    if (MIPS_IMM(w[0]) != MIPS_IMM(w[1])) return 0;
+    if (st == OPCODE_SD && ld == OPCODE_LD) return 1;
+    return st == OPCODE_SW && ld == OPCODE_LW && sign_extended_32(begin, w, (int)MIPS_RT(w[0]));
+}
+
+static void rewrite_store_load(uint32_t *w, const uint32_t *end) {
+    (void)end;
+    int src = MIPS_RT(w[0]), dst = MIPS_RT(w[1]);
+    w[1] = src == dst ? PEEP_DELETED : encode_move(dst, src);
+}
+
+/* Same slot loaded twice in a row with the same instruction */
+static int guard_load_load(const uint32_t *begin, const uint32_t *w, const uint32_t *end) {
+    (void)begin;
+    (void)end;
+    return MIPS_OPCODE(w[0]) == MIPS_OPCODE(w[1]) && MIPS_IMM(w[0]) == MIPS_IMM(w[1]);
+}
+
+static void rewrite_load_load(uint32_t *w, const uint32_t *end) {
+    (void)end;
+    int src = MIPS_RT(w[0]), dst = MIPS_RT(w[1]);
+    w[1] = src == dst ? PEEP_DELETED : encode_move(dst, src);
+}
+
+static int guard_self_move(const uint32_t *begin, const uint32_t *w, const uint32_t *end) {
+    (void)begin;
+    (void)end;
+    return (int)MIPS_RD(w[0]) == move_source(w[0]);
+}
+
+/* Result is overwritten or the program ends before anything reads it.
+   The guard looks past the window, up to the end of the stream. */
+static int guard_dead_write(const uint32_t *begin, const uint32_t *w, const uint32_t *end) {
+    (void)begin;
+    int reg = written_reg(w[0]);
+    for (const uint32_t *p = w + 1; p < end; p++) {
+        if (reads_reg(*p, reg)) return 0;
+        if (written_reg(*p) == reg) return 1;
+    }
+    return 1;
+}
+
+/* Every later read of the move's destination can use its source instead:
+   the source is not overwritten while the destination is still live. */
+static int guard_copy_propagation(const uint32_t *begin, const uint32_t *w, const uint32_t *end) {
+    (void)begin;
+    int dst = MIPS_RD(w[0]), src = move_source(w[0]);
+    int srcClobbered = 0;
+    if (dst == src || src == 0) return 0;
+    for (const uint32_t *p = w + 1; p < end; p++) {
+        if (reads_reg(*p, dst) && srcClobbered) return 0;
+        if (written_reg(*p) == dst) return 1;
+        if (written_reg(*p) == src) srcClobbered = 1;
+    }
+    return 1;
+}
+
+static uint32_t replace_read(uint32_t w, int from, int to) {
+    int op = MIPS_OPCODE(w);
+    int readsRt = op == OPCODE_SPECIAL || op == OPCODE_SB || op == OPCODE_SW || op == OPCODE_SD;
+    if ((int)MIPS_RS(w) == from) w = (w & ~(0x1Fu << 21)) | ((uint32_t)to << 21);
+    if (readsRt && (int)MIPS_RT(w) == from) w = (w & ~(0x1Fu << 16)) | ((uint32_t)to << 16);
+    return w;
+}
+
+static void rewrite_copy_propagation(uint32_t *w, const uint32_t *end) {
+    int dst = MIPS_RD(w[0]), src = move_source(w[0]);
+    for (uint32_t *p = w + 1; p < end; p++) {
+        if (reads_reg(*p, dst)) *p = replace_read(*p, dst, src);
+        if (written_reg(*p) == dst || written_reg(*p) == src) break;
+    }
+    w[0] = PEEP_DELETED;
+}
+
+static int access_width(uint32_t w) {
+    switch (MIPS_OPCODE(w)) {
+        case OPCODE_LB: case OPCODE_SB: return 1;
+        case OPCODE_LW: case OPCODE_SW: return 4;
+        case OPCODE_LD: case OPCODE_SD: return 8;
+        default:                         return 0;
+    }
+}
+
+/* A later store covers the same bytes before any load can observe them */
+static int guard_dead_store(const uint32_t *begin, const uint32_t *w, const uint32_t *end) {
+    (void)begin;
+    int lo = MIPS_IMM(w[0]), hi = lo + access_width(w[0]);
+    for (const uint32_t *p = w + 1; p < end; p++) {
+        int width = access_width(*p);
+        if (!width) continue;
+        if (MIPS_RS(*p) != 0) return 0;
+        int plo = MIPS_IMM(*p), phi = plo + width;
+        if (is_store(*p)) {
+            if (plo <= lo && phi >= hi) return 1;
+        } else if (plo < hi && lo < phi) {
+            return 0;
+        }
+    }
+    return 0;
+}
+
+static void rewrite_delete(uint32_t *w, const uint32_t *end) {
+    (void)end;
+    w[0] = PEEP_DELETED;
+}
+
+static const PeepholeRule rules[] = {
+    { "store-to-load forwarding", { MATCH_STORE, MATCH_LOAD }, 2, guard_store_load, rewrite_store_load },
+    { "redundant reload",         { MATCH_LOAD, MATCH_LOAD },  2, guard_load_load,  rewrite_load_load },
+    { "redundant move",           { MATCH_MOVE },              1, guard_self_move,  rewrite_delete },
+    { "copy propagation",         { MATCH_MOVE },              1, guard_copy_propagation, rewrite_copy_propagation },
+    { "dead register write",      { MATCH_REG_WRITE },         1, guard_dead_write, rewrite_delete },
+    { "overwritten store",        { MATCH_STORE },             1, guard_dead_store, rewrite_delete },
+};
+
+
+static void compact(MIPSCode *code) {
+    int out = 0;
+    for (int i = 0; i < code->count; i++) {
+        if (code->words[i] != PEEP_DELETED) code->words[out++] = code->words[i];
+    }
+    code->count = out;
+}
+
+int mips_peephole(MIPSCode *code, MIPSPeepholeStats *stats) {
+    int total = 0;
+    int changed = 1;
+
+    while (changed) {
+        changed = 0;
+        const uint32_t *end = code->words + code->count;
+
+        for (int i = 0; i < code->count; i++) {
+            for (int r = 0; r < MIPS_PEEPHOLE_RULES; r++) {
+                const PeepholeRule *rule = &rules[r];
+                if (i + rule->length > code->count) continue;
+
+                int ok = 1;
+                for (int k = 0; k < rule->length && ok; k++) {
+                    ok = matches(rule->pattern[k], code->words[i + k]);
+                }
+                if (!ok || !rule->guard(code->words, code->words + i, end)) continue;
+
+                rule->rewrite(code->words + i, end);
+                if (stats) stats->fired[r]++;
+                total++;
+                changed = 1;
+                if (code->words[i] == PEEP_DELETED) break;
+            }
+        }
+        compact(code);
+    }
+    return total;
+}
+
+void mips_peephole_report(const MIPSPeepholeStats *stats, FILE *out) {
+    for (int r = 0; r < MIPS_PEEPHOLE_RULES; r++) {
+        fprintf(out, "%s: %ld\n", rules[r].name, stats->fired[r]);
+    }
+}
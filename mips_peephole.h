@@ -0,0 +1,20 @@
+#ifndef MIPS_PEEPHOLE_H
+#define MIPS_PEEPHOLE_H
+
+#include <stdio.h>
+#include "mips.h"
+
+#define MIPS_PEEPHOLE_RULES 6
+
+/* How often each rule fired, accumulated over the runs it is passed to */
+typedef struct {
+    long fired[MIPS_PEEPHOLE_RULES];
+} MIPSPeepholeStats;
+
+/* Rewrite the encoded stream in place until no rule fires. Returns the
+   number of rewrites applied; stats may be NULL. */
+int mips_peephole(MIPSCode *code, MIPSPeepholeStats *stats);
+
+void mips_peephole_report(const MIPSPeepholeStats *stats, FILE *out);
+
+#endif
@@ -0,0 +1,215 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mips_sched.h"
+
+#define REG_LO 32
+
+/* What one instruction reads and writes */
+typedef struct {
+    uint32_t word;
+    int defs[2];
+    int uses[2];
+    int isLoad;
+    int isStore;
+    int addr;         // absolute address, or -1 when the base is not r0
+    int width;
+    int latency;      // cycles until its result can be consumed
+    int known;        // 0 for instructions the scheduler does not model
+} SchedNode;
+
+static int mem_width(int opcode) {
+    switch (opcode) {
+        case OPCODE_LB: case OPCODE_SB: return 1;
+        case OPCODE_LW: case OPCODE_SW: return 4;
+        case OPCODE_LD: case OPCODE_SD: return 8;
+        default:                         return 0;
+    }
+}
+
+static void describe(uint32_t w, SchedNode *n) {
+    memset(n, 0, sizeof(*n));
+    n->word = w;
+    n->defs[0] = n->defs[1] = -1;
+    n->uses[0] = n->uses[1] = -1;
+    n->addr = -1;
+    n->latency = MIPS_LATENCY_ALU;
+    n->known = 1;
+
+    int opcode = MIPS_OPCODE(w);
+    int rs = MIPS_RS(w), rt = MIPS_RT(w), rd = MIPS_RD(w);
+
+    if (opcode == OPCODE_SPECIAL) {
+        switch (MIPS_FUNCT(w)) {
+            case FUNCT_DADDU:
+            case FUNCT_DSUBU:
+            case FUNCT_ADDU:
+            case FUNCT_SUBU:
+                n->defs[0] = rd; n->uses[0] = rs; n->uses[1] = rt;
+                break;
+            case FUNCT_DMULT:
+            case FUNCT_MULT:
+                n->defs[0] = REG_LO; n->uses[0] = rs; n->uses[1] = rt;
+                n->latency = MIPS_LATENCY_MULT;
+                break;
+            case FUNCT_DDIV:
+            case FUNCT_DIV:
+                n->defs[0] = REG_LO; n->uses[0] = rs; n->uses[1] = rt;
+                n->latency = MIPS_LATENCY_DIV;
+                break;
+            case FUNCT_MFLO:
+                n->defs[0] = rd; n->uses[0] = REG_LO;
+                break;
+            default:
+                n->known = 0;
+                break;
+        }
+    } else if (opcode == OPCODE_DADDIU || opcode == OPCODE_ADDIU) {
+        n->defs[0] = rt; n->uses[0] = rs;
+    } else if (mem_width(opcode)) {
+        n->width = mem_width(opcode);
+        n->addr = rs == 0 ? MIPS_IMM(w) : -1;
+        n->uses[0] = rs;
+        if (opcode == OPCODE_SB || opcode == OPCODE_SW || opcode == OPCODE_SD) {
+            n->isStore = 1;
+            n->uses[1] = rt;
+        } else {
+            n->isLoad = 1;
+            n->defs[0] = rt;
+            n->latency = MIPS_LATENCY_LOAD;
+        }
+    } else {
+        n->known = 0;
+    }
+
+    /* r0 never carries a dependence */
+    for (int i = 0; i < 2; i++) {
+        if (n->defs[i] == 0) n->defs[i] = -1;
+        if (n->uses[i] == 0) n->uses[i] = -1;
+    }
+}
+
+static int defines(const SchedNode *n, int reg) {
+    return reg >= 0 && (n->defs[0] == reg || n->defs[1] == reg);
+}
+
+static int mem_overlap(const SchedNode *a, const SchedNode *b) {
+    if (a->addr < 0 || b->addr < 0) return 1;
+    return a->addr < b->addr + b->width && b->addr < a->addr + a->width;
+}
+
+/* Minimum distance in cycles between the EX stages of a and a later b,
+   or 0 when b does not depend on a */
+static int dependence(const SchedNode *a, const SchedNode *b) {
+    int dist = 0;
+
+    for (int i = 0; i < 2; i++) {
+        if (defines(a, b->uses[i]) && a->latency > dist) dist = a->latency;   // RAW
+    }
+    for (int i = 0; i < 2; i++) {
+        if (defines(b, a->uses[i]) && dist < 1) dist = 1;                    // WAR
+        if (defines(a, b->defs[i])) {                                        // WAW
+            // A second multiply/divide waits for the unit to free up
+            int d = b->defs[i] == REG_LO ? a->latency : 1;
+            if (d > dist) dist = d;
+        }
+    }
+
+    if ((a->isStore || b->isStore) && (a->isStore || a->isLoad) &&
+        (b->isStore || b->isLoad) && mem_overlap(a, b) && dist < 1) {
+        dist = 1;
+    }
+    return dist;
+}
+
+/* List-schedule nodes[0..n) in place */
+static void schedule_region(SchedNode *nodes, int n) {
+    if (n < 2) return;
+
+    int *dist = calloc((size_t)n * n, sizeof(int));
+    int *height = calloc(n, sizeof(int));
+    int *preds = calloc(n, sizeof(int));
+    int *earliest = calloc(n, sizeof(int));
+    int *done = calloc(n, sizeof(int));
+    SchedNode *out = malloc(n * sizeof(SchedNode));
+    if (!dist || !height || !preds || !earliest || !done || !out) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+
+    for (int i = 0; i < n; i++) {
+        for (int j = i + 1; j < n; j++) {
+            dist[i * n + j] = dependence(&nodes[i], &nodes[j]);
+            if (dist[i * n + j]) preds[j]++;
+        }
+    }
+
+    /* Priority: latency-weighted path length to the end of the region */
+    for (int i = n - 1; i >= 0; i--) {
+        height[i] = nodes[i].latency;
+        for (int j = i + 1; j < n; j++) {
+            int d = dist[i * n + j];
+            if (d && d + height[j] > height[i]) height[i] = d + height[j];
+        }
+    }
+
+    int cycle = 0;
+    for (int placed = 0; placed < n; placed++) {
+        int best = -1;
+        int stalled = -1;
+        for (int i = 0; i < n; i++) {
+            if (done[i] || preds[i]) continue;
+            if (earliest[i] <= cycle) {
+                if (best < 0 || height[i] > height[best]) best = i;
+            } else if (stalled < 0 || earliest[i] < earliest[stalled] ||
+                       (earliest[i] == earliest[stalled] && height[i] > height[stalled])) {
+                stalled = i;
+            }
+        }
+        /* Nothing can issue without stalling: take the one ready soonest */
+        if (best < 0) {
+            best = stalled;
+            cycle = earliest[best];
+        }
+
+        done[best] = 1;
+        out[placed] = nodes[best];
+        for (int j = best + 1; j < n; j++) {
+            int d = dist[best * n + j];
+            if (!d) continue;
+            preds[j]--;
+            if (cycle + d > earliest[j]) earliest[j] = cycle + d;
+        }
+        cycle++;
+    }
+
+    memcpy(nodes, out, n * sizeof(SchedNode));
+    free(dist);
+    free(height);
+    free(preds);
+    free(earliest);
+    free(done);
+    free(out);
+}
+
+void mips_schedule(MIPSCode *code) {
+    SchedNode *nodes = malloc((code->count > 0 ? code->count : 1) * sizeof(SchedNode));
+    if (!nodes) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (int i = 0; i < code->count; i++) describe(code->words[i], &nodes[i]);
+
+    /* Regions end at instructions the scheduler does not understand and
+       are capped at MIPS_SCHED_WINDOW to bound the quadratic analysis */
+    int start = 0;
+    while (start < code->count) {
+        int end = start;
+        while (end < code->count && nodes[end].known && end - start < MIPS_SCHED_WINDOW) end++;
+        schedule_region(nodes + start, end - start);
+        start = end == start ? end + 1 : end;
+    }
+
+    for (int i = 0; i < code->count; i++) code->words[i] = nodes[i].word;
+    free(nodes);
+}
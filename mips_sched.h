@@ -0,0 +1,14 @@
+#ifndef MIPS_SCHED_H
+#define MIPS_SCHED_H
+
+#include "mips.h"
+
+/* Largest run of instructions scheduled as one region */
+#define MIPS_SCHED_WINDOW 256
+
+/* Reorder independent instructions within each straight-line region to
+   hide load-use and multiply/divide latency. Dependences through
+   registers, LO and memory are preserved. */
+void mips_schedule(MIPSCode *code);
+
+#endif
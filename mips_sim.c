@@ -0,0 +1,237 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "mips_sim.h"
+#include "symbol_table.h"
+
+/* Machine state for one run */
+typedef struct {
+    int64_t regs[32];
+    int64_t lo, hi;
+    unsigned char *mem;
+} MIPSMachine;
+
+/* Big-endian memory access, returns 0 when the address is out of range */
+static int mem_check(uint64_t addr, int width) {
+    return addr + (uint64_t)width <= MIPS_SIM_MEMORY;
+}
+
+static int64_t mem_load(MIPSMachine *m, uint64_t addr, int width) {
+    uint64_t v = 0;
+    for (int i = 0; i < width; i++) v = (v << 8) | m->mem[addr + i];
+    switch (width) {
+        case 1:  return (int8_t)v;
+        case 4:  return (int32_t)v;
+        default: return (int64_t)v;
+    }
+}
+
+static void mem_store(MIPSMachine *m, uint64_t addr, int width, int64_t value) {
+    uint64_t v = (uint64_t)value;
+    for (int i = width - 1; i >= 0; i--) {
+        m->mem[addr + i] = (unsigned char)v;
+        v >>= 8;
+    }
+}
+
+static int load_width(int opcode) {
+    switch (opcode) {
+        case OPCODE_LB: case OPCODE_SB: return 1;
+        case OPCODE_LW: case OPCODE_SW: return 4;
+        case OPCODE_LD: case OPCODE_SD: return 8;
+        default:                         return 0;
+    }
+}
+
+/* Compare final memory with the symbol values left by tac_execute */
+static int check_symbols(MIPSMachine *m, SymbolTable *st) {
+    int mismatches = 0;
+    for (int i = 0; i < st->count; i++) {
+        Symbol *s = &st->entries[i];
+        if (s->memOffset < 0 || !mem_check((uint64_t)s->memOffset, 4)) continue;
+
+        int expected, actual;
+        if (s->type == TYPE_CHR) {
+            expected = (int)VALUE_CHR(s->value);
+            actual = (int)mem_load(m, (uint64_t)s->memOffset, 1);
+        } else {
+            expected = VALUE_NUM(s->value);
+            actual = (int)mem_load(m, (uint64_t)s->memOffset, 4);
+        }
+
+        if (expected != actual) {
+            fprintf(stderr, "Simulation mismatch: '%s' is %d in memory, %d after execution\n",
+                    s->name, actual, expected);
+            mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+int mips_simulate(const MIPSCode *code, int forwarding, MIPSSimStats *stats) {
+    memset(stats, 0, sizeof(*stats));
+
+    MIPSMachine m;
+    memset(&m, 0, sizeof(m));
+    m.mem = calloc(MIPS_SIM_MEMORY, 1);
+    if (!m.mem) {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    int imageSize;
+    unsigned char *image = mips_data_image(code, &imageSize);
+    memcpy(m.mem, image, imageSize < MIPS_SIM_MEMORY ? imageSize : MIPS_SIM_MEMORY);
+    free(image);
+
+    /* Timing: cycle in which each value can feed a consumer's EX stage.
+       Without forwarding, values are only read back after write-back. */
+    long ready[32] = {0};
+    long loReady = 0, unitFree = 0;
+    long prevEx = 2;   // first instruction reaches EX in cycle 3
+    int extra = forwarding ? 0 : 2;
+
+    for (int pc = 0; pc < code->count; pc++) {
+        uint32_t w = code->words[pc];
+        int opcode = MIPS_OPCODE(w);
+        int rs = MIPS_RS(w), rt = MIPS_RT(w), rd = MIPS_RD(w);
+        int funct = MIPS_FUNCT(w);
+
+        /* Which registers does this instruction read? */
+        int src1 = -1, src2 = -1, readsLo = 0, usesUnit = 0;
+        if (opcode == OPCODE_SPECIAL) {
+            if (funct == FUNCT_MFLO) {
+                readsLo = 1;
+            } else {
+                src1 = rs;
+                src2 = rt;
+                usesUnit = funct == FUNCT_DMULT || funct == FUNCT_DDIV ||
+                           funct == FUNCT_MULT || funct == FUNCT_DIV;
+            }
+        } else if (load_width(opcode) && (opcode == OPCODE_SB || opcode == OPCODE_SW || opcode == OPCODE_SD)) {
+            src1 = rs;
+            src2 = rt;
+        } else {
+            src1 = rs;
+        }
+
+        long ex = prevEx + 1;
+        if (src1 > 0 && ready[src1] > ex) ex = ready[src1];
+        if (src2 > 0 && ready[src2] > ex) ex = ready[src2];
+        stats->rawStalls += ex - (prevEx + 1);
+        long exRaw = ex;
+        if (readsLo && loReady > ex) ex = loReady;
+        if (usesUnit && unitFree > ex) ex = unitFree;
+        stats->mulDivStalls += ex - exRaw;
+        prevEx = ex;
+
+        stats->instructions++;
+
+        /* Execute */
+        int64_t *r = m.regs;
+        int dest = -1;
+        long latency = MIPS_LATENCY_ALU;
+
+        if (opcode == OPCODE_SPECIAL) {
+            switch (funct) {
+                case FUNCT_DADDU: r[rd] = (int64_t)((uint64_t)r[rs] + (uint64_t)r[rt]); dest = rd; break;
+                case FUNCT_DSUBU: r[rd] = (int64_t)((uint64_t)r[rs] - (uint64_t)r[rt]); dest = rd; break;
+                case FUNCT_MFLO:  r[rd] = m.lo; dest = rd; break;
+                case FUNCT_DMULT:
+                    m.lo = (int64_t)((uint64_t)r[rs] * (uint64_t)r[rt]);
+                    loReady = unitFree = ex + MIPS_LATENCY_MULT + extra;
+                    break;
+                case FUNCT_DDIV:
+                    if (r[rt] == 0) {
+                        fprintf(stderr, "Simulation fault at word %d: division by zero\n", pc);
+                        stats->faulted = 1;
+                        break;
+                    }
+                    m.lo = r[rs] / r[rt];
+                    m.hi = r[rs] % r[rt];
+                    loReady = unitFree = ex + MIPS_LATENCY_DIV + extra;
+                    break;
+                /* The 32-bit forms work on the low words and sign-extend */
+                case FUNCT_ADDU: r[rd] = (int32_t)((uint32_t)r[rs] + (uint32_t)r[rt]); dest = rd; break;
+                case FUNCT_SUBU: r[rd] = (int32_t)((uint32_t)r[rs] - (uint32_t)r[rt]); dest = rd; break;
+                case FUNCT_MULT:
+                    m.lo = (int32_t)((uint32_t)r[rs] * (uint32_t)r[rt]);
+                    loReady = unitFree = ex + MIPS_LATENCY_MULT + extra;
+                    break;
+                case FUNCT_DIV: {
+                    int32_t a = (int32_t)r[rs], b = (int32_t)r[rt];
+                    if (b == 0) {
+                        fprintf(stderr, "Simulation fault at word %d: division by zero\n", pc);
+                        stats->faulted = 1;
+                        break;
+                    }
+                    // INT32_MIN / -1 is unpredictable on MIPS; take the wrapped quotient
+                    m.lo = b == -1 ? (int32_t)(0u - (uint32_t)a) : a / b;
+                    m.hi = b == -1 ? 0 : a % b;
+                    loReady = unitFree = ex + MIPS_LATENCY_DIV + extra;
+                    break;
+                }
+                default:
+                    fprintf(stderr, "Simulation fault at word %d: unknown instruction 0x%08X\n", pc, w);
+                    stats->faulted = 1;
+                    break;
+            }
+        } else if (opcode == OPCODE_DADDIU) {
+            r[rt] = r[rs] + MIPS_IMM(w);
+            dest = rt;
+        } else if (opcode == OPCODE_ADDIU) {
+            r[rt] = (int32_t)((uint32_t)r[rs] + (uint32_t)(int32_t)MIPS_IMM(w));
+            dest = rt;
+        } else if (load_width(opcode)) {
+            int width = load_width(opcode);
+            uint64_t addr = (uint64_t)(r[rs] + MIPS_IMM(w));
+            if (!mem_check(addr, width)) {
+                fprintf(stderr, "Simulation fault at word %d: address %lld out of range\n",
+                        pc, (long long)addr);
+                stats->faulted = 1;
+            } else if (opcode == OPCODE_SB || opcode == OPCODE_SW || opcode == OPCODE_SD) {
+                mem_store(&m, addr, width, r[rt]);
+                stats->stores++;
+            } else {
+                r[rt] = mem_load(&m, addr, width);
+                dest = rt;
+                latency = MIPS_LATENCY_LOAD;
+                stats->loads++;
+            }
+        } else {
+            fprintf(stderr, "Simulation fault at word %d: unknown instruction 0x%08X\n", pc, w);
+            stats->faulted = 1;
+        }
+
+        if (stats->faulted) break;
+
+        r[0] = 0;
+        if (dest > 0) ready[dest] = ex + latency + extra;
+    }
+
+    /* The last instruction still has to pass MEM and WB */
+    stats->cycles = stats->instructions ? prevEx + 2 : 0;
+
+    if (!stats->faulted) stats->mismatches = check_symbols(&m, code->symbols);
+
+    free(m.mem);
+    return stats->faulted || stats->mismatches ? 1 : 0;
+}
+
+void mips_sim_report(const MIPSSimStats *stats, FILE *out) {
+    fprintf(out, "instructions: %ld\n", stats->instructions);
+    fprintf(out, "loads: %ld\n", stats->loads);
+    fprintf(out, "stores: %ld\n", stats->stores);
+    fprintf(out, "RAW stalls: %ld\n", stats->rawStalls);
+    fprintf(out, "mul/div stalls: %ld\n", stats->mulDivStalls);
+    fprintf(out, "cycles: %ld\n", stats->cycles);
+    if (stats->instructions)
+        fprintf(out, "CPI: %.2f\n", (double)stats->cycles / stats->instructions);
+    if (stats->faulted)
+        fprintf(out, "result: fault\n");
+    else if (stats->mismatches)
+        fprintf(out, "result: %d variable(s) differ from tac_execute\n", stats->mismatches);
+    else
+        fprintf(out, "result: memory matches tac_execute\n");
+}
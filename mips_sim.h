@@ -0,0 +1,26 @@
+#ifndef MIPS_SIM_H
+#define MIPS_SIM_H
+
+#include <stdio.h>
+#include "mips.h"
+
+#define MIPS_SIM_MEMORY 65536
+
+typedef struct {
+    long instructions;
+    long loads;
+    long stores;
+    long rawStalls;       // waiting on a general register (load-use, RAW)
+    long mulDivStalls;    // waiting on LO or a busy multiplier/divider
+    long cycles;
+    int mismatches;       // variables whose memory differs from tac_execute
+    int faulted;          // bad address, unknown instruction or divide by zero
+} MIPSSimStats;
+
+/* Run the encoded program from a fresh machine whose memory holds the
+   .data image. forwarding selects the EduMIPS64 forwarding setting. */
+int mips_simulate(const MIPSCode *code, int forwarding, MIPSSimStats *stats);
+
+void mips_sim_report(const MIPSSimStats *stats, FILE *out);
+
+#endif
@@ -0,0 +1,173 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "native.h"
+#include "symbol_table.h"
+
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#define popen _popen
+#define pclose _pclose
+#define dup _dup
+#define dup2 _dup2
+#define fileno _fileno
+#define close _close
+#define NULL_DEVICE "NUL"
+#define EXE_SUFFIX ".exe"
+#define EXIT_CODE(status) (status)
+#else
+#include <unistd.h>
+#include <time.h>
+#include <sys/wait.h>
+#define NULL_DEVICE "/dev/null"
+#define EXE_SUFFIX ""
+#define EXIT_CODE(status) (WIFEXITED(status) ? WEXITSTATUS(status) : -1)
+#endif
+
+double native_now_ms(void) {
+#ifdef _WIN32
+    LARGE_INTEGER frequency, now;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&now);
+    return (double)now.QuadPart * 1000.0 / frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+#endif
+}
+
+const char *native_compiler(void) {
+    const char *cc = getenv("CC");
+    if (!cc || !*cc) cc = "cc";
+
+    char cmd[1024];
+    snprintf(cmd, sizeof(cmd), "%s --version >" NULL_DEVICE " 2>&1", cc);
+    return system(cmd) == 0 ? cc : NULL;
+}
+
+void native_exe_path(const char *srcPath, char *exePath, size_t size) {
+    size_t n = strlen(srcPath);
+    if (n > 2 && (strcmp(srcPath + n - 2, ".c") == 0 || strcmp(srcPath + n - 2, ".s") == 0)) {
+        snprintf(exePath, size, "%.*s" EXE_SUFFIX, (int)(n - 2), srcPath);
+    } else {
+        snprintf(exePath, size, "%s.out" EXE_SUFFIX, srcPath);
+    }
+}
+
+int native_build(const char *cc, const char *srcPath, const char *exePath) {
+    char cmd[2048];
+    snprintf(cmd, sizeof(cmd), "%s -O2 -o \"%s\" \"%s\"", cc, exePath, srcPath);
+    return system(cmd) == 0 ? 0 : 1;
+}
+
+/* Read a whole stream into a malloc'd buffer */
+static char *read_all(FILE *f, size_t *len) {
+    size_t cap = 4096;
+    char *buf = malloc(cap);
+    if (!buf) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    *len = 0;
+    size_t n;
+    while ((n = fread(buf + *len, 1, cap - *len, f)) > 0) {
+        *len += n;
+        if (*len == cap) {
+            cap *= 2;
+            buf = realloc(buf, cap);
+            if (!buf) {
+                fprintf(stderr, "Out of memory\n");
+                exit(1);
+            }
+        }
+    }
+    return buf;
+}
+
+/* Run tac_execute from a zeroed symbol table with stdout captured, then put
+   the symbol table back the way the real run left it */
+static char *capture_interpreter(TACProgram *prog, size_t *len, int *status, double *ms) {
+    SymbolTable *st = prog->symbols;
+    Value *values = malloc((st->count + 1) * sizeof(Value));
+    if (!values) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (int i = 0; i < st->count; i++) {
+        values[i] = st->entries[i].value;
+        st->entries[i].value = VALUE_MAKE(0, FLEX_NONE);
+    }
+
+    char *text = NULL;
+    *len = 0;
+    *status = -1;
+    FILE *tmp = tmpfile();
+    if (tmp) {
+        fflush(stdout);
+        int saved = dup(fileno(stdout));
+        dup2(fileno(tmp), fileno(stdout));
+        double start = native_now_ms();
+        *status = tac_execute(prog);
+        fflush(stdout);
+        *ms = native_now_ms() - start;
+        dup2(saved, fileno(stdout));
+        close(saved);
+        rewind(tmp);
+        text = read_all(tmp, len);
+        fclose(tmp);
+    }
+
+    for (int i = 0; i < st->count; i++) {
+        st->entries[i].value = values[i];
+    }
+    free(values);
+    return text;
+}
+
+static char *run_executable(const char *exePath, size_t *len, int *status, double *ms) {
+    char cmd[2048];
+    snprintf(cmd, sizeof(cmd), "%s\"%s\" 2>" NULL_DEVICE,
+             strchr(exePath, '/') || strchr(exePath, '\\') ? "" : "./", exePath);
+
+    double start = native_now_ms();
+    FILE *run = popen(cmd, "r");
+    if (!run) return NULL;
+    char *text = read_all(run, len);
+    int rc = pclose(run);
+    *ms = native_now_ms() - start;
+    *status = EXIT_CODE(rc);
+    return text;
+}
+
+int native_check(TACProgram *prog, const char *exePath, int runs, NativeResult *res) {
+    memset(res, 0, sizeof(*res));
+    if (runs < 1) runs = 1;
+
+    size_t expectedLen = 0, actualLen = 0;
+    int expectedStatus = -1, status = -1;
+    char *expected = NULL, *actual = NULL;
+
+    for (int i = 0; i < runs; i++) {
+        double ms;
+        free(expected);
+        expected = capture_interpreter(prog, &expectedLen, &expectedStatus, &ms);
+        if (!expected) return 1;
+        if (i == 0 || ms < res->interpMs) res->interpMs = ms;
+
+        free(actual);
+        actual = run_executable(exePath, &actualLen, &status, &ms);
+        if (!actual) {
+            free(expected);
+            return 1;
+        }
+        if (i == 0 || ms < res->nativeMs) res->nativeMs = ms;
+    }
+
+    res->matches = status == expectedStatus && actualLen == expectedLen &&
+                   memcmp(actual, expected, actualLen) == 0;
+    free(expected);
+    free(actual);
+    return res->matches ? 0 : 1;
+}
@@ -0,0 +1,34 @@
+#ifndef NATIVE_H
+#define NATIVE_H
+
+#include <stddef.h>
+#include "tac.h"
+
+/* Shared by the backends that produce a host program (C, x86-64 assembly):
+   build it with the system compiler, run it and compare it with
+   tac_execute. */
+
+typedef struct {
+    int matches;        // same stdout bytes and exit status as tac_execute
+    double interpMs;    // best tac_execute run, in-process
+    double nativeMs;    // best run of the executable, including process start
+} NativeResult;
+
+/* $CC, else cc; NULL when no compiler answers */
+const char *native_compiler(void);
+
+/* prog.c / prog.s -> prog (plus .exe on Windows) */
+void native_exe_path(const char *srcPath, char *exePath, size_t size);
+
+/* Compile or assemble+link srcPath. Returns 0 on success. */
+int native_build(const char *cc, const char *srcPath, const char *exePath);
+
+/* Run the executable and tac_execute `runs` times each, from zeroed
+   symbols, and compare their output. The symbol table is left as the
+   real run left it. Returns 0 when the outputs match. */
+int native_check(TACProgram *prog, const char *exePath, int runs, NativeResult *res);
+
+/* Wall clock in milliseconds */
+double native_now_ms(void);
+
+#endif
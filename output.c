@@ -0,0 +1,89 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "output.h"
+
+/* Per thread: JIT code calls the output_* functions directly, so
+   concurrent compilations cannot pass a context down to them */
+static _Thread_local char *buf;
+static _Thread_local size_t len;
+static _Thread_local size_t cap;
+static _Thread_local int capturing;
+
+static void reserve(size_t n) {
+    if (len + n <= cap) return;
+    size_t newCap = cap ? cap : OUTPUT_FLUSH_AT;
+    while (newCap < len + n) newCap *= 2;
+    buf = realloc(buf, newCap);
+    if (!buf) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    cap = newCap;
+}
+
+void output_flush(void) {
+    if (capturing) return;
+    if (len > 0) fwrite(buf, 1, len, stdout);
+    len = 0;
+    // Through stdio too, or a stderr message could still overtake it
+    fflush(stdout);
+}
+
+void output_bytes(const char *s, size_t n) {
+    if (!capturing && len + n > OUTPUT_FLUSH_AT) {
+        output_flush();
+        if (n > OUTPUT_FLUSH_AT) {
+            fwrite(s, 1, n, stdout);
+            return;
+        }
+    }
+    reserve(n);
+    memcpy(buf + len, s, n);
+    len += n;
+}
+
+void output_str(const char *s) {
+    output_bytes(s, strlen(s));
+}
+
+void output_chr(int c) {
+    if (len < cap && (capturing || len < OUTPUT_FLUSH_AT)) {
+        buf[len++] = (char)c;
+        return;
+    }
+    char ch = (char)c;
+    output_bytes(&ch, 1);
+}
+
+/* Digits are produced backwards into a small scratch; unsigned arithmetic
+   keeps INT_MIN exact */
+void output_num(int v) {
+    char tmp[12];
+    char *p = tmp + sizeof(tmp);
+    unsigned int u = v < 0 ? 0u - (unsigned int)v : (unsigned int)v;
+    do {
+        *--p = (char)('0' + u % 10);
+        u /= 10;
+    } while (u);
+    if (v < 0) *--p = '-';
+    output_bytes(p, (size_t)(tmp + sizeof(tmp) - p));
+}
+
+void output_capture(int enable) {
+    if (enable) {
+        output_flush();
+    } else {
+        len = 0;
+    }
+    capturing = enable;
+}
+
+const char *output_buffer(size_t *size) {
+    if (size) *size = len;
+    return buf;
+}
+
+void output_clear(void) {
+    len = 0;
+}
@@ -0,0 +1,30 @@
+#ifndef OUTPUT_H
+#define OUTPUT_H
+
+#include <stddef.h>
+
+/* Console output of tac_execute, the VM and the JIT. Writes go into one
+   reusable buffer that is handed to stdout in OUTPUT_FLUSH_AT chunks and at
+   the end of every run, so a run does no per-item stdio calls. The buffer
+   and capture state are per thread. */
+#define OUTPUT_FLUSH_AT 65536
+
+void output_bytes(const char *s, size_t n);
+void output_str(const char *s);
+void output_chr(int c);
+void output_num(int v);
+
+/* Write pending output to stdout and flush it; a no-op while capturing.
+   Call before writing to stderr so messages keep their place relative to
+   the output. */
+void output_flush(void);
+
+/* Embedders: while capture is on, output accumulates in the buffer instead
+   of reaching stdout. output_buffer returns it (not NUL-terminated) and
+   output_clear empties it for the next run. Turning capture off drops
+   whatever is still in the buffer. */
+void output_capture(int enable);
+const char *output_buffer(size_t *len);
+void output_clear(void);
+
+#endif
@@ -1,21 +1,22 @@
-/* A Bison parser, made by GNU Bison 2.7.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989-1990, 2000-2012 Free Software Foundation, Inc.
-   
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -26,13 +27,17 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,17 +45,17 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "2.7"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
 
 /* Pure parsers.  */
-#define YYPURE 0
+#define YYPURE 1
 
 /* Push parsers.  */
 #define YYPUSH 0
@@ -61,170 +66,194 @@
 
 
 
-/* Copy the first part of user declarations.  */
-/* Line 371 of yacc.c  */
+/* First part of user prologue.  */
 #line 1 "parser.y"
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <stdbool.h>
-#include "symbol_table.h"
 #include "ast.h"
-#include "tac.h"
-#include <windows.h>
-
-extern int yylex();
-extern int yylineno;
-extern char *yytext;
+#include "compiler.h"
 
-void yyerror(const char *s);
-extern int yychar;
-
-int lineCount = 1;
-ASTNode *root = NULL;
-int error_count = 0;
-bool DEBUG_MODE = false;
+/* Names are interned in the compilation's symbol table as they are parsed */
+static Atom name_atom(Compiler *cc, TokenSlice name) {
+    return intern(&cc->symbols.names, name.text, (size_t)name.len);
+}
 
-VarType current_decl_type;
+static ASTNode *string_literal(Compiler *cc, TokenSlice text) {
+    cc->textCopies++;
+    cc->textBytes += text.len + 1;
+    return ast_create_str_lit(text, cc->lineCount);
+}
 
 
-/* Line 371 of yacc.c  */
-#line 94 "parser.tab.c"
+#line 91 "parser.tab.c"
 
-# ifndef YY_NULL
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULL nullptr
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
 #  else
-#   define YY_NULL 0
+#   define YY_NULLPTR ((void*)0)
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
+#include "parser.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_TOK_NMBR = 3,                   /* TOK_NMBR  */
+  YYSYMBOL_TOK_CHR = 4,                    /* TOK_CHR  */
+  YYSYMBOL_TOK_FLEX = 5,                   /* TOK_FLEX  */
+  YYSYMBOL_TOK_SHW = 6,                    /* TOK_SHW  */
+  YYSYMBOL_TOK_PLUS = 7,                   /* TOK_PLUS  */
+  YYSYMBOL_TOK_MINUS = 8,                  /* TOK_MINUS  */
+  YYSYMBOL_TOK_MULT = 9,                   /* TOK_MULT  */
+  YYSYMBOL_TOK_DIV = 10,                   /* TOK_DIV  */
+  YYSYMBOL_TOK_PLUS_ASSIGN = 11,           /* TOK_PLUS_ASSIGN  */
+  YYSYMBOL_TOK_MINUS_ASSIGN = 12,          /* TOK_MINUS_ASSIGN  */
+  YYSYMBOL_TOK_MULT_ASSIGN = 13,           /* TOK_MULT_ASSIGN  */
+  YYSYMBOL_TOK_DIV_ASSIGN = 14,            /* TOK_DIV_ASSIGN  */
+  YYSYMBOL_TOK_ASSIGN = 15,                /* TOK_ASSIGN  */
+  YYSYMBOL_TOK_CONCAT = 16,                /* TOK_CONCAT  */
+  YYSYMBOL_TOK_LPAREN = 17,                /* TOK_LPAREN  */
+  YYSYMBOL_TOK_RPAREN = 18,                /* TOK_RPAREN  */
+  YYSYMBOL_TOK_NEWLINE = 19,               /* TOK_NEWLINE  */
+  YYSYMBOL_TOK_COMMA = 20,                 /* TOK_COMMA  */
+  YYSYMBOL_TOK_NUMBER_LITERAL = 21,        /* TOK_NUMBER_LITERAL  */
+  YYSYMBOL_TOK_CHAR_LITERAL = 22,          /* TOK_CHAR_LITERAL  */
+  YYSYMBOL_TOK_STRING_LITERAL = 23,        /* TOK_STRING_LITERAL  */
+  YYSYMBOL_TOK_IDENTIFIER = 24,            /* TOK_IDENTIFIER  */
+  YYSYMBOL_YYACCEPT = 25,                  /* $accept  */
+  YYSYMBOL_program = 26,                   /* program  */
+  YYSYMBOL_line_list = 27,                 /* line_list  */
+  YYSYMBOL_line = 28,                      /* line  */
+  YYSYMBOL_statement = 29,                 /* statement  */
+  YYSYMBOL_declaration = 30,               /* declaration  */
+  YYSYMBOL_single_decl = 31,               /* single_decl  */
+  YYSYMBOL_decl_continuation = 32,         /* decl_continuation  */
+  YYSYMBOL_assignment = 33,                /* assignment  */
+  YYSYMBOL_compound_assign = 34,           /* compound_assign  */
+  YYSYMBOL_shw_statement = 35,             /* shw_statement  */
+  YYSYMBOL_shw_expr = 36,                  /* shw_expr  */
+  YYSYMBOL_shw_item = 37,                  /* shw_item  */
+  YYSYMBOL_expr = 38,                      /* expr  */
+  YYSYMBOL_term = 39,                      /* term  */
+  YYSYMBOL_factor = 40                     /* factor  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-/* In a future release of Bison, this section will be replaced
-   by #include "parser.tab.h".  */
-#ifndef YY_YY_PARSER_TAB_H_INCLUDED
-# define YY_YY_PARSER_TAB_H_INCLUDED
-/* Enabling traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
-#endif
-#if YYDEBUG
-extern int yydebug;
-#endif
 
-/* Tokens.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     TOK_NMBR = 258,
-     TOK_CHR = 259,
-     TOK_FLEX = 260,
-     TOK_SHW = 261,
-     TOK_PLUS = 262,
-     TOK_MINUS = 263,
-     TOK_MULT = 264,
-     TOK_DIV = 265,
-     TOK_PLUS_ASSIGN = 266,
-     TOK_MINUS_ASSIGN = 267,
-     TOK_MULT_ASSIGN = 268,
-     TOK_DIV_ASSIGN = 269,
-     TOK_ASSIGN = 270,
-     TOK_CONCAT = 271,
-     TOK_LPAREN = 272,
-     TOK_RPAREN = 273,
-     TOK_NEWLINE = 274,
-     TOK_COMMA = 275,
-     TOK_NUMBER_LITERAL = 276,
-     TOK_CHAR_LITERAL = 277,
-     TOK_STRING_LITERAL = 278,
-     TOK_IDENTIFIER = 279
-   };
-#endif
 
+/* Unqualified %code blocks.  */
+#line 29 "parser.y"
 
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
-{
-/* Line 387 of yacc.c  */
-#line 27 "parser.y"
-
-    int num;
-    char ch;
-    char *str;
-    struct ASTNode *node;
-    int vartype;
-
-
-/* Line 387 of yacc.c  */
-#line 170 "parser.tab.c"
-} YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
-#endif
+int yylex(YYSTYPE *lval, struct Compiler *cc);
+void yyerror(struct Compiler *cc, const char *s);
 
-extern YYSTYPE yylval;
+#line 171 "parser.tab.c"
 
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void);
-#else
-int yyparse ();
+#ifdef short
+# undef short
 #endif
-#endif /* ! YYPARSE_PARAM */
 
-#endif /* !YY_YY_PARSER_TAB_H_INCLUDED  */
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
 
-/* Copy the second part of user declarations.  */
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
 
-/* Line 390 of yacc.c  */
-#line 198 "parser.tab.c"
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
 
-#ifdef short
-# undef short
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef unsigned char yytype_uint8;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#elif (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-typedef signed char yytype_int8;
-#else
-typedef short int yytype_int8;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -232,16 +261,28 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
@@ -255,32 +296,71 @@ typedef short int yytype_int16;
 # endif
 #endif
 
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-/* Identity function, used to suppress warnings about constant conditions.  */
-#ifndef lint
-# define YYID(N) (N)
-#else
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static int
-YYID (int yyi)
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
 #else
-static int
-YYID (yyi)
-    int yyi;
+# define YY_INITIAL_VALUE(Value) Value
 #endif
-{
-  return yyi;
-}
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -297,8 +377,7 @@ YYID (yyi)
 #    define alloca _alloca
 #   else
 #    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
 #     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
       /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
 #     ifndef EXIT_SUCCESS
@@ -310,8 +389,8 @@ YYID (yyi)
 # endif
 
 # ifdef YYSTACK_ALLOC
-   /* Pacify GCC's `empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (YYID (0))
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
     /* The OS might guarantee only one guard page at the bottom of the stack,
        and a page size can be as small as 4096 bytes.  So we cannot safely
@@ -327,7 +406,7 @@ YYID (yyi)
 #  endif
 #  if (defined __cplusplus && ! defined EXIT_SUCCESS \
        && ! ((defined YYMALLOC || defined malloc) \
-	     && (defined YYFREE || defined free)))
+             && (defined YYFREE || defined free)))
 #   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
 #   ifndef EXIT_SUCCESS
 #    define EXIT_SUCCESS 0
@@ -335,40 +414,37 @@ YYID (yyi)
 #  endif
 #  ifndef YYMALLOC
 #   define YYMALLOC malloc
-#   if ! defined malloc && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined malloc && ! defined EXIT_SUCCESS
 void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 #  ifndef YYFREE
 #   define YYFREE free
-#   if ! defined free && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined free && ! defined EXIT_SUCCESS
 void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
-	 || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -378,16 +454,16 @@ union yyalloc
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-# define YYSTACK_RELOCATE(Stack_alloc, Stack)				\
-    do									\
-      {									\
-	YYSIZE_T yynewbytes;						\
-	YYCOPY (&yyptr->Stack_alloc, Stack, yysize);			\
-	Stack = &yyptr->Stack_alloc;					\
-	yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-	yyptr += yynewbytes / sizeof (*yyptr);				\
-      }									\
-    while (YYID (0))
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
 #endif
 
@@ -397,16 +473,16 @@ union yyalloc
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
 #   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, (Count) * sizeof (*(Src)))
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
 #   define YYCOPY(Dst, Src, Count)              \
       do                                        \
         {                                       \
-          YYSIZE_T yyi;                         \
+          YYPTRDIFF_T yyi;                      \
           for (yyi = 0; yyi < (Count); yyi++)   \
             (Dst)[yyi] = (Src)[yyi];            \
         }                                       \
-      while (YYID (0))
+      while (0)
 #  endif
 # endif
 #endif /* !YYCOPY_NEEDED */
@@ -422,18 +498,23 @@ union yyalloc
 #define YYNNTS  16
 /* YYNRULES -- Number of rules.  */
 #define YYNRULES  47
-/* YYNRULES -- Number of states.  */
+/* YYNSTATES -- Number of states.  */
 #define YYNSTATES  76
 
-/* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   279
 
-#define YYTRANSLATE(YYX)						\
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
 
-/* YYTRANSLATE[YYLEX] -- Bison symbol number corresponding to YYLEX.  */
-static const yytype_uint8 yytranslate[] =
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -466,121 +547,59 @@ static const yytype_uint8 yytranslate[] =
 };
 
 #if YYDEBUG
-/* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-   YYRHS.  */
-static const yytype_uint8 yyprhs[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,     0,     3,     5,     8,    10,    11,    14,    16,    19,
-      21,    24,    26,    28,    30,    32,    35,    40,    43,    48,
-      51,    56,    59,    60,    64,    70,    74,    78,    82,    86,
-      90,    94,    97,    99,   103,   105,   107,   111,   115,   117,
-     121,   125,   127,   129,   131,   133,   137,   140
+       0,    83,    83,    87,    91,    96,   103,   111,   121,   122,
+     123,   127,   128,   129,   130,   135,   148,   153,   159,   164,
+     170,   174,   185,   188,   196,   204,   214,   220,   224,   228,
+     232,   239,   245,   246,   252,   253,   257,   258,   259,   263,
+     264,   265,   269,   270,   271,   274,   275,   283
 };
+#endif
 
-/* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-static const yytype_int8 yyrhs[] =
-{
-      26,     0,    -1,    27,    -1,    27,    29,    -1,    29,    -1,
-      -1,    27,    28,    -1,    28,    -1,    29,    19,    -1,    19,
-      -1,     1,    19,    -1,    30,    -1,    33,    -1,    34,    -1,
-      35,    -1,    31,    32,    -1,     3,    24,    15,    38,    -1,
-       3,    24,    -1,     4,    24,    15,    38,    -1,     4,    24,
-      -1,     5,    24,    15,    38,    -1,     5,    24,    -1,    -1,
-      20,    24,    32,    -1,    20,    24,    15,    38,    32,    -1,
-      20,    31,    32,    -1,    24,    15,    38,    -1,    24,    11,
-      38,    -1,    24,    12,    38,    -1,    24,    13,    38,    -1,
-      24,    14,    38,    -1,     6,    36,    -1,    37,    -1,    36,
-      16,    37,    -1,    23,    -1,    38,    -1,    38,     7,    39,
-      -1,    38,     8,    39,    -1,    39,    -1,    39,     9,    40,
-      -1,    39,    10,    40,    -1,    40,    -1,    21,    -1,    22,
-      -1,    24,    -1,    17,    38,    18,    -1,     8,    40,    -1,
-       7,    40,    -1
-};
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
 
-/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
-{
-       0,    76,    76,    80,    84,    89,    96,   104,   114,   115,
-     116,   120,   121,   122,   123,   128,   141,   146,   152,   157,
-     163,   167,   178,   181,   189,   197,   207,   213,   217,   221,
-     225,   232,   238,   239,   245,   246,   250,   251,   252,   256,
-     257,   258,   262,   263,   264,   267,   268,   276
-};
-#endif
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "TOK_NMBR", "TOK_CHR", "TOK_FLEX",
-  "TOK_SHW", "TOK_PLUS", "TOK_MINUS", "TOK_MULT", "TOK_DIV",
+  "\"end of file\"", "error", "\"invalid token\"", "TOK_NMBR", "TOK_CHR",
+  "TOK_FLEX", "TOK_SHW", "TOK_PLUS", "TOK_MINUS", "TOK_MULT", "TOK_DIV",
   "TOK_PLUS_ASSIGN", "TOK_MINUS_ASSIGN", "TOK_MULT_ASSIGN",
   "TOK_DIV_ASSIGN", "TOK_ASSIGN", "TOK_CONCAT", "TOK_LPAREN", "TOK_RPAREN",
   "TOK_NEWLINE", "TOK_COMMA", "TOK_NUMBER_LITERAL", "TOK_CHAR_LITERAL",
   "TOK_STRING_LITERAL", "TOK_IDENTIFIER", "$accept", "program",
   "line_list", "line", "statement", "declaration", "single_decl",
   "decl_continuation", "assignment", "compound_assign", "shw_statement",
-  "shw_expr", "shw_item", "expr", "term", "factor", YY_NULL
+  "shw_expr", "shw_item", "expr", "term", "factor", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[YYLEX-NUM] -- Internal token number corresponding to
-   token YYLEX-NUM.  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-/* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint8 yyr1[] =
-{
-       0,    25,    26,    26,    26,    26,    27,    27,    28,    28,
-      28,    29,    29,    29,    29,    30,    31,    31,    31,    31,
-      31,    31,    32,    32,    32,    32,    33,    34,    34,    34,
-      34,    35,    36,    36,    37,    37,    38,    38,    38,    39,
-      39,    39,    40,    40,    40,    40,    40,    40
-};
+#define YYPACT_NINF (-55)
 
-/* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
-{
-       0,     2,     1,     2,     1,     0,     2,     1,     2,     1,
-       2,     1,     1,     1,     1,     2,     4,     2,     4,     2,
-       4,     2,     0,     3,     5,     3,     3,     3,     3,     3,
-       3,     2,     1,     3,     1,     1,     3,     3,     1,     3,
-       3,     1,     1,     1,     1,     3,     2,     2
-};
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-/* YYDEFACT[STATE-NAME] -- Default reduction number in state STATE-NUM.
-   Performed when YYTABLE doesn't specify something else to do.  Zero
-   means the default is an error.  */
-static const yytype_uint8 yydefact[] =
-{
-       0,     0,     0,     0,     0,     0,     9,     0,     0,     0,
-       7,     4,    11,    22,    12,    13,    14,    10,    17,    19,
-      21,     0,     0,     0,    42,    43,    34,    44,    31,    32,
-      35,    38,    41,     0,     0,     0,     0,     0,     1,     6,
-       3,     8,     0,    15,     0,     0,     0,    47,    46,     0,
-       0,     0,     0,     0,     0,    27,    28,    29,    30,    26,
-      22,    22,    16,    18,    20,    45,    33,    36,    37,    39,
-      40,     0,    23,    25,    22,    24
-};
+#define YYTABLE_NINF (-6)
 
-/* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int8 yydefgoto[] =
-{
-      -1,     8,     9,    10,    11,    12,    13,    43,    14,    15,
-      16,    28,    29,    30,    31,    32
-};
+#define yytable_value_is_error(Yyn) \
+  0
 
 /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
    STATE-NUM.  */
-#define YYPACT_NINF -55
 static const yytype_int8 yypact[] =
 {
       25,    18,    21,    26,    29,    39,   -55,    64,    55,    35,
@@ -593,6 +612,21 @@ static const yytype_int8 yypact[] =
      -55,    50,   -55,   -55,    44,   -55
 };
 
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
+{
+       0,     0,     0,     0,     0,     0,     9,     0,     0,     0,
+       7,     4,    11,    22,    12,    13,    14,    10,    17,    19,
+      21,     0,     0,     0,    42,    43,    34,    44,    31,    32,
+      35,    38,    41,     0,     0,     0,     0,     0,     1,     6,
+       3,     8,     0,    15,     0,     0,     0,    47,    46,     0,
+       0,     0,     0,     0,     0,    27,    28,    29,    30,    26,
+      22,    22,    16,    18,    20,    45,    33,    36,    37,    39,
+      40,     0,    23,    25,    22,    24
+};
+
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int8 yypgoto[] =
 {
@@ -600,10 +634,16 @@ static const yytype_int8 yypgoto[] =
      -55,   -55,    34,   -23,   -34,   -20
 };
 
-/* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule which
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int8 yydefgoto[] =
+{
+       0,     8,     9,    10,    11,    12,    13,    43,    14,    15,
+      16,    28,    29,    30,    31,    32
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -6
 static const yytype_int8 yytable[] =
 {
       49,    47,    48,     2,     3,     4,    72,    73,    51,    52,
@@ -617,12 +657,6 @@ static const yytype_int8 yytable[] =
       40,    50,    61,     0,    66
 };
 
-#define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-55)))
-
-#define yytable_value_is_error(Yytable_value) \
-  YYID (0)
-
 static const yytype_int8 yycheck[] =
 {
       23,    21,    22,     3,     4,     5,    60,    61,     7,     8,
@@ -636,9 +670,9 @@ static const yytype_int8 yycheck[] =
        9,    16,    42,    -1,    50
 };
 
-/* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-   symbol of state STATE-NUM.  */
-static const yytype_uint8 yystos[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
 {
        0,     1,     3,     4,     5,     6,    19,    24,    26,    27,
       28,    29,    30,    31,    33,    34,    35,    19,    24,    24,
@@ -650,67 +684,61 @@ static const yytype_uint8 yystos[] =
       40,    15,    32,    32,    38,    32
 };
 
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		(-2)
-#define YYEOF		0
-
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrorlab
-
-
-/* Like YYERROR except do call yyerror.  This remains here temporarily
-   to ease the transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  However,
-   YYFAIL appears to be in use.  Nevertheless, it is formally deprecated
-   in Bison 2.4.2's NEWS entry, where a plan to phase it out is
-   discussed.  */
-
-#define YYFAIL		goto yyerrlab
-#if defined YYFAIL
-  /* This is here to suppress warnings from the GCC cpp's
-     -Wunused-macros.  Normally we don't worry about that warning, but
-     some users do, and we want to make it easy for users to remove
-     YYFAIL uses, which will produce warnings from Bison 2.5.  */
-#endif
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    25,    26,    26,    26,    26,    27,    27,    28,    28,
+      28,    29,    29,    29,    29,    30,    31,    31,    31,    31,
+      31,    31,    32,    32,    32,    32,    33,    34,    34,    34,
+      34,    35,    36,    36,    37,    37,    38,    38,    38,    39,
+      39,    39,    40,    40,    40,    40,    40,    40
+};
 
-#define YYRECOVERING()  (!!yyerrstatus)
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     2,     1,     0,     2,     1,     2,     1,
+       2,     1,     1,     1,     1,     2,     4,     2,     4,     2,
+       4,     2,     0,     3,     5,     3,     3,     3,     3,     3,
+       3,     2,     1,     3,     1,     1,     3,     3,     1,     3,
+       3,     1,     1,     1,     1,     3,     2,     2
+};
 
-#define YYBACKUP(Token, Value)                                  \
-do                                                              \
-  if (yychar == YYEMPTY)                                        \
-    {                                                           \
-      yychar = (Token);                                         \
-      yylval = (Value);                                         \
-      YYPOPSTACK (yylen);                                       \
-      yystate = *yyssp;                                         \
-      goto yybackup;                                            \
-    }                                                           \
-  else                                                          \
-    {                                                           \
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;							\
-    }								\
-while (YYID (0))
-
-/* Error token number */
-#define YYTERROR	1
-#define YYERRCODE	256
-
-
-/* This macro is provided for backward compatibility. */
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
 
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (cc, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
-/* YYLEX -- calling `yylex' with the right arguments.  */
-#ifdef YYLEX_PARAM
-# define YYLEX yylex (YYLEX_PARAM)
-#else
-# define YYLEX yylex ()
-#endif
 
 /* Enable debugging if requested.  */
 #if YYDEBUG
@@ -720,82 +748,59 @@ while (YYID (0))
 #  define YYFPRINTF fprintf
 # endif
 
-# define YYDPRINTF(Args)			\
-do {						\
-  if (yydebug)					\
-    YYFPRINTF Args;				\
-} while (YYID (0))
-
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)			  \
-do {									  \
-  if (yydebug)								  \
-    {									  \
-      YYFPRINTF (stderr, "%s ", Title);					  \
-      yy_symbol_print (stderr,						  \
-		  Type, Value); \
-      YYFPRINTF (stderr, "\n");						  \
-    }									  \
-} while (YYID (0))
-
-
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, cc); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
 static void
-yy_symbol_value_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, struct Compiler *cc)
 {
-  FILE *yyo = yyoutput;
-  YYUSE (yyo);
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (cc);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# else
-  YYUSE (yyoutput);
-# endif
-  switch (yytype)
-    {
-      default:
-        break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
 static void
-yy_symbol_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, struct Compiler *cc)
 {
-  if (yytype < YYNTOKENS)
-    YYFPRINTF (yyoutput, "token %s (", yytname[yytype]);
-  else
-    YYFPRINTF (yyoutput, "nterm %s (", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, cc);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -803,16 +808,8 @@ yy_symbol_print (yyoutput, yytype, yyvaluep)
 | TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
-#else
-static void
-yy_stack_print (yybottom, yytop)
-    yytype_int16 *yybottom;
-    yytype_int16 *yytop;
-#endif
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -823,63 +820,56 @@ yy_stack_print (yybottom, yytop)
   YYFPRINTF (stderr, "\n");
 }
 
-# define YY_STACK_PRINT(Bottom, Top)				\
-do {								\
-  if (yydebug)							\
-    yy_stack_print ((Bottom), (Top));				\
-} while (YYID (0))
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
 
 /*------------------------------------------------.
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_reduce_print (YYSTYPE *yyvsp, int yyrule)
-#else
 static void
-yy_reduce_print (yyvsp, yyrule)
-    YYSTYPE *yyvsp;
-    int yyrule;
-#endif
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule, struct Compiler *cc)
 {
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  unsigned long int yylno = yyrline[yyrule];
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
-	     yyrule - 1, yylno);
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr, yyrhs[yyprhs[yyrule] + yyi],
-		       &(yyvsp[(yyi + 1) - (yynrhs)])
-		       		       );
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)], cc);
       YYFPRINTF (stderr, "\n");
     }
 }
 
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug)				\
-    yy_reduce_print (yyvsp, Rule); \
-} while (YYID (0))
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule, cc); \
+} while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
 
 
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef	YYINITDEPTH
+#ifndef YYINITDEPTH
 # define YYINITDEPTH 200
 #endif
 
@@ -895,363 +885,84 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static YYSIZE_T
-yystrlen (const char *yystr)
-#else
-static YYSIZE_T
-yystrlen (yystr)
-    const char *yystr;
-#endif
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-#else
-static char *
-yystpcpy (yydest, yysrc)
-    char *yydest;
-    const char *yysrc;
-#endif
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-	switch (*++yyp)
-	  {
-	  case '\'':
-	  case ',':
-	    goto do_not_strip_quotes;
-
-	  case '\\':
-	    if (*++yyp != '\\')
-	      goto do_not_strip_quotes;
-	    /* Fall through.  */
-	  default:
-	    if (yyres)
-	      yyres[yyn] = *yyp;
-	    yyn++;
-	    break;
-
-	  case '"':
-	    if (yyres)
-	      yyres[yyn] = '\0';
-	    return yyn;
-	  }
-    do_not_strip_quotes: ;
-    }
-
-  if (! yyres)
-    return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
 
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
-
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
-{
-  YYSIZE_T yysize0 = yytnamerr (YY_NULL, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULL;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
-  int yycount = 0;
-
-  /* There are many possibilities here to consider:
-     - Assume YYFAIL is not used.  It's too flawed to consider.  See
-       <http://lists.gnu.org/archive/html/bison-patches/2009-12/msg00024.html>
-       for details.  YYERROR is fine as it does not invoke this
-       function.
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYSIZE_T yysize1 = yysize + yytnamerr (YY_NULL, yytname[yyx]);
-                  if (! (yysize <= yysize1
-                         && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                    return 2;
-                  yysize = yysize1;
-                }
-              }
-        }
-    }
 
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
 
-  {
-    YYSIZE_T yysize1 = yysize + yystrlen (yyformat);
-    if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-      return 2;
-    yysize = yysize1;
-  }
-
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
-
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          yyp++;
-          yyformat++;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
-#else
-static void
-yydestruct (yymsg, yytype, yyvaluep)
-    const char *yymsg;
-    int yytype;
-    YYSTYPE *yyvaluep;
-#endif
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, struct Compiler *cc)
 {
-  YYUSE (yyvaluep);
-
+  YY_USE (yyvaluep);
+  YY_USE (cc);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
-
-  switch (yytype)
-    {
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-      default:
-        break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
 
 
-/* The lookahead symbol.  */
-int yychar;
-
-
-#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END
-#endif
-#ifndef YY_INITIAL_VALUE
-# define YY_INITIAL_VALUE(Value) /* Nothing. */
-#endif
-
-/* The semantic value of the lookahead symbol.  */
-YYSTYPE yylval YY_INITIAL_VALUE(yyval_default);
-
-/* Number of syntax errors so far.  */
-int yynerrs;
 
 
 /*----------.
 | yyparse.  |
 `----------*/
 
-#ifdef YYPARSE_PARAM
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void *YYPARSE_PARAM)
-#else
-int
-yyparse (YYPARSE_PARAM)
-    void *YYPARSE_PARAM;
-#endif
-#else /* ! YYPARSE_PARAM */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void)
-#else
 int
-yyparse ()
-
-#endif
-#endif
+yyparse (struct Compiler *cc)
 {
-    int yystate;
-    /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
+/* Lookahead token kind.  */
+int yychar;
+
 
-    /* The stacks and their tools:
-       `yyss': related to states.
-       `yyvs': related to semantic values.
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
 
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    YYSIZE_T yystacksize;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -1259,102 +970,107 @@ yyparse ()
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
-	/* Give user a chance to reallocate the stack.  Use copies of
-	   these so that the &'s don't force the real ones into
-	   memory.  */
-	YYSTYPE *yyvs1 = yyvs;
-	yytype_int16 *yyss1 = yyss;
-
-	/* Each stack pointer address is followed by the size of the
-	   data in use in that stack, in bytes.  This used to be a
-	   conditional around just the two extra args, but that might
-	   be undefined if yyoverflow is a macro.  */
-	yyoverflow (YY_("memory exhausted"),
-		    &yyss1, yysize * sizeof (*yyssp),
-		    &yyvs1, yysize * sizeof (*yyvsp),
-		    &yystacksize);
-
-	yyss = yyss1;
-	yyvs = yyvs1;
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-	goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
-	yystacksize = YYMAXDEPTH;
+        yystacksize = YYMAXDEPTH;
 
       {
-	yytype_int16 *yyss1 = yyss;
-	union yyalloc *yyptr =
-	  (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
-	if (! yyptr)
-	  goto yyexhaustedlab;
-	YYSTACK_RELOCATE (yyss_alloc, yyss);
-	YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
-	if (yyss1 != yyssa)
-	  YYSTACK_FREE (yyss1);
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-		  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
-	YYABORT;
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -1365,18 +1081,29 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = YYLEX;
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval, cc);
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -1404,15 +1131,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -1427,14 +1152,14 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
 
   /* If YYLEN is nonzero, implement the default value of the action:
-     `$$ = $1'.
+     '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
      This behavior is undocumented and Bison
@@ -1447,397 +1172,397 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
-/* Line 1792 of yacc.c  */
-#line 76 "parser.y"
-    { 
-            root = (yyvsp[(1) - (1)].node); 
-            (yyval.node) = (yyvsp[(1) - (1)].node);
+  case 2: /* program: line_list  */
+#line 83 "parser.y"
+                  { //Handles programs that are just lines (which can contain statements via line ->statement TOK_NEWLINE
+            cc->root = (yyvsp[0].node); 
+            (yyval.node) = (yyvsp[0].node);
         }
+#line 1182 "parser.tab.c"
     break;
 
-  case 3:
-/* Line 1792 of yacc.c  */
-#line 80 "parser.y"
-    {
-            root = ast_add_stmt((yyvsp[(1) - (2)].node), (yyvsp[(2) - (2)].node));
-            (yyval.node) = root;
+  case 3: /* program: line_list statement  */
+#line 87 "parser.y"
+                          {//handles statement without newline at EOF
+            cc->root = ast_add_stmt((yyvsp[-1].node), (yyvsp[0].node));
+            (yyval.node) = cc->root;
         }
+#line 1191 "parser.tab.c"
     break;
 
-  case 4:
-/* Line 1792 of yacc.c  */
-#line 84 "parser.y"
-    {
-            root = ast_create_program();
-            root = ast_add_stmt(root, (yyvsp[(1) - (1)].node));
-            (yyval.node) = root;
+  case 4: /* program: statement  */
+#line 91 "parser.y"
+                {
+            cc->root = ast_create_program();
+            cc->root = ast_add_stmt(cc->root, (yyvsp[0].node));
+            (yyval.node) = cc->root;
         }
+#line 1201 "parser.tab.c"
     break;
 
-  case 5:
-/* Line 1792 of yacc.c  */
-#line 89 "parser.y"
-    { 
-            root = ast_create_program(); 
-            (yyval.node) = root; 
+  case 5: /* program: %empty  */
+#line 96 "parser.y"
+                  { 
+            cc->root = ast_create_program(); 
+            (yyval.node) = cc->root; 
         }
+#line 1210 "parser.tab.c"
     break;
 
-  case 6:
-/* Line 1792 of yacc.c  */
-#line 96 "parser.y"
-    {
-            if ((yyvsp[(2) - (2)].node) != NULL) {
-                (yyval.node) = ast_add_stmt((yyvsp[(1) - (2)].node), (yyvsp[(2) - (2)].node));
+  case 6: /* line_list: line_list line  */
+#line 103 "parser.y"
+                       {
+            if ((yyvsp[0].node) != NULL) {
+                (yyval.node) = ast_add_stmt((yyvsp[-1].node), (yyvsp[0].node));
             } else {
-                (yyval.node) = (yyvsp[(1) - (2)].node);
+                (yyval.node) = (yyvsp[-1].node);
             }
-            lineCount++;
+            cc->lineCount++;
         }
+#line 1223 "parser.tab.c"
     break;
 
-  case 7:
-/* Line 1792 of yacc.c  */
-#line 104 "parser.y"
-    {
+  case 7: /* line_list: line  */
+#line 111 "parser.y"
+               {
             (yyval.node) = ast_create_program();
-            if ((yyvsp[(1) - (1)].node) != NULL) {
-                (yyval.node) = ast_add_stmt((yyval.node), (yyvsp[(1) - (1)].node));
+            if ((yyvsp[0].node) != NULL) {
+                (yyval.node) = ast_add_stmt((yyval.node), (yyvsp[0].node));
             }
-            lineCount++;
+            cc->lineCount++;
         }
+#line 1235 "parser.tab.c"
     break;
 
-  case 8:
-/* Line 1792 of yacc.c  */
-#line 114 "parser.y"
-    { (yyval.node) = (yyvsp[(1) - (2)].node); }
+  case 8: /* line: statement TOK_NEWLINE  */
+#line 121 "parser.y"
+                                { (yyval.node) = (yyvsp[-1].node); }
+#line 1241 "parser.tab.c"
     break;
 
-  case 9:
-/* Line 1792 of yacc.c  */
-#line 115 "parser.y"
-    { (yyval.node) = NULL; }
+  case 9: /* line: TOK_NEWLINE  */
+#line 122 "parser.y"
+                                { (yyval.node) = NULL; }
+#line 1247 "parser.tab.c"
     break;
 
-  case 10:
-/* Line 1792 of yacc.c  */
-#line 116 "parser.y"
-    { error_count++; yyerrok; (yyval.node) = NULL; }
+  case 10: /* line: error TOK_NEWLINE  */
+#line 123 "parser.y"
+                                { cc->errorCount++; yyerrok; (yyval.node) = NULL; }
+#line 1253 "parser.tab.c"
     break;
 
-  case 11:
-/* Line 1792 of yacc.c  */
-#line 120 "parser.y"
-    { (yyval.node) = (yyvsp[(1) - (1)].node); }
+  case 11: /* statement: declaration  */
+#line 127 "parser.y"
+                          { (yyval.node) = (yyvsp[0].node); }
+#line 1259 "parser.tab.c"
     break;
 
-  case 12:
-/* Line 1792 of yacc.c  */
-#line 121 "parser.y"
-    { (yyval.node) = (yyvsp[(1) - (1)].node); }
+  case 12: /* statement: assignment  */
+#line 128 "parser.y"
+                            { (yyval.node) = (yyvsp[0].node); }
+#line 1265 "parser.tab.c"
     break;
 
-  case 13:
-/* Line 1792 of yacc.c  */
-#line 122 "parser.y"
-    { (yyval.node) = (yyvsp[(1) - (1)].node); }
+  case 13: /* statement: compound_assign  */
+#line 129 "parser.y"
+                            { (yyval.node) = (yyvsp[0].node); }
+#line 1271 "parser.tab.c"
     break;
 
-  case 14:
-/* Line 1792 of yacc.c  */
-#line 123 "parser.y"
-    { (yyval.node) = (yyvsp[(1) - (1)].node); }
+  case 14: /* statement: shw_statement  */
+#line 130 "parser.y"
+                            { (yyval.node) = (yyvsp[0].node); }
+#line 1277 "parser.tab.c"
     break;
 
-  case 15:
-/* Line 1792 of yacc.c  */
-#line 128 "parser.y"
-    {
-            if ((yyvsp[(2) - (2)].node) == NULL) {
+  case 15: /* declaration: single_decl decl_continuation  */
+#line 135 "parser.y"
+                                      {
+            if ((yyvsp[0].node) == NULL) {
                 /* No continuation - just a single declaration */
-                (yyval.node) = (yyvsp[(1) - (2)].node);
+                (yyval.node) = (yyvsp[-1].node);
             } else {
                 /* Has continuation - need to combine them */
-                (yyval.node) = ast_create_decl_list((yyvsp[(1) - (2)].node), (yyvsp[(2) - (2)].node), lineCount);
+                (yyval.node) = ast_create_decl_list((yyvsp[-1].node), (yyvsp[0].node), cc->lineCount);
             }
         }
+#line 1291 "parser.tab.c"
     break;
 
-  case 16:
-/* Line 1792 of yacc.c  */
-#line 141 "parser.y"
-    {
-            current_decl_type = TYPE_NMBR;
-            (yyval.node) = ast_create_decl(TYPE_NMBR, (yyvsp[(2) - (4)].str), (yyvsp[(4) - (4)].node), lineCount);
+  case 16: /* single_decl: TOK_NMBR TOK_IDENTIFIER TOK_ASSIGN expr  */
+#line 148 "parser.y"
+                                                {
+            cc->declType = TYPE_NMBR;
+            (yyval.node) = ast_create_decl(TYPE_NMBR, name_atom(cc, (yyvsp[-2].slice)), (yyvsp[0].node), cc->lineCount);
            
         }
+#line 1301 "parser.tab.c"
     break;
 
-  case 17:
-/* Line 1792 of yacc.c  */
-#line 146 "parser.y"
-    {
-            current_decl_type = TYPE_NMBR;
-            ASTNode *init = ast_create_num_lit(0, lineCount);
-            (yyval.node) = ast_create_decl(TYPE_NMBR, (yyvsp[(2) - (2)].str), init, lineCount);
+  case 17: /* single_decl: TOK_NMBR TOK_IDENTIFIER  */
+#line 153 "parser.y"
+                                  {
+            cc->declType = TYPE_NMBR;
+            ASTNode *init = ast_create_num_lit(0, cc->lineCount);
+            (yyval.node) = ast_create_decl(TYPE_NMBR, name_atom(cc, (yyvsp[0].slice)), init, cc->lineCount);
             
         }
+#line 1312 "parser.tab.c"
     break;
 
-  case 18:
-/* Line 1792 of yacc.c  */
-#line 152 "parser.y"
-    {
-            current_decl_type = TYPE_CHR;
-            (yyval.node) = ast_create_decl(TYPE_CHR, (yyvsp[(2) - (4)].str), (yyvsp[(4) - (4)].node), lineCount);
+  case 18: /* single_decl: TOK_CHR TOK_IDENTIFIER TOK_ASSIGN expr  */
+#line 159 "parser.y"
+                                                 {
+            cc->declType = TYPE_CHR;
+            (yyval.node) = ast_create_decl(TYPE_CHR, name_atom(cc, (yyvsp[-2].slice)), (yyvsp[0].node), cc->lineCount);
             
         }
+#line 1322 "parser.tab.c"
     break;
 
-  case 19:
-/* Line 1792 of yacc.c  */
-#line 157 "parser.y"
-    {
-            current_decl_type = TYPE_CHR;
-            ASTNode *init = ast_create_chr_lit('\0', lineCount);
-            (yyval.node) = ast_create_decl(TYPE_CHR, (yyvsp[(2) - (2)].str), init, lineCount);
+  case 19: /* single_decl: TOK_CHR TOK_IDENTIFIER  */
+#line 164 "parser.y"
+                                 {
+            cc->declType = TYPE_CHR;
+            ASTNode *init = ast_create_chr_lit('\0', cc->lineCount);
+            (yyval.node) = ast_create_decl(TYPE_CHR, name_atom(cc, (yyvsp[0].slice)), init, cc->lineCount);
 
         }
+#line 1333 "parser.tab.c"
     break;
 
-  case 20:
-/* Line 1792 of yacc.c  */
-#line 163 "parser.y"
-    {
-            current_decl_type = TYPE_FLEX;
-            (yyval.node) = ast_create_decl(TYPE_FLEX, (yyvsp[(2) - (4)].str), (yyvsp[(4) - (4)].node), lineCount);
+  case 20: /* single_decl: TOK_FLEX TOK_IDENTIFIER TOK_ASSIGN expr  */
+#line 170 "parser.y"
+                                                  {
+            cc->declType = TYPE_FLEX;
+            (yyval.node) = ast_create_decl(TYPE_FLEX, name_atom(cc, (yyvsp[-2].slice)), (yyvsp[0].node), cc->lineCount);
         }
+#line 1342 "parser.tab.c"
     break;
 
-  case 21:
-/* Line 1792 of yacc.c  */
-#line 167 "parser.y"
-    {
-            current_decl_type = TYPE_FLEX;
+  case 21: /* single_decl: TOK_FLEX TOK_IDENTIFIER  */
+#line 174 "parser.y"
+                                  {
+            cc->declType = TYPE_FLEX;
     
-            ASTNode *init = ast_create_str_lit("", lineCount);
-            (yyval.node) = ast_create_decl(TYPE_FLEX, (yyvsp[(2) - (2)].str), init, lineCount);
+            ASTNode *init = string_literal(cc, (TokenSlice){"", 0, 0});
+            (yyval.node) = ast_create_decl(TYPE_FLEX, name_atom(cc, (yyvsp[0].slice)), init, cc->lineCount);
             
         }
+#line 1354 "parser.tab.c"
     break;
 
-  case 22:
-/* Line 1792 of yacc.c  */
-#line 178 "parser.y"
-    { 
+  case 22: /* decl_continuation: %empty  */
+#line 185 "parser.y"
+                    { 
             (yyval.node) = NULL; 
         }
+#line 1362 "parser.tab.c"
     break;
 
-  case 23:
-/* Line 1792 of yacc.c  */
-#line 181 "parser.y"
-    {
-            ASTNode *item = ast_create_name_item_typed((yyvsp[(2) - (3)].str), NULL, current_decl_type, lineCount);
-            if ((yyvsp[(3) - (3)].node) == NULL) {
+  case 23: /* decl_continuation: TOK_COMMA TOK_IDENTIFIER decl_continuation  */
+#line 188 "parser.y"
+                                                     {
+            ASTNode *item = ast_create_name_item_typed(name_atom(cc, (yyvsp[-1].slice)), NULL, cc->declType, cc->lineCount);
+            if ((yyvsp[0].node) == NULL) {
                 (yyval.node) = item;
             } else {
-                (yyval.node) = ast_create_name_list(item, (yyvsp[(3) - (3)].node), lineCount);
+                (yyval.node) = ast_create_name_list(item, (yyvsp[0].node), cc->lineCount);
             }
         }
+#line 1375 "parser.tab.c"
     break;
 
-  case 24:
-/* Line 1792 of yacc.c  */
-#line 189 "parser.y"
-    {
-            ASTNode *item = ast_create_name_item_typed((yyvsp[(2) - (5)].str), (yyvsp[(4) - (5)].node), current_decl_type, lineCount);
-            if ((yyvsp[(5) - (5)].node) == NULL) {
+  case 24: /* decl_continuation: TOK_COMMA TOK_IDENTIFIER TOK_ASSIGN expr decl_continuation  */
+#line 196 "parser.y"
+                                                                     {
+            ASTNode *item = ast_create_name_item_typed(name_atom(cc, (yyvsp[-3].slice)), (yyvsp[-1].node), cc->declType, cc->lineCount);
+            if ((yyvsp[0].node) == NULL) {
                 (yyval.node) = item;
             } else {
-                (yyval.node) = ast_create_name_list(item, (yyvsp[(5) - (5)].node), lineCount);
+                (yyval.node) = ast_create_name_list(item, (yyvsp[0].node), cc->lineCount);
             }
         }
+#line 1388 "parser.tab.c"
     break;
 
-  case 25:
-/* Line 1792 of yacc.c  */
-#line 197 "parser.y"
-    {
-            if ((yyvsp[(3) - (3)].node) == NULL) {
-                (yyval.node) = (yyvsp[(2) - (3)].node);
+  case 25: /* decl_continuation: TOK_COMMA single_decl decl_continuation  */
+#line 204 "parser.y"
+                                                  {
+            if ((yyvsp[0].node) == NULL) {
+                (yyval.node) = (yyvsp[-1].node);
             } else {
-                (yyval.node) = ast_create_decl_list((yyvsp[(2) - (3)].node), (yyvsp[(3) - (3)].node), lineCount);
+                (yyval.node) = ast_create_decl_list((yyvsp[-1].node), (yyvsp[0].node), cc->lineCount);
             }
         }
+#line 1400 "parser.tab.c"
     break;
 
-  case 26:
-/* Line 1792 of yacc.c  */
-#line 207 "parser.y"
-    {
-            (yyval.node) = ast_create_assign((yyvsp[(1) - (3)].str), (yyvsp[(3) - (3)].node), lineCount);
+  case 26: /* assignment: TOK_IDENTIFIER TOK_ASSIGN expr  */
+#line 214 "parser.y"
+                                       {
+            (yyval.node) = ast_create_assign(name_atom(cc, (yyvsp[-2].slice)), (yyvsp[0].node), cc->lineCount);
         }
+#line 1408 "parser.tab.c"
     break;
 
-  case 27:
-/* Line 1792 of yacc.c  */
-#line 213 "parser.y"
-    {
+  case 27: /* compound_assign: TOK_IDENTIFIER TOK_PLUS_ASSIGN expr  */
+#line 220 "parser.y"
+                                            {
             
-            (yyval.node) = ast_create_compound_assign((yyvsp[(1) - (3)].str), OP_PLUS_ASSIGN, (yyvsp[(3) - (3)].node), lineCount);
+            (yyval.node) = ast_create_compound_assign(name_atom(cc, (yyvsp[-2].slice)), OP_PLUS_ASSIGN, (yyvsp[0].node), cc->lineCount);
         }
+#line 1417 "parser.tab.c"
     break;
 
-  case 28:
-/* Line 1792 of yacc.c  */
-#line 217 "parser.y"
-    {
+  case 28: /* compound_assign: TOK_IDENTIFIER TOK_MINUS_ASSIGN expr  */
+#line 224 "parser.y"
+                                               {
 
-            (yyval.node) = ast_create_compound_assign((yyvsp[(1) - (3)].str), OP_MINUS_ASSIGN, (yyvsp[(3) - (3)].node), lineCount);
+            (yyval.node) = ast_create_compound_assign(name_atom(cc, (yyvsp[-2].slice)), OP_MINUS_ASSIGN, (yyvsp[0].node), cc->lineCount);
         }
+#line 1426 "parser.tab.c"
     break;
 
-  case 29:
-/* Line 1792 of yacc.c  */
-#line 221 "parser.y"
-    {
+  case 29: /* compound_assign: TOK_IDENTIFIER TOK_MULT_ASSIGN expr  */
+#line 228 "parser.y"
+                                              {
 
-            (yyval.node) = ast_create_compound_assign((yyvsp[(1) - (3)].str), OP_MULT_ASSIGN, (yyvsp[(3) - (3)].node), lineCount);
+            (yyval.node) = ast_create_compound_assign(name_atom(cc, (yyvsp[-2].slice)), OP_MULT_ASSIGN, (yyvsp[0].node), cc->lineCount);
         }
+#line 1435 "parser.tab.c"
     break;
 
-  case 30:
-/* Line 1792 of yacc.c  */
-#line 225 "parser.y"
-    {
+  case 30: /* compound_assign: TOK_IDENTIFIER TOK_DIV_ASSIGN expr  */
+#line 232 "parser.y"
+                                             {
 
-            (yyval.node) = ast_create_compound_assign((yyvsp[(1) - (3)].str), OP_DIV_ASSIGN, (yyvsp[(3) - (3)].node), lineCount);
+            (yyval.node) = ast_create_compound_assign(name_atom(cc, (yyvsp[-2].slice)), OP_DIV_ASSIGN, (yyvsp[0].node), cc->lineCount);
         }
+#line 1444 "parser.tab.c"
     break;
 
-  case 31:
-/* Line 1792 of yacc.c  */
-#line 232 "parser.y"
-    {
-            (yyval.node) = ast_create_shw((yyvsp[(2) - (2)].node), lineCount);
+  case 31: /* shw_statement: TOK_SHW shw_expr  */
+#line 239 "parser.y"
+                         {
+            (yyval.node) = ast_create_shw((yyvsp[0].node), cc->lineCount);
         }
+#line 1452 "parser.tab.c"
     break;
 
-  case 32:
-/* Line 1792 of yacc.c  */
-#line 238 "parser.y"
-    { (yyval.node) = (yyvsp[(1) - (1)].node); }
+  case 32: /* shw_expr: shw_item  */
+#line 245 "parser.y"
+                                      { (yyval.node) = (yyvsp[0].node); }
+#line 1458 "parser.tab.c"
     break;
 
-  case 33:
-/* Line 1792 of yacc.c  */
-#line 239 "parser.y"
-    {
-            (yyval.node) = ast_create_concat((yyvsp[(1) - (3)].node), (yyvsp[(3) - (3)].node), lineCount);
+  case 33: /* shw_expr: shw_expr TOK_CONCAT shw_item  */
+#line 246 "parser.y"
+                                        {
+            (yyval.node) = ast_create_concat((yyvsp[-2].node), (yyvsp[0].node), cc->lineCount);
         }
+#line 1466 "parser.tab.c"
     break;
 
-  case 34:
-/* Line 1792 of yacc.c  */
-#line 245 "parser.y"
-    { (yyval.node) = ast_create_str_lit((yyvsp[(1) - (1)].str), lineCount); }
+  case 34: /* shw_item: TOK_STRING_LITERAL  */
+#line 252 "parser.y"
+                            { (yyval.node) = string_literal(cc, (yyvsp[0].slice)); }
+#line 1472 "parser.tab.c"
     break;
 
-  case 35:
-/* Line 1792 of yacc.c  */
-#line 246 "parser.y"
-    { (yyval.node) = (yyvsp[(1) - (1)].node); }
+  case 35: /* shw_item: expr  */
+#line 253 "parser.y"
+                            { (yyval.node) = (yyvsp[0].node); }
+#line 1478 "parser.tab.c"
     break;
 
-  case 36:
-/* Line 1792 of yacc.c  */
-#line 250 "parser.y"
-    { (yyval.node) = ast_create_binop(OP_ADD, (yyvsp[(1) - (3)].node), (yyvsp[(3) - (3)].node), lineCount); }
+  case 36: /* expr: expr TOK_PLUS term  */
+#line 257 "parser.y"
+                                { (yyval.node) = ast_create_binop(OP_ADD, (yyvsp[-2].node), (yyvsp[0].node), cc->lineCount); }
+#line 1484 "parser.tab.c"
     break;
 
-  case 37:
-/* Line 1792 of yacc.c  */
-#line 251 "parser.y"
-    { (yyval.node) = ast_create_binop(OP_SUB, (yyvsp[(1) - (3)].node), (yyvsp[(3) - (3)].node), lineCount); }
+  case 37: /* expr: expr TOK_MINUS term  */
+#line 258 "parser.y"
+                                { (yyval.node) = ast_create_binop(OP_SUB, (yyvsp[-2].node), (yyvsp[0].node), cc->lineCount); }
+#line 1490 "parser.tab.c"
     break;
 
-  case 38:
-/* Line 1792 of yacc.c  */
-#line 252 "parser.y"
-    { (yyval.node) = (yyvsp[(1) - (1)].node); }
+  case 38: /* expr: term  */
+#line 259 "parser.y"
+                                { (yyval.node) = (yyvsp[0].node); }
+#line 1496 "parser.tab.c"
     break;
 
-  case 39:
-/* Line 1792 of yacc.c  */
-#line 256 "parser.y"
-    { (yyval.node) = ast_create_binop(OP_MUL, (yyvsp[(1) - (3)].node), (yyvsp[(3) - (3)].node), lineCount); }
+  case 39: /* term: term TOK_MULT factor  */
+#line 263 "parser.y"
+                                { (yyval.node) = ast_create_binop(OP_MUL, (yyvsp[-2].node), (yyvsp[0].node), cc->lineCount); }
+#line 1502 "parser.tab.c"
     break;
 
-  case 40:
-/* Line 1792 of yacc.c  */
-#line 257 "parser.y"
-    { (yyval.node) = ast_create_binop(OP_DIV, (yyvsp[(1) - (3)].node), (yyvsp[(3) - (3)].node), lineCount); }
+  case 40: /* term: term TOK_DIV factor  */
+#line 264 "parser.y"
+                                { (yyval.node) = ast_create_binop(OP_DIV, (yyvsp[-2].node), (yyvsp[0].node), cc->lineCount); }
+#line 1508 "parser.tab.c"
     break;
 
-  case 41:
-/* Line 1792 of yacc.c  */
-#line 258 "parser.y"
-    { (yyval.node) = (yyvsp[(1) - (1)].node); }
+  case 41: /* term: factor  */
+#line 265 "parser.y"
+                                { (yyval.node) = (yyvsp[0].node); }
+#line 1514 "parser.tab.c"
     break;
 
-  case 42:
-/* Line 1792 of yacc.c  */
-#line 262 "parser.y"
-    { (yyval.node) = ast_create_num_lit((yyvsp[(1) - (1)].num), lineCount); }
+  case 42: /* factor: TOK_NUMBER_LITERAL  */
+#line 269 "parser.y"
+                                  { (yyval.node) = ast_create_num_lit((yyvsp[0].num), cc->lineCount); }
+#line 1520 "parser.tab.c"
     break;
 
-  case 43:
-/* Line 1792 of yacc.c  */
-#line 263 "parser.y"
-    { (yyval.node) = ast_create_chr_lit((yyvsp[(1) - (1)].ch), lineCount); }
+  case 43: /* factor: TOK_CHAR_LITERAL  */
+#line 270 "parser.y"
+                                  { (yyval.node) = ast_create_chr_lit((yyvsp[0].ch), cc->lineCount); }
+#line 1526 "parser.tab.c"
     break;
 
-  case 44:
-/* Line 1792 of yacc.c  */
-#line 264 "parser.y"
-    { 
-                (yyval.node) = ast_create_ident((yyvsp[(1) - (1)].str), lineCount);
+  case 44: /* factor: TOK_IDENTIFIER  */
+#line 271 "parser.y"
+                                  { 
+                (yyval.node) = ast_create_ident(name_atom(cc, (yyvsp[0].slice)), cc->lineCount);
         }
+#line 1534 "parser.tab.c"
     break;
 
-  case 45:
-/* Line 1792 of yacc.c  */
-#line 267 "parser.y"
-    { (yyval.node) = (yyvsp[(2) - (3)].node); }
+  case 45: /* factor: TOK_LPAREN expr TOK_RPAREN  */
+#line 274 "parser.y"
+                                     { (yyval.node) = (yyvsp[-1].node); }
+#line 1540 "parser.tab.c"
     break;
 
-  case 46:
-/* Line 1792 of yacc.c  */
-#line 268 "parser.y"
-    {
-            if (!(yyvsp[(2) - (2)].node)) {
+  case 46: /* factor: TOK_MINUS factor  */
+#line 275 "parser.y"
+                                  {
+            if (!(yyvsp[0].node)) {
                 (yyval.node) = NULL;
             } else {
-                ASTNode *zero = ast_create_num_lit(0, lineCount);
-                (yyval.node) = ast_create_binop(OP_SUB, zero, (yyvsp[(2) - (2)].node), lineCount);
+                ASTNode *zero = ast_create_num_lit(0, cc->lineCount);
+                (yyval.node) = ast_create_binop(OP_SUB, zero, (yyvsp[0].node), cc->lineCount);
             }
         }
+#line 1553 "parser.tab.c"
     break;
 
-  case 47:
-/* Line 1792 of yacc.c  */
-#line 276 "parser.y"
-    {
-            (yyval.node) = (yyvsp[(2) - (2)].node);
+  case 47: /* factor: TOK_PLUS factor  */
+#line 283 "parser.y"
+                                  {
+            (yyval.node) = (yyvsp[0].node);
         }
+#line 1561 "parser.tab.c"
     break;
 
 
-/* Line 1792 of yacc.c  */
-#line 1841 "parser.tab.c"
+#line 1565 "parser.tab.c"
+
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -1851,96 +1576,58 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
-  /* Now `shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
 
-/*------------------------------------.
-| yyerrlab -- here on detecting error |
-`------------------------------------*/
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
-      yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
+      yyerror (cc, YY_("syntax error"));
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
-	 error, discard it.  */
+         error, discard it.  */
 
       if (yychar <= YYEOF)
-	{
-	  /* Return failure if at end of input.  */
-	  if (yychar == YYEOF)
-	    YYABORT;
-	}
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
       else
-	{
-	  yydestruct ("Error: discarding",
-		      yytoken, &yylval);
-	  yychar = YYEMPTY;
-	}
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, cc);
+          yychar = YYEMPTY;
+        }
     }
 
   /* Else will try to reuse lookahead token after shifting the error
@@ -1952,14 +1639,13 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
   yylen = 0;
@@ -1972,29 +1658,30 @@ yyerrorlab:
 | yyerrlab1 -- common code for both syntax error and YYERROR.  |
 `-------------------------------------------------------------*/
 yyerrlab1:
-  yyerrstatus = 3;	/* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
-	{
-	  yyn += YYTERROR;
-	  if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-	    {
-	      yyn = yytable[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
       /* Pop the current state because it cannot handle the error token.  */
       if (yyssp == yyss)
-	YYABORT;
+        YYABORT;
 
 
       yydestruct ("Error: popping",
-		  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, cc);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -2006,7 +1693,7 @@ yyerrlab1:
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -2017,171 +1704,66 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
-  yyerror (YY_("memory exhausted"));
+  yyerror (cc, YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
+
 
-yyreturn:
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
          user semantic actions for why this is necessary.  */
       yytoken = YYTRANSLATE (yychar);
       yydestruct ("Cleanup: discarding lookahead",
-                  yytoken, &yylval);
+                  yytoken, &yylval, cc);
     }
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
   YYPOPSTACK (yylen);
   YY_STACK_PRINT (yyss, yyssp);
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-		  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, cc);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
-  /* Make sure YYID is used.  */
-  return YYID (yyresult);
-}
-
-
-/* Line 2055 of yacc.c  */
-#line 280 "parser.y"
-
 
-void yyerror(const char *s) {
-    fprintf(stderr, "Error at line %d: %s Unexpected: '%s'\n", lineCount, s, yytext);
-    error_count++;
+  return yyresult;
 }
 
-int Semantic_analysis(){
-    if(DEBUG_MODE) printf("\n=== Semantic Analysis ===\n\n");
+#line 287 "parser.y"
 
-    if(error_count > 0){
-        if(DEBUG_MODE) printf("Skipping semantic analysis due to %d previous error(s).\n", error_count);
-        return 1;
-    }
 
-    int semantic_errors = 0;
-    if (ast_check_semantics(root, &semantic_errors)) {
-        if(DEBUG_MODE) printf("Semantic analysis passed.\n");
-    } else {
-        if(DEBUG_MODE) printf("Semantic analysis failed with %d error(s).\n", semantic_errors);
-        ast_free(root);
-        if(DEBUG_MODE) printf("\n=== Compilation Failed ===\n");
-        return 1;
-    }
-    return 0;
+int yylex(YYSTYPE *lval, Compiler *cc) {
+    return scanner_next(&cc->scanner, lval);
 }
 
-void print_symbol_table() {
-    printf("\n=== Symbol Table after Execution ===\n\n");
-    printf("%-15s %-10s %-10s %-10s %s\n", "Name", "Type", "Offset", "Size", "Value");
-    printf("%-15s %-10s %-10s %-10s %s\n", "----", "----", "------", "----", "-----");
-    
-    for (int i = 0; i < symcount; i++) {
-        Symbol *s = &symtab[i];
-        printf("%-15s %-10s %-10d %-10d ", 
-                s->name, 
-                type_to_string(s->type),
-                s->memOffset,
-                s->size);
-        
-        if (s->type == TYPE_NMBR || (s->type == TYPE_FLEX && s->flexType == FLEX_NUMBER)) {
-            printf("%d\n", s->numVal);
-        } else if (s->type == TYPE_CHR || (s->type == TYPE_FLEX && s->flexType == FLEX_CHAR)) {
-            if (s->chrVal >= 32 && s->chrVal <= 126) {
-                printf("'%c'\n", s->chrVal);
-            } else if (s->chrVal == '\0') {
-                printf("'\\0' (null)\n");
-            } else {
-                printf("(ASCII %d)\n", (int)s->chrVal);
-            }
-        } else {
-            printf("(uninitialized)\n");
-        }
-    }
-    printf("\n");
+void yyerror(Compiler *cc, const char *s) {
+    // The scanner has already reported an unexpected character and stopped
+    if (!cc->scanner.badChar)
+        fprintf(stderr, "Error at line %d: %s Unexpected: '%s'\n", cc->lineCount, s, cc->scanner.tok);
+    cc->errorCount++;
 }
-
-int main(int argc, char **argv) {
-    LARGE_INTEGER frequency, start, end;
-    QueryPerformanceFrequency(&frequency);
-    QueryPerformanceCounter(&start);
-    printf("console:\"");
-    int result = yyparse();
-        
-    if (result != 0 || !root) {
-        printf("\",\n");
-        if (root) ast_free(root);
-        return 1;
-    }
-    
-    if (DEBUG_MODE) ast_print(root, 0);
-
-    //before semantic analysis, build symbol table for right sequence
-    if (DEBUG_MODE) printf("\n=== Building Symbol Table ===\n");
-    ast_build_symbol_table(root, &error_count);
-    if (error_count > 0) {
-        if (DEBUG_MODE) printf("Symbol table construction failed with %d error(s).\n", error_count);
-        printf("\",\n");
-        ast_free(root);
-        return 1;
-    }
-
-    // semantic analysis 
-    int sem_result = Semantic_analysis();
-    if(sem_result != 0){
-        printf("\",\n");
-        return 1;
-    }
-
-    TACProgram *tac = tac_generate(root);
-    compute_symbol_offsets();
-    
-    int result_execute = tac_execute(tac);
-    QueryPerformanceCounter(&end);
-    double elapsed = (double)(end.QuadPart - start.QuadPart) * 1000.0 / frequency.QuadPart;
-    printf("\nExecution Time: %.3f ms\n", elapsed);
-    printf("\",\n");
-
-    if(result_execute == 0){
-        if(DEBUG_MODE) {
-            printf("\n=== Three-Address Code ===\n\n");
-            tac_print(tac);
-            printf("Parse result: %d, root: %p, error_count: %d\n", result, (void*)root, error_count);
-            print_symbol_table();
-        }
-        tac_generate_assembly(tac);
-    }
-    
-    tac_free(tac);
-    ast_free(root);
-
-    return 0;
-
-
-}
\ No newline at end of file
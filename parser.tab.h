@@ -1,21 +1,22 @@
-/* A Bison parser, made by GNU Bison 2.7.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989-1990, 2000-2012 Free Software Foundation, Inc.
-   
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -26,87 +27,90 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 #ifndef YY_YY_PARSER_TAB_H_INCLUDED
 # define YY_YY_PARSER_TAB_H_INCLUDED
-/* Enabling traces.  */
+/* Debug traces.  */
 #ifndef YYDEBUG
 # define YYDEBUG 0
 #endif
 #if YYDEBUG
 extern int yydebug;
 #endif
+/* "%code requires" blocks.  */
+#line 24 "parser.y"
+
+#include "ast.h"
+struct Compiler;
 
-/* Tokens.  */
+#line 54 "parser.tab.h"
+
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     TOK_NMBR = 258,
-     TOK_CHR = 259,
-     TOK_FLEX = 260,
-     TOK_SHW = 261,
-     TOK_PLUS = 262,
-     TOK_MINUS = 263,
-     TOK_MULT = 264,
-     TOK_DIV = 265,
-     TOK_PLUS_ASSIGN = 266,
-     TOK_MINUS_ASSIGN = 267,
-     TOK_MULT_ASSIGN = 268,
-     TOK_DIV_ASSIGN = 269,
-     TOK_ASSIGN = 270,
-     TOK_CONCAT = 271,
-     TOK_LPAREN = 272,
-     TOK_RPAREN = 273,
-     TOK_NEWLINE = 274,
-     TOK_COMMA = 275,
-     TOK_NUMBER_LITERAL = 276,
-     TOK_CHAR_LITERAL = 277,
-     TOK_STRING_LITERAL = 278,
-     TOK_IDENTIFIER = 279
-   };
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    TOK_NMBR = 258,                /* TOK_NMBR  */
+    TOK_CHR = 259,                 /* TOK_CHR  */
+    TOK_FLEX = 260,                /* TOK_FLEX  */
+    TOK_SHW = 261,                 /* TOK_SHW  */
+    TOK_PLUS = 262,                /* TOK_PLUS  */
+    TOK_MINUS = 263,               /* TOK_MINUS  */
+    TOK_MULT = 264,                /* TOK_MULT  */
+    TOK_DIV = 265,                 /* TOK_DIV  */
+    TOK_PLUS_ASSIGN = 266,         /* TOK_PLUS_ASSIGN  */
+    TOK_MINUS_ASSIGN = 267,        /* TOK_MINUS_ASSIGN  */
+    TOK_MULT_ASSIGN = 268,         /* TOK_MULT_ASSIGN  */
+    TOK_DIV_ASSIGN = 269,          /* TOK_DIV_ASSIGN  */
+    TOK_ASSIGN = 270,              /* TOK_ASSIGN  */
+    TOK_CONCAT = 271,              /* TOK_CONCAT  */
+    TOK_LPAREN = 272,              /* TOK_LPAREN  */
+    TOK_RPAREN = 273,              /* TOK_RPAREN  */
+    TOK_NEWLINE = 274,             /* TOK_NEWLINE  */
+    TOK_COMMA = 275,               /* TOK_COMMA  */
+    TOK_NUMBER_LITERAL = 276,      /* TOK_NUMBER_LITERAL  */
+    TOK_CHAR_LITERAL = 277,        /* TOK_CHAR_LITERAL  */
+    TOK_STRING_LITERAL = 278,      /* TOK_STRING_LITERAL  */
+    TOK_IDENTIFIER = 279           /* TOK_IDENTIFIER  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
 
-
+/* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
+union YYSTYPE
 {
-/* Line 2058 of yacc.c  */
-#line 27 "parser.y"
+#line 34 "parser.y"
 
     int num;
     char ch;
-    char *str;
+    TokenSlice slice;
     struct ASTNode *node;
     int vartype;
 
+#line 103 "parser.tab.h"
 
-/* Line 2058 of yacc.c  */
-#line 90 "parser.tab.h"
-} YYSTYPE;
+};
+typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
 # define YYSTYPE_IS_DECLARED 1
 #endif
 
-extern YYSTYPE yylval;
 
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
+
+
+int yyparse (struct Compiler *cc);
+
 
 #endif /* !YY_YY_PARSER_TAB_H_INCLUDED  */
@@ -2,32 +2,39 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <stdbool.h>
-#include "symbol_table.h"
 #include "ast.h"
-#include "tac.h"
-#include <windows.h>
+#include "compiler.h"
 
-extern int yylex();
-extern int yylineno;
-extern char *yytext;
+/* Names are interned in the compilation's symbol table as they are parsed */
+static Atom name_atom(Compiler *cc, TokenSlice name) {
+    return intern(&cc->symbols.names, name.text, (size_t)name.len);
+}
 
-void yyerror(const char *s);
-extern int yychar;
+static ASTNode *string_literal(Compiler *cc, TokenSlice text) {
+    cc->textCopies++;
+    cc->textBytes += text.len + 1;
+    return ast_create_str_lit(text, cc->lineCount);
+}
 
-int lineCount = 1;
-ASTNode *root = NULL;
-int error_count = 0;
-bool DEBUG_MODE = false;
+%}
+%define api.pure
+%parse-param {struct Compiler *cc}
+%lex-param {struct Compiler *cc}
 
-VarType current_decl_type;
+%code requires {
+#include "ast.h"
+struct Compiler;
+}
 
-%}
+%code {
+int yylex(YYSTYPE *lval, struct Compiler *cc);
+void yyerror(struct Compiler *cc, const char *s);
+}
 //possible types 
 %union {
     int num;
     char ch;
-    char *str;
+    TokenSlice slice;
     struct ASTNode *node;
     int vartype;
 }
@@ -60,8 +67,8 @@ VarType current_decl_type;
 /* Literal token from the lexer */
 %token <num> TOK_NUMBER_LITERAL
 %token <ch>  TOK_CHAR_LITERAL
-%token <str> TOK_STRING_LITERAL
-%token <str> TOK_IDENTIFIER
+%token <slice> TOK_STRING_LITERAL
+%token <slice> TOK_IDENTIFIER
 
 /* Non-terminal types for AST nodes */
 %type <node> program line_list line statement 
@@ -74,21 +81,21 @@ VarType current_decl_type;
 
 program:
         line_list { //Handles programs that are just lines (which can contain statements via line ->statement TOK_NEWLINE
-            root = $1; 
+            cc->root = $1; 
             $$ = $1;
         }
     | line_list statement {//handles statement without newline at EOF
-            root = ast_add_stmt($1, $2);
-            $$ = root;
+            cc->root = ast_add_stmt($1, $2);
+            $$ = cc->root;
         }
     | statement {
-            root = ast_create_program();
-            root = ast_add_stmt(root, $1);
-            $$ = root;
+            cc->root = ast_create_program();
+            cc->root = ast_add_stmt(cc->root, $1);
+            $$ = cc->root;
         }
     | /* empty */ { 
-            root = ast_create_program(); 
-            $$ = root; 
+            cc->root = ast_create_program(); 
+            $$ = cc->root; 
         }
     ;
 
@@ -99,21 +106,21 @@ line_list:
             } else {
                 $$ = $1;
             }
-            lineCount++;
+            cc->lineCount++;
         }
         | line {
             $$ = ast_create_program();
             if ($1 != NULL) {
                 $$ = ast_add_stmt($$, $1);
             }
-            lineCount++;
+            cc->lineCount++;
         }
         ;
 
 line:
         statement TOK_NEWLINE   { $$ = $1; }
         | TOK_NEWLINE           { $$ = NULL; }
-        | error TOK_NEWLINE     { error_count++; yyerrok; $$ = NULL; }
+        | error TOK_NEWLINE     { cc->errorCount++; yyerrok; $$ = NULL; }
         ;
 
 statement:
@@ -131,7 +138,7 @@ declaration:
                 $$ = $1;
             } else {
                 /* Has continuation - need to combine them */
-                $$ = ast_create_decl_list($1, $2, lineCount);
+                $$ = ast_create_decl_list($1, $2, cc->lineCount);
             }
         }
         ;
@@ -139,36 +146,36 @@ declaration:
 /* Single declaration of format: TYPE IDENTIFIER [= expr] */
 single_decl:
         TOK_NMBR TOK_IDENTIFIER TOK_ASSIGN expr {
-            current_decl_type = TYPE_NMBR;
-            $$ = ast_create_decl(TYPE_NMBR, $2, $4, lineCount);
+            cc->declType = TYPE_NMBR;
+            $$ = ast_create_decl(TYPE_NMBR, name_atom(cc, $2), $4, cc->lineCount);
            
         }
         | TOK_NMBR TOK_IDENTIFIER {
-            current_decl_type = TYPE_NMBR;
-            ASTNode *init = ast_create_num_lit(0, lineCount);
-            $$ = ast_create_decl(TYPE_NMBR, $2, init, lineCount);
+            cc->declType = TYPE_NMBR;
+            ASTNode *init = ast_create_num_lit(0, cc->lineCount);
+            $$ = ast_create_decl(TYPE_NMBR, name_atom(cc, $2), init, cc->lineCount);
             
         }
         | TOK_CHR TOK_IDENTIFIER TOK_ASSIGN expr {
-            current_decl_type = TYPE_CHR;
-            $$ = ast_create_decl(TYPE_CHR, $2, $4, lineCount);
+            cc->declType = TYPE_CHR;
+            $$ = ast_create_decl(TYPE_CHR, name_atom(cc, $2), $4, cc->lineCount);
             
         }
         | TOK_CHR TOK_IDENTIFIER {
-            current_decl_type = TYPE_CHR;
-            ASTNode *init = ast_create_chr_lit('\0', lineCount);
-            $$ = ast_create_decl(TYPE_CHR, $2, init, lineCount);
+            cc->declType = TYPE_CHR;
+            ASTNode *init = ast_create_chr_lit('\0', cc->lineCount);
+            $$ = ast_create_decl(TYPE_CHR, name_atom(cc, $2), init, cc->lineCount);
 
         }
         | TOK_FLEX TOK_IDENTIFIER TOK_ASSIGN expr {
-            current_decl_type = TYPE_FLEX;
-            $$ = ast_create_decl(TYPE_FLEX, $2, $4, lineCount);
+            cc->declType = TYPE_FLEX;
+            $$ = ast_create_decl(TYPE_FLEX, name_atom(cc, $2), $4, cc->lineCount);
         }
         | TOK_FLEX TOK_IDENTIFIER {
-            current_decl_type = TYPE_FLEX;
+            cc->declType = TYPE_FLEX;
     
-            ASTNode *init = ast_create_str_lit("", lineCount);
-            $$ = ast_create_decl(TYPE_FLEX, $2, init, lineCount);
+            ASTNode *init = string_literal(cc, (TokenSlice){"", 0, 0});
+            $$ = ast_create_decl(TYPE_FLEX, name_atom(cc, $2), init, cc->lineCount);
             
         }
         ;
@@ -179,98 +186,98 @@ decl_continuation:
             $$ = NULL; 
         }
         | TOK_COMMA TOK_IDENTIFIER decl_continuation {
-            ASTNode *item = ast_create_name_item_typed($2, NULL, current_decl_type, lineCount);
+            ASTNode *item = ast_create_name_item_typed(name_atom(cc, $2), NULL, cc->declType, cc->lineCount);
             if ($3 == NULL) {
                 $$ = item;
             } else {
-                $$ = ast_create_name_list(item, $3, lineCount);
+                $$ = ast_create_name_list(item, $3, cc->lineCount);
             }
         }
         | TOK_COMMA TOK_IDENTIFIER TOK_ASSIGN expr decl_continuation {
-            ASTNode *item = ast_create_name_item_typed($2, $4, current_decl_type, lineCount);
+            ASTNode *item = ast_create_name_item_typed(name_atom(cc, $2), $4, cc->declType, cc->lineCount);
             if ($5 == NULL) {
                 $$ = item;
             } else {
-                $$ = ast_create_name_list(item, $5, lineCount);
+                $$ = ast_create_name_list(item, $5, cc->lineCount);
             }
         }
         | TOK_COMMA single_decl decl_continuation {
             if ($3 == NULL) {
                 $$ = $2;
             } else {
-                $$ = ast_create_decl_list($2, $3, lineCount);
+                $$ = ast_create_decl_list($2, $3, cc->lineCount);
             }
         }
         ;
 
 assignment:
         TOK_IDENTIFIER TOK_ASSIGN expr {
-            $$ = ast_create_assign($1, $3, lineCount);
+            $$ = ast_create_assign(name_atom(cc, $1), $3, cc->lineCount);
         }
         ;
 
 compound_assign:
         TOK_IDENTIFIER TOK_PLUS_ASSIGN expr {
             
-            $$ = ast_create_compound_assign($1, OP_PLUS_ASSIGN, $3, lineCount);
+            $$ = ast_create_compound_assign(name_atom(cc, $1), OP_PLUS_ASSIGN, $3, cc->lineCount);
         }
         | TOK_IDENTIFIER TOK_MINUS_ASSIGN expr {
 
-            $$ = ast_create_compound_assign($1, OP_MINUS_ASSIGN, $3, lineCount);
+            $$ = ast_create_compound_assign(name_atom(cc, $1), OP_MINUS_ASSIGN, $3, cc->lineCount);
         }
         | TOK_IDENTIFIER TOK_MULT_ASSIGN expr {
 
-            $$ = ast_create_compound_assign($1, OP_MULT_ASSIGN, $3, lineCount);
+            $$ = ast_create_compound_assign(name_atom(cc, $1), OP_MULT_ASSIGN, $3, cc->lineCount);
         }
         | TOK_IDENTIFIER TOK_DIV_ASSIGN expr {
 
-            $$ = ast_create_compound_assign($1, OP_DIV_ASSIGN, $3, lineCount);
+            $$ = ast_create_compound_assign(name_atom(cc, $1), OP_DIV_ASSIGN, $3, cc->lineCount);
         }
         ;
 
 shw_statement:
         TOK_SHW shw_expr {
-            $$ = ast_create_shw($2, lineCount);
+            $$ = ast_create_shw($2, cc->lineCount);
         }
         ;
 
 shw_expr:
         shw_item                      { $$ = $1; }
         | shw_expr TOK_CONCAT shw_item  {
-            $$ = ast_create_concat($1, $3, lineCount);
+            $$ = ast_create_concat($1, $3, cc->lineCount);
         }
         ;
 
 shw_item:
-        TOK_STRING_LITERAL  { $$ = ast_create_str_lit($1, lineCount); }
+        TOK_STRING_LITERAL  { $$ = string_literal(cc, $1); }
         | expr              { $$ = $1; }
         ;
 
 expr:
-        expr TOK_PLUS term      { $$ = ast_create_binop(OP_ADD, $1, $3, lineCount); }
-        | expr TOK_MINUS term   { $$ = ast_create_binop(OP_SUB, $1, $3, lineCount); }
+        expr TOK_PLUS term      { $$ = ast_create_binop(OP_ADD, $1, $3, cc->lineCount); }
+        | expr TOK_MINUS term   { $$ = ast_create_binop(OP_SUB, $1, $3, cc->lineCount); }
         | term                  { $$ = $1; }
         ;
 
 term:
-        term TOK_MULT factor    { $$ = ast_create_binop(OP_MUL, $1, $3, lineCount); }
-        | term TOK_DIV factor   { $$ = ast_create_binop(OP_DIV, $1, $3, lineCount); }
+        term TOK_MULT factor    { $$ = ast_create_binop(OP_MUL, $1, $3, cc->lineCount); }
+        | term TOK_DIV factor   { $$ = ast_create_binop(OP_DIV, $1, $3, cc->lineCount); }
         | factor                { $$ = $1; }
         ;
 
 factor:
-        TOK_NUMBER_LITERAL        { $$ = ast_create_num_lit($1, lineCount); }
-        | TOK_CHAR_LITERAL        { $$ = ast_create_chr_lit($1, lineCount); }
+        TOK_NUMBER_LITERAL        { $$ = ast_create_num_lit($1, cc->lineCount); }
+        | TOK_CHAR_LITERAL        { $$ = ast_create_chr_lit($1, cc->lineCount); }
         | TOK_IDENTIFIER          { 
-                $$ = ast_create_ident($1, lineCount);
+                $$ = ast_create_ident(name_atom(cc, $1), cc->lineCount);
         }
         | TOK_LPAREN expr TOK_RPAREN { $$ = $2; }
         | TOK_MINUS factor        {
             if (!$2) {
                 $$ = NULL;
             } else {
-                ASTNode *zero = ast_create_num_lit(0, lineCount);
-                $$ = ast_create_binop(OP_SUB, zero, $2, lineCount);
+                ASTNode *zero = ast_create_num_lit(0, cc->lineCount);
+                $$ = ast_create_binop(OP_SUB, zero, $2, cc->lineCount);
             }
         }
         | TOK_PLUS factor         {
@@ -279,116 +286,13 @@ factor:
         ;
 %%
 
-void yyerror(const char *s) {
-    fprintf(stderr, "Error at line %d: %s Unexpected: '%s'\n", lineCount, s, yytext);
-    error_count++;
+int yylex(YYSTYPE *lval, Compiler *cc) {
+    return scanner_next(&cc->scanner, lval);
 }
 
-int Semantic_analysis(){
-    if(DEBUG_MODE) printf("\n=== Semantic Analysis ===\n\n");
-
-    if(error_count > 0){
-        if(DEBUG_MODE) printf("Skipping semantic analysis due to %d previous error(s).\n", error_count);
-        return 1;
-    }
-
-    int semantic_errors = 0;
-    if (ast_check_semantics(root, &semantic_errors)) {
-        if(DEBUG_MODE) printf("Semantic analysis passed.\n");
-    } else {
-        if(DEBUG_MODE) printf("Semantic analysis failed with %d error(s).\n", semantic_errors);
-        ast_free(root);
-        if(DEBUG_MODE) printf("\n=== Compilation Failed ===\n");
-        return 1;
-    }
-    return 0;
+void yyerror(Compiler *cc, const char *s) {
+    // The scanner has already reported an unexpected character and stopped
+    if (!cc->scanner.badChar)
+        fprintf(stderr, "Error at line %d: %s Unexpected: '%s'\n", cc->lineCount, s, cc->scanner.tok);
+    cc->errorCount++;
 }
-
-void print_symbol_table() {
-    printf("\n=== Symbol Table after Execution ===\n\n");
-    printf("%-15s %-10s %-10s %-10s %s\n", "Name", "Type", "Offset", "Size", "Value");
-    printf("%-15s %-10s %-10s %-10s %s\n", "----", "----", "------", "----", "-----");
-    
-    for (int i = 0; i < symcount; i++) {
-        Symbol *s = &symtab[i];
-        printf("%-15s %-10s %-10d %-10d ", 
-                s->name, 
-                type_to_string(s->type),
-                s->memOffset,
-                s->size);
-        
-        if (s->type == TYPE_NMBR || (s->type == TYPE_FLEX && s->flexType == FLEX_NUMBER)) {
-            printf("%d\n", s->numVal);
-        } else if (s->type == TYPE_CHR || (s->type == TYPE_FLEX && s->flexType == FLEX_CHAR)) {
-            if (s->chrVal >= 32 && s->chrVal <= 126) {
-                printf("'%c'\n", s->chrVal);
-            } else if (s->chrVal == '\0') {
-                printf("'\\0' (null)\n");
-            } else {
-                printf("(ASCII %d)\n", (int)s->chrVal);
-            }
-        } else {
-            printf("(uninitialized)\n");
-        }
-    }
-    printf("\n");
-}
-
-int main(int argc, char **argv) {
-    LARGE_INTEGER frequency, start, end;
-    QueryPerformanceFrequency(&frequency);
-    QueryPerformanceCounter(&start);
-    printf("console:\"");
-    int result = yyparse();
-        
-    if (result != 0 || !root) {
-        printf("\",\n");
-        if (root) ast_free(root);
-        return 1;
-    }
-    
-    if (DEBUG_MODE) ast_print(root, 0);
-
-    //before semantic analysis, build symbol table for right sequence
-    if (DEBUG_MODE) printf("\n=== Building Symbol Table ===\n");
-    ast_build_symbol_table(root, &error_count);
-    if (error_count > 0) {
-        if (DEBUG_MODE) printf("Symbol table construction failed with %d error(s).\n", error_count);
-        printf("\",\n");
-        ast_free(root);
-        return 1;
-    }
-
-    // semantic analysis 
-    int sem_result = Semantic_analysis();
-    if(sem_result != 0){
-        printf("\",\n");
-        return 1;
-    }
-
-    TACProgram *tac = tac_generate(root);
-    compute_symbol_offsets();
-    
-    int result_execute = tac_execute(tac);
-    QueryPerformanceCounter(&end);
-    double elapsed = (double)(end.QuadPart - start.QuadPart) * 1000.0 / frequency.QuadPart;
-    printf("\nExecution Time: %.3f ms\n", elapsed);
-    printf("\",\n");
-
-    if(result_execute == 0){
-        if(DEBUG_MODE) {
-            printf("\n=== Three-Address Code ===\n\n");
-            tac_print(tac);
-            printf("Parse result: %d, root: %p, error_count: %d\n", result, (void*)root, error_count);
-            print_symbol_table();
-        }
-        tac_generate_assembly(tac);
-    }
-    
-    tac_free(tac);
-    ast_free(root);
-
-    return 0;
-
-
-}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "peval.h"
+#include "output.h"
+#include "symbol_table.h"
+
+static void emit_store(TACProgram *residual, Symbol *s) {
+    FlexType tag = VALUE_TAG(s->value);
+    if (tag == FLEX_NONE) return;    // never written
+
+    // A char-tagged flex only gets its tag from a char arithmetic result
+    if (s->type == TYPE_FLEX && tag == FLEX_CHAR) {
+        TACOperand dst = tac_operand_var(s->name);
+        dst.isCharType = 1;
+        TACInstr *instr = tac_emit(residual, TAC_ADD, dst, tac_operand_int(VALUE_NUM(s->value)),
+                                   tac_operand_int(0), 0);
+        instr->resultIsChar = 1;
+        return;
+    }
+    tac_emit(residual, TAC_LOAD_INT, tac_operand_var(s->name), tac_operand_int(VALUE_NUM(s->value)),
+             tac_operand_none(), 0);
+}
+
+/* Console text as string literals; a NUL byte is printed as a char */
+static void emit_text(TACProgram *residual, const char *text, size_t len) {
+    size_t start = 0;
+    while (start < len) {
+        size_t n = strlen(text + start);
+        TACInstr *instr;
+        if (n > 0) {
+            instr = tac_emit(residual, TAC_CONCAT, tac_operand_none(), tac_operand_str(text + start),
+                             tac_operand_none(), 0);
+        } else {
+            TACOperand nul = tac_operand_int(0);
+            nul.isCharType = 1;
+            instr = tac_emit(residual, TAC_CONCAT, tac_operand_none(), nul, tac_operand_none(), 0);
+            n = 1;
+        }
+        instr->inShwContext = 1;
+        start += n;
+    }
+}
+
+TACProgram *tac_partial_eval(TACProgram *prog, int keepSymbols) {
+    output_capture(1);
+    output_clear();
+    int status = tac_evaluate(prog);
+
+    size_t len;
+    const char *out = output_buffer(&len);
+    char *text = malloc(len + 1);
+    if (!text) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    if (len) memcpy(text, out, len);
+    text[len] = '\0';
+    output_capture(0);
+
+    SymbolTable *st = prog->symbols;
+    TACProgram *residual = tac_create_program(st);
+    if (keepSymbols) {
+        for (int i = 0; i < st->count; i++) emit_store(residual, &st->entries[i]);
+    }
+    emit_text(residual, text, len);
+    if (status != 0 && prog->fault) {
+        int t = tac_new_temp(residual);
+        tac_emit(residual, TAC_DIV, tac_operand_temp(t), tac_operand_int(0), tac_operand_int(0),
+                 prog->fault->line);
+    }
+    free(text);
+
+    // The residual runs from the same zeroed state as the original would
+    for (int i = 0; i < st->count; i++) st->entries[i].value = VALUE_MAKE(0, FLEX_NONE);
+    return residual;
+}
@@ -0,0 +1,15 @@
+#ifndef PEVAL_H
+#define PEVAL_H
+
+#include "tac.h"
+
+/* Whole-program partial evaluation. Colang programs read no input, so
+   running one at compile time fixes everything it does. The residual
+   program prints the captured console text as string literals and, with
+   keepSymbols, stores each variable's final value (constant first writes,
+   so the backends place them in .data). A program that divides by zero
+   keeps the output written before the error and ends in a division by
+   zero on the same line. */
+TACProgram *tac_partial_eval(TACProgram *prog, int keepSymbols);
+
+#endif
@@ -0,0 +1,372 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rv64.h"
+#include "target.h"
+#include "symbol_table.h"
+
+static const char *abi_names[32] = {
+    "zero", "ra", "sp", "gp", "tp", "t0", "t1", "t2",
+    "s0", "s1", "a0", "a1", "a2", "a3", "a4", "a5",
+    "a6", "a7", "s2", "s3", "s4", "s5", "s6", "s7",
+    "s8", "s9", "s10", "s11", "t3", "t4", "t5", "t6",
+};
+
+static void rv64_code_append(RV64Code *code, uint32_t word) {
+    if (code->count >= code->capacity) {
+        int newCap = code->capacity == 0 ? 64 : code->capacity * 2;
+        code->words = realloc(code->words, newCap * sizeof(uint32_t));
+        if (!code->words) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        code->capacity = newCap;
+    }
+    code->words[code->count++] = word;
+}
+
+void rv64_code_free(RV64Code *code) {
+    if (!code) return;
+    free(code->words);
+    free(code);
+}
+
+/* Encode R-type instruction: funct7 rs2 rs1 funct3 rd opcode */
+static uint32_t encode_r_type(int funct7, int rs2, int rs1, int funct3, int rd, int opcode) {
+    uint32_t instr = 0;
+    instr |= (funct7 & 0x7F) << 25;
+    instr |= (rs2 & 0x1F) << 20;
+    instr |= (rs1 & 0x1F) << 15;
+    instr |= (funct3 & 0x7) << 12;
+    instr |= (rd & 0x1F) << 7;
+    instr |= (opcode & 0x7F);
+    return instr;
+}
+
+static uint32_t encode_i_type(int immediate, int rs1, int funct3, int rd, int opcode) {
+    uint32_t instr = 0;
+    instr |= ((uint32_t)immediate & 0xFFF) << 20;
+    instr |= (rs1 & 0x1F) << 15;
+    instr |= (funct3 & 0x7) << 12;
+    instr |= (rd & 0x1F) << 7;
+    instr |= (opcode & 0x7F);
+    return instr;
+}
+
+static uint32_t encode_s_type(int immediate, int rs2, int rs1, int funct3, int opcode) {
+    uint32_t imm = (uint32_t)immediate;
+    uint32_t instr = 0;
+    instr |= ((imm >> 5) & 0x7F) << 25;
+    instr |= (rs2 & 0x1F) << 20;
+    instr |= (rs1 & 0x1F) << 15;
+    instr |= (funct3 & 0x7) << 12;
+    instr |= (imm & 0x1F) << 7;
+    instr |= (opcode & 0x7F);
+    return instr;
+}
+
+static uint32_t encode_b_type(int offset, int rs2, int rs1, int funct3, int opcode) {
+    uint32_t imm = (uint32_t)offset;
+    uint32_t instr = 0;
+    instr |= ((imm >> 12) & 0x1) << 31;
+    instr |= ((imm >> 5) & 0x3F) << 25;
+    instr |= (rs2 & 0x1F) << 20;
+    instr |= (rs1 & 0x1F) << 15;
+    instr |= (funct3 & 0x7) << 12;
+    instr |= ((imm >> 1) & 0xF) << 8;
+    instr |= ((imm >> 11) & 0x1) << 7;
+    instr |= (opcode & 0x7F);
+    return instr;
+}
+
+static uint32_t encode_u_type(uint32_t upper, int rd, int opcode) {
+    return (upper << 12) | ((rd & 0x1F) << 7) | (opcode & 0x7F);
+}
+
+static int fits_imm12(long value) {
+    return value >= -2048 && value <= 2047;
+}
+
+/* Split a 32-bit value into lui/addi parts: value == (hi << 12) + lo */
+static void split_hi_lo(int value, uint32_t *hi, int *lo) {
+    *hi = (((uint32_t)value + 0x800) >> 12) & 0xFFFFF;
+    *lo = (int)((uint32_t)value - (*hi << 12));
+    if (*lo >= 2048) *lo -= 4096;
+}
+
+/* Absolute load or store. Addresses beyond the 12-bit immediate go
+   through t6, like the %hi/%lo pair an assembler would emit. */
+static void emit_mem(RV64Code *code, int isStore, int funct3, int reg, int addr) {
+    int base = RV_ZERO;
+    if (!fits_imm12(addr)) {
+        uint32_t hi;
+        split_hi_lo(addr, &hi, &addr);
+        rv64_code_append(code, encode_u_type(hi, RV_T6, RV_OPCODE_LUI));
+        base = RV_T6;
+    }
+    if (isStore) {
+        rv64_code_append(code, encode_s_type(addr, reg, base, funct3, RV_OPCODE_STORE));
+    } else {
+        rv64_code_append(code, encode_i_type(addr, base, funct3, reg, RV_OPCODE_LOAD));
+    }
+}
+
+/* RV64IM target for tac_lower. Registers loaded with an immediate are
+   remembered so a division by a nonzero constant needs no zero check. */
+typedef struct {
+    RV64Code *code;
+    int isConst[TARGET_MAX_REGS];
+    int constVal[TARGET_MAX_REGS];
+} RVContext;
+
+static int rv_reg(int regIdx) {
+    return RV_A0 + regIdx;
+}
+
+static void rv_load_var(void *ctx, int reg, Symbol *s) {
+    RVContext *rv = ctx;
+    rv->isConst[reg] = 0;
+    emit_mem(rv->code, 0, s->type == TYPE_CHR ? RV_FUNCT3_B : RV_FUNCT3_W, rv_reg(reg), s->memOffset);
+}
+
+/* Follows tac_execute's setters: a char store into nmbr is dropped and a
+   char store into flex keeps the sign-extended low byte */
+static int rv_store_var(void *ctx, int reg, Symbol *s, int charStore) {
+    RV64Code *code = ((RVContext *)ctx)->code;
+    if (s->type == TYPE_CHR) {
+        emit_mem(code, 1, RV_FUNCT3_B, rv_reg(reg), s->memOffset);
+        return 0;
+    }
+    if (charStore && s->type == TYPE_NMBR) return 0;
+    if (charStore) {
+        rv64_code_append(code, encode_i_type(56, rv_reg(reg), RV_FUNCT3_SLL, RV_T5, RV_OPCODE_OP_IMM));
+        rv64_code_append(code, encode_i_type(0x400 | 56, RV_T5, RV_FUNCT3_SRA, RV_T5, RV_OPCODE_OP_IMM));
+        emit_mem(code, 1, RV_FUNCT3_W, RV_T5, s->memOffset);
+        return 0;
+    }
+    emit_mem(code, 1, RV_FUNCT3_W, rv_reg(reg), s->memOffset);
+    return 1;
+}
+
+static void rv_load_imm(void *ctx, int reg, int imm) {
+    RVContext *rv = ctx;
+    rv->isConst[reg] = 1;
+    rv->constVal[reg] = imm;
+    if (fits_imm12(imm)) {
+        rv64_code_append(rv->code, encode_i_type(imm, RV_ZERO, RV_FUNCT3_ADD, rv_reg(reg), RV_OPCODE_OP_IMM));
+        return;
+    }
+    uint32_t hi;
+    int lo;
+    split_hi_lo(imm, &hi, &lo);
+    rv64_code_append(rv->code, encode_u_type(hi, rv_reg(reg), RV_OPCODE_LUI));
+    if (lo != 0) {
+        rv64_code_append(rv->code, encode_i_type(lo, rv_reg(reg), RV_FUNCT3_ADD, rv_reg(reg), RV_OPCODE_OP_IMM_32));
+    }
+}
+
+static void rv_move(void *ctx, int dst, int src) {
+    RVContext *rv = ctx;
+    rv->isConst[dst] = rv->isConst[src];
+    rv->constVal[dst] = rv->constVal[src];
+    rv64_code_append(rv->code, encode_i_type(0, rv_reg(src), RV_FUNCT3_ADD, rv_reg(dst), RV_OPCODE_OP_IMM));
+}
+
+/* The *w forms compute in 32 bits and sign-extend, which is exactly the
+   interpreter's int arithmetic, and mulw/divw write rd directly */
+static void rv_arith(void *ctx, TACOp op, int dst, int left, int right, int line) {
+    RVContext *rv = ctx;
+    int funct7 = RV_FUNCT7_BASE, funct3 = RV_FUNCT3_ADD;
+    (void)line;
+
+    switch (op) {
+        case TAC_SUB: funct7 = RV_FUNCT7_SUB; break;
+        case TAC_MUL: funct7 = RV_FUNCT7_MULDIV; break;
+        case TAC_DIV:
+            funct7 = RV_FUNCT7_MULDIV;
+            funct3 = RV_FUNCT3_DIV;
+            // divw by zero yields -1 instead of trapping; stop like the interpreter
+            if (!rv->isConst[right] || rv->constVal[right] == 0) {
+                rv64_code_append(rv->code, encode_b_type(8, RV_ZERO, rv_reg(right), RV_FUNCT3_BNE, RV_OPCODE_BRANCH));
+                rv64_code_append(rv->code, RV_EBREAK);
+            }
+            break;
+        default: break;
+    }
+    rv64_code_append(rv->code, encode_r_type(funct7, rv_reg(right), rv_reg(left), funct3, rv_reg(dst), RV_OPCODE_OP_32));
+    rv->isConst[dst] = 0;
+}
+
+static void rv_spill(void *ctx, int reg, int tempNum) {
+    RV64Code *code = ((RVContext *)ctx)->code;
+    emit_mem(code, 1, RV_FUNCT3_D, rv_reg(reg), code->spillBase + tempNum * 8);
+}
+
+static void rv_reload(void *ctx, int reg, int tempNum) {
+    RVContext *rv = ctx;
+    emit_mem(rv->code, 0, RV_FUNCT3_D, rv_reg(reg), rv->code->spillBase + tempNum * 8);
+    rv->isConst[reg] = 0;
+}
+
+static const TargetDesc rv64_target = {
+    "RV64IM", 8,
+    rv_load_var, rv_store_var, rv_load_imm, rv_move, rv_arith, rv_spill, rv_reload,
+    NULL, NULL, NULL,
+};
+
+static int data_size(const SymbolTable *st) {
+    int total = 0;
+    for (int i = 0; i < st->count; i++) {
+        if (st->entries[i].memOffset + st->entries[i].size > total)
+            total = st->entries[i].memOffset + st->entries[i].size;
+    }
+    return total;
+}
+
+RV64Code *rv64_assemble(TACProgram *prog) {
+    RV64Code *code = calloc(1, sizeof(RV64Code));
+    if (!code) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    code->symbols = prog->symbols;
+    code->spillBase = (data_size(code->symbols) + 7) & ~7;
+
+    RVContext rv;
+    memset(&rv, 0, sizeof(rv));
+    rv.code = code;
+    tac_lower(prog, &rv64_target, &rv);
+    return code;
+}
+
+unsigned char *rv64_data_image(const RV64Code *code, int *size) {
+    SymbolTable *st = code->symbols;
+    int total = data_size(st);
+    unsigned char *image = calloc(total > 0 ? total : 1, 1);
+    if (!image) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+
+    for (int i = 0; i < st->count; i++) {
+        Symbol *s = &st->entries[i];
+        if (!s->hasInitValue || s->memOffset < 0) continue;
+        unsigned char *p = image + s->memOffset;
+        uint32_t v = (uint32_t)s->initValue;
+        int width = s->type == TYPE_CHR ? 1 : 4;
+        for (int b = 0; b < width; b++) p[b] = (unsigned char)(v >> (8 * b));
+    }
+
+    *size = total;
+    return image;
+}
+
+static const char *mem_mnemonic(int opcode, int funct3) {
+    int store = opcode == RV_OPCODE_STORE;
+    switch (funct3) {
+        case RV_FUNCT3_B: return store ? "sb" : "lb";
+        case RV_FUNCT3_W: return store ? "sw" : "lw";
+        case RV_FUNCT3_D: return store ? "sd" : "ld";
+        default:          return NULL;
+    }
+}
+
+char *rv64_disassemble(uint32_t word, char *buf, int size) {
+    int opcode = RV_OPCODE(word), funct3 = RV_FUNCT3(word), funct7 = RV_FUNCT7(word);
+    const char *rd = abi_names[RV_RD(word)];
+    const char *rs1 = abi_names[RV_RS1(word)];
+    const char *rs2 = abi_names[RV_RS2(word)];
+
+    switch (opcode) {
+        case RV_OPCODE_LUI:
+            snprintf(buf, size, "lui %s, 0x%x", rd, (unsigned)(word >> 12));
+            return buf;
+        case RV_OPCODE_OP_IMM:
+            if (funct3 == RV_FUNCT3_ADD) {
+                snprintf(buf, size, "addi %s, %s, %d", rd, rs1, RV_IMM_I(word));
+                return buf;
+            }
+            if (funct3 == RV_FUNCT3_SLL || funct3 == RV_FUNCT3_SRA) {
+                const char *name = funct3 == RV_FUNCT3_SLL ? "slli" : (funct7 & RV_FUNCT7_SUB) ? "srai" : "srli";
+                snprintf(buf, size, "%s %s, %s, %d", name, rd, rs1, RV_RS2(word) | ((funct7 & 1) << 5));
+                return buf;
+            }
+            break;
+        case RV_OPCODE_OP_IMM_32:
+            if (funct3 == RV_FUNCT3_ADD) {
+                snprintf(buf, size, "addiw %s, %s, %d", rd, rs1, RV_IMM_I(word));
+                return buf;
+            }
+            break;
+        case RV_OPCODE_OP_32: {
+            const char *name = NULL;
+            if (funct7 == RV_FUNCT7_BASE && funct3 == RV_FUNCT3_ADD) name = "addw";
+            else if (funct7 == RV_FUNCT7_SUB && funct3 == RV_FUNCT3_ADD) name = "subw";
+            else if (funct7 == RV_FUNCT7_MULDIV && funct3 == RV_FUNCT3_ADD) name = "mulw";
+            else if (funct7 == RV_FUNCT7_MULDIV && funct3 == RV_FUNCT3_DIV) name = "divw";
+            if (name) {
+                snprintf(buf, size, "%s %s, %s, %s", name, rd, rs1, rs2);
+                return buf;
+            }
+            break;
+        }
+        case RV_OPCODE_LOAD:
+            if (mem_mnemonic(opcode, funct3)) {
+                snprintf(buf, size, "%s %s, %d(%s)", mem_mnemonic(opcode, funct3), rd, RV_IMM_I(word), rs1);
+                return buf;
+            }
+            break;
+        case RV_OPCODE_STORE:
+            if (mem_mnemonic(opcode, funct3)) {
+                snprintf(buf, size, "%s %s, %d(%s)", mem_mnemonic(opcode, funct3), rs2, RV_IMM_S(word), rs1);
+                return buf;
+            }
+            break;
+        case RV_OPCODE_BRANCH:
+            if (funct3 == RV_FUNCT3_BNE) {
+                snprintf(buf, size, "bne %s, %s, .%+d", rs1, rs2, RV_IMM_B(word));
+                return buf;
+            }
+            break;
+        case RV_OPCODE_SYSTEM:
+            if (word == RV_EBREAK) {
+                snprintf(buf, size, "ebreak");
+                return buf;
+            }
+            break;
+        default:
+            break;
+    }
+
+    snprintf(buf, size, ".word 0x%08x", word);
+    return buf;
+}
+
+int rv64_write_listing(const RV64Code *code, const char *path) {
+    FILE *out = fopen(path, "w");
+    if (!out) {
+        fprintf(stderr, "Could not open '%s' for writing\n", path);
+        return 1;
+    }
+
+    fprintf(out, "# Generated by the Colang RV64IM backend; data is addressed from 0\n");
+    fprintf(out, "    .data\n");
+    for (int i = 0; i < code->symbols->count; i++) {
+        Symbol *s = &code->symbols->entries[i];
+        int value = s->hasInitValue ? s->initValue : 0;
+        if (s->type == TYPE_CHR) {
+            fprintf(out, "%s: .byte %d\n    .space %d\n", s->name, value, s->size - 1);
+        } else {
+            fprintf(out, "%s: .word %d\n    .space %d\n", s->name, value, s->size - 4);
+        }
+    }
+
+    char line[64];
+    fprintf(out, "\n    .text\n");
+    for (int i = 0; i < code->count; i++) {
+        rv64_disassemble(code->words[i], line, sizeof(line));
+        fprintf(out, "    %-28s # 0x%08x\n", line, code->words[i]);
+    }
+    fclose(out);
+    return 0;
+}
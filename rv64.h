@@ -0,0 +1,79 @@
+#ifndef RV64_H
+#define RV64_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "tac.h"
+
+/* RV64IM major opcodes */
+#define RV_OPCODE_LOAD      0x03
+#define RV_OPCODE_OP_IMM    0x13
+#define RV_OPCODE_OP_IMM_32 0x1B
+#define RV_OPCODE_STORE     0x23
+#define RV_OPCODE_OP        0x33
+#define RV_OPCODE_LUI       0x37
+#define RV_OPCODE_OP_32     0x3B
+#define RV_OPCODE_BRANCH    0x63
+#define RV_OPCODE_SYSTEM    0x73
+
+/* funct3 values */
+#define RV_FUNCT3_ADD       0x0   // addi, addiw, addw, subw, mulw
+#define RV_FUNCT3_SLL       0x1   // slli
+#define RV_FUNCT3_SRA       0x5   // srai
+#define RV_FUNCT3_DIV       0x4   // divw
+#define RV_FUNCT3_B         0x0   // lb, sb
+#define RV_FUNCT3_W         0x2   // lw, sw
+#define RV_FUNCT3_D         0x3   // ld, sd
+#define RV_FUNCT3_BNE       0x1
+
+/* funct7 values */
+#define RV_FUNCT7_BASE      0x00
+#define RV_FUNCT7_SUB       0x20  // also selects srai
+#define RV_FUNCT7_MULDIV    0x01
+
+#define RV_EBREAK           0x00100073
+
+/* Registers the backend uses */
+#define RV_ZERO             0
+#define RV_A0               10    // a0..a7 are the allocatable registers
+#define RV_T5               30    // sign-extension scratch
+#define RV_T6               31    // address scratch for offsets beyond 12 bits
+
+/* Field extraction */
+#define RV_OPCODE(w)    ((w) & 0x7F)
+#define RV_RD(w)        (((w) >> 7) & 0x1F)
+#define RV_FUNCT3(w)    (((w) >> 12) & 0x7)
+#define RV_RS1(w)       (((w) >> 15) & 0x1F)
+#define RV_RS2(w)       (((w) >> 20) & 0x1F)
+#define RV_FUNCT7(w)    (((w) >> 25) & 0x7F)
+#define RV_IMM_I(w)     ((int32_t)(w) >> 20)
+#define RV_IMM_S(w)     ((int32_t)((((int32_t)(w) >> 25) * 32) | (int32_t)(((w) >> 7) & 0x1F)))
+#define RV_IMM_B(w)     ((int32_t)((((int32_t)(w) >> 31) * 4096) | (int32_t)((((w) >> 7) & 0x1) << 11) | \
+                         (int32_t)((((w) >> 25) & 0x3F) << 5) | (int32_t)((((w) >> 8) & 0xF) << 1)))
+#define RV_IMM_U(w)     ((int32_t)((w) & 0xFFFFF000u))
+
+/* Encoded RV64IM program. Data uses the same offsets as the MIPS code
+   (compute_symbol_offsets), stored little-endian from address 0; spilled
+   temps follow the data at spillBase. */
+typedef struct {
+    uint32_t *words;
+    int count;
+    int capacity;
+    int spillBase;
+    SymbolTable *symbols;   // variables the data is laid out from
+} RV64Code;
+
+/* Lower a program through the shared register allocator */
+RV64Code *rv64_assemble(TACProgram *prog);
+void rv64_code_free(RV64Code *code);
+
+/* Initial contents of memory (little-endian), built from the symbol table */
+unsigned char *rv64_data_image(const RV64Code *code, int *size);
+
+/* Render one instruction in GNU as syntax with ABI register names */
+char *rv64_disassemble(uint32_t word, char *buf, int size);
+
+/* Write a .data/.text listing with each instruction's encoding */
+int rv64_write_listing(const RV64Code *code, const char *path);
+
+#endif
@@ -0,0 +1,199 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "rv64_sim.h"
+#include "symbol_table.h"
+
+/* Machine state for one run */
+typedef struct {
+    int64_t regs[32];
+    unsigned char *mem;
+} RV64Machine;
+
+/* Little-endian memory access, returns 0 when the address is out of range */
+static int mem_check(uint64_t addr, int width) {
+    return addr + (uint64_t)width <= RV64_SIM_MEMORY;
+}
+
+static int64_t mem_load(RV64Machine *m, uint64_t addr, int width) {
+    uint64_t v = 0;
+    for (int i = width - 1; i >= 0; i--) v = (v << 8) | m->mem[addr + i];
+    switch (width) {
+        case 1:  return (int8_t)v;
+        case 4:  return (int32_t)v;
+        default: return (int64_t)v;
+    }
+}
+
+static void mem_store(RV64Machine *m, uint64_t addr, int width, int64_t value) {
+    uint64_t v = (uint64_t)value;
+    for (int i = 0; i < width; i++) {
+        m->mem[addr + i] = (unsigned char)v;
+        v >>= 8;
+    }
+}
+
+static int access_width(int funct3) {
+    switch (funct3) {
+        case RV_FUNCT3_B: return 1;
+        case RV_FUNCT3_W: return 4;
+        case RV_FUNCT3_D: return 8;
+        default:          return 0;
+    }
+}
+
+/* Compare final memory with the symbol values left by tac_execute */
+static int check_symbols(RV64Machine *m, SymbolTable *st) {
+    int mismatches = 0;
+    for (int i = 0; i < st->count; i++) {
+        Symbol *s = &st->entries[i];
+        if (s->memOffset < 0 || !mem_check((uint64_t)s->memOffset, 4)) continue;
+
+        int expected, actual;
+        if (s->type == TYPE_CHR) {
+            expected = (int)VALUE_CHR(s->value);
+            actual = (int)mem_load(m, (uint64_t)s->memOffset, 1);
+        } else {
+            expected = VALUE_NUM(s->value);
+            actual = (int)mem_load(m, (uint64_t)s->memOffset, 4);
+        }
+
+        if (expected != actual) {
+            fprintf(stderr, "RV64 simulation mismatch: '%s' is %d in memory, %d after execution\n",
+                    s->name, actual, expected);
+            mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+static int fault(RV64SimStats *stats, int pc, const char *what, uint32_t w) {
+    fprintf(stderr, "RV64 simulation fault at word %d: %s (0x%08x)\n", pc, what, w);
+    stats->faulted = 1;
+    return 0;
+}
+
+/* Execute one instruction; returns the index of the next one */
+static int step(RV64Machine *m, const RV64Code *code, int pc, RV64SimStats *stats) {
+    uint32_t w = code->words[pc];
+    int64_t *r = m->regs;
+    int rd = RV_RD(w), rs1 = RV_RS1(w), rs2 = RV_RS2(w);
+    int funct3 = RV_FUNCT3(w), funct7 = RV_FUNCT7(w);
+
+    switch (RV_OPCODE(w)) {
+        case RV_OPCODE_LUI:
+            r[rd] = RV_IMM_U(w);
+            break;
+        case RV_OPCODE_OP_IMM: {
+            int shamt = RV_IMM_I(w) & 0x3F;
+            if (funct3 == RV_FUNCT3_ADD) {
+                r[rd] = (int64_t)((uint64_t)r[rs1] + (uint64_t)(int64_t)RV_IMM_I(w));
+            } else if (funct3 == RV_FUNCT3_SLL && (funct7 >> 1) == 0) {
+                r[rd] = (int64_t)((uint64_t)r[rs1] << shamt);
+            } else if (funct3 == RV_FUNCT3_SRA && (funct7 >> 1) == (RV_FUNCT7_SUB >> 1)) {
+                r[rd] = r[rs1] >> shamt;
+            } else {
+                return fault(stats, pc, "unknown instruction", w);
+            }
+            break;
+        }
+        case RV_OPCODE_OP_IMM_32:
+            if (funct3 != RV_FUNCT3_ADD) return fault(stats, pc, "unknown instruction", w);
+            r[rd] = (int32_t)((uint32_t)r[rs1] + (uint32_t)RV_IMM_I(w));
+            break;
+        case RV_OPCODE_OP_32: {
+            uint32_t a = (uint32_t)r[rs1], b = (uint32_t)r[rs2];
+            if (funct7 == RV_FUNCT7_BASE && funct3 == RV_FUNCT3_ADD) {
+                r[rd] = (int32_t)(a + b);
+            } else if (funct7 == RV_FUNCT7_SUB && funct3 == RV_FUNCT3_ADD) {
+                r[rd] = (int32_t)(a - b);
+            } else if (funct7 == RV_FUNCT7_MULDIV && funct3 == RV_FUNCT3_ADD) {
+                r[rd] = (int32_t)(a * b);
+            } else if (funct7 == RV_FUNCT7_MULDIV && funct3 == RV_FUNCT3_DIV) {
+                // Architectural results for the two cases C leaves undefined
+                if (b == 0) r[rd] = -1;
+                else if ((int32_t)a == INT32_MIN && (int32_t)b == -1) r[rd] = INT32_MIN;
+                else r[rd] = (int32_t)a / (int32_t)b;
+            } else {
+                return fault(stats, pc, "unknown instruction", w);
+            }
+            break;
+        }
+        case RV_OPCODE_LOAD:
+        case RV_OPCODE_STORE: {
+            int store = RV_OPCODE(w) == RV_OPCODE_STORE;
+            int width = access_width(funct3);
+            if (!width) return fault(stats, pc, "unknown instruction", w);
+            uint64_t addr = (uint64_t)(r[rs1] + (store ? RV_IMM_S(w) : RV_IMM_I(w)));
+            if (!mem_check(addr, width)) return fault(stats, pc, "address out of range", w);
+            if (store) {
+                mem_store(m, addr, width, r[rs2]);
+                stats->stores++;
+            } else {
+                r[rd] = mem_load(m, addr, width);
+                stats->loads++;
+            }
+            break;
+        }
+        case RV_OPCODE_BRANCH:
+            if (funct3 != RV_FUNCT3_BNE) return fault(stats, pc, "unknown instruction", w);
+            if (r[rs1] != r[rs2]) return pc + RV_IMM_B(w) / 4;
+            break;
+        case RV_OPCODE_SYSTEM:
+            if (w == RV_EBREAK) return fault(stats, pc, "ebreak (division by zero)", w);
+            return fault(stats, pc, "unknown instruction", w);
+        default:
+            return fault(stats, pc, "unknown instruction", w);
+    }
+
+    r[0] = 0;
+    return pc + 1;
+}
+
+int rv64_simulate(const RV64Code *code, RV64SimStats *stats) {
+    memset(stats, 0, sizeof(*stats));
+    stats->staticCount = code->count;
+
+    RV64Machine m;
+    memset(&m, 0, sizeof(m));
+    m.mem = calloc(RV64_SIM_MEMORY, 1);
+    if (!m.mem) {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    int imageSize;
+    unsigned char *image = rv64_data_image(code, &imageSize);
+    memcpy(m.mem, image, imageSize < RV64_SIM_MEMORY ? imageSize : RV64_SIM_MEMORY);
+    free(image);
+
+    int pc = 0;
+    while (pc >= 0 && pc < code->count && !stats->faulted) {
+        stats->instructions++;
+        pc = step(&m, code, pc, stats);
+    }
+    if (!stats->faulted && pc != code->count) {
+        fprintf(stderr, "RV64 simulation fault: branch to word %d\n", pc);
+        stats->faulted = 1;
+    }
+
+    if (!stats->faulted) stats->mismatches = check_symbols(&m, code->symbols);
+
+    free(m.mem);
+    return stats->faulted || stats->mismatches ? 1 : 0;
+}
+
+void rv64_sim_report(const RV64SimStats *stats, int mipsCount, FILE *out) {
+    fprintf(out, "MIPS64 instructions: %d\n", mipsCount);
+    fprintf(out, "RV64IM instructions: %ld\n", stats->staticCount);
+    fprintf(out, "executed: %ld\n", stats->instructions);
+    fprintf(out, "loads: %ld\n", stats->loads);
+    fprintf(out, "stores: %ld\n", stats->stores);
+    if (stats->faulted)
+        fprintf(out, "result: fault\n");
+    else if (stats->mismatches)
+        fprintf(out, "result: %d variable(s) differ from tac_execute\n", stats->mismatches);
+    else
+        fprintf(out, "result: memory matches tac_execute\n");
+}
@@ -0,0 +1,25 @@
+#ifndef RV64_SIM_H
+#define RV64_SIM_H
+
+#include <stdio.h>
+#include "rv64.h"
+
+#define RV64_SIM_MEMORY (1 << 20)
+
+typedef struct {
+    long staticCount;     // encoded instructions
+    long instructions;    // executed instructions
+    long loads;
+    long stores;
+    int mismatches;       // variables whose memory differs from tac_execute
+    int faulted;          // bad address, unknown instruction or ebreak
+} RV64SimStats;
+
+/* Decode and run the program from a fresh machine whose memory holds the
+   data image, then compare memory with the symbol table */
+int rv64_simulate(const RV64Code *code, RV64SimStats *stats);
+
+/* mipsCount is the encoded MIPS64 instruction count, for comparison */
+void rv64_sim_report(const RV64SimStats *stats, int mipsCount, FILE *out);
+
+#endif
@@ -0,0 +1,411 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "scanner.h"
+#include "source.h"
+#include "native.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define SCANNER_BENCH_MS 200.0
+
+/* ---- Byte classes ----
+   The vector loops load aligned 16-byte blocks, which may take in bytes
+   before text or past end; the buffer contract in scanner.h keeps those
+   inside the caller's allocation. The NUL at end is outside every run
+   class, which stops the runs. */
+
+static int is_blank(unsigned char c)  { return c == ' ' || c == '\t'; }
+static int is_digit(unsigned char c)  { return c >= '0' && c <= '9'; }
+static int is_alpha(unsigned char c)  { return ((c | 0x20) >= 'a' && (c | 0x20) <= 'z') || c == '_'; }
+static int is_ident(unsigned char c)  { return is_alpha(c) || is_digit(c); }
+
+#ifdef __SSE2__
+/* Lanes holding a byte in [lo, lo + n), via one signed compare */
+static __m128i in_range(__m128i v, char lo, int n) {
+    __m128i shifted = _mm_sub_epi8(v, _mm_set1_epi8((char)(lo + 128)));
+    return _mm_cmplt_epi8(shifted, _mm_set1_epi8((char)(-128 + n)));
+}
+
+static unsigned blank_mask(__m128i v) {
+    __m128i m = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+                             _mm_cmpeq_epi8(v, _mm_set1_epi8('\t')));
+    return (unsigned)_mm_movemask_epi8(m);
+}
+
+static unsigned ident_mask(__m128i v) {
+    __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+    __m128i m = _mm_or_si128(in_range(lower, 'a', 26), in_range(v, '0', 10));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('_')));
+    return (unsigned)_mm_movemask_epi8(m);
+}
+
+/* First byte of the run starting at p that is outside the class */
+static char *skip_class(char *p, unsigned (*mask)(__m128i)) {
+    uintptr_t off = (uintptr_t)p & 15;
+    const char *block = p - off;
+    unsigned out = ~mask(_mm_load_si128((const __m128i *)block)) & (0xFFFFu << off) & 0xFFFFu;
+    while (!out) {
+        block += 16;
+        out = ~mask(_mm_load_si128((const __m128i *)block)) & 0xFFFFu;
+    }
+    return (char *)block + __builtin_ctz(out);
+}
+
+/* First a or b at or after p, or end */
+static char *find_either(char *p, char *end, char a, char b) {
+    if (p >= end) return end;
+    __m128i va = _mm_set1_epi8(a), vb = _mm_set1_epi8(b);
+    uintptr_t off = (uintptr_t)p & 15;
+    char *block = p - off;
+    for (;;) {
+        __m128i v = _mm_load_si128((const __m128i *)block);
+        unsigned hit = (unsigned)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, va),
+                                                                _mm_cmpeq_epi8(v, vb)));
+        hit &= 0xFFFFu << off;
+        if (hit) {
+            char *at = block + __builtin_ctz(hit);
+            return at < end ? at : end;
+        }
+        block += 16;
+        off = 0;
+        if (block >= end) return end;
+    }
+}
+
+/* Most runs are a byte or two; only longer ones go to the vector loop */
+static char *skip_blanks(char *p) {
+    if (!is_blank((unsigned char)p[0])) return p;
+    if (!is_blank((unsigned char)p[1])) return p + 1;
+    return skip_class(p + 2, blank_mask);
+}
+
+static char *skip_ident(char *p) {
+    if (!is_ident((unsigned char)p[0])) return p;
+    if (!is_ident((unsigned char)p[1])) return p + 1;
+    return skip_class(p + 2, ident_mask);
+}
+#else
+static char *skip_blanks(char *p) {
+    while (is_blank((unsigned char)*p)) p++;
+    return p;
+}
+
+static char *skip_ident(char *p) {
+    while (is_ident((unsigned char)*p)) p++;
+    return p;
+}
+
+static char *find_either(char *p, char *end, char a, char b) {
+    while (p < end && *p != a && *p != b) p++;
+    return p;
+}
+#endif
+
+/* ---- Scanner ---- */
+
+void scanner_init(Scanner *s, char *text, size_t size) {
+    s->cur = text;
+    s->end = text + size;
+    s->tok = s->end;
+    s->heldAt = NULL;
+    s->held = 0;
+    s->line = 1;
+    s->badChar = 0;
+}
+
+/* End the token at s->cur the way flex ends yytext */
+static int token(Scanner *s, char *start, int code) {
+    s->tok = start;
+    s->heldAt = s->cur;
+    s->held = *s->cur;
+    *s->cur = '\0';
+    return code;
+}
+
+/* Report the character and hand the parser a code it has no token for;
+   like lexer.l, which exits there, nothing after it is scanned */
+static int unexpected(Scanner *s, char *at) {
+    s->cur = at + 1;
+    token(s, at, SCANNER_BAD_TOKEN);
+    fprintf(stderr, "Error at line %d: Unexpected character '%s'\n", s->line, s->tok);
+    s->badChar = 1;
+    return SCANNER_BAD_TOKEN;
+}
+
+static int keyword(const char *p, int len) {
+    switch (len) {
+        case 3:
+            if (memcmp(p, "chr", 3) == 0) return TOK_CHR;
+            if (memcmp(p, "shw", 3) == 0) return TOK_SHW;
+            break;
+        case 4:
+            if (memcmp(p, "nmbr", 4) == 0) return TOK_NMBR;
+            if (memcmp(p, "flex", 4) == 0) return TOK_FLEX;
+            break;
+    }
+    return TOK_IDENTIFIER;
+}
+
+/* '\n', '\t', '\\', '\'' and '\0'; any other escape is not a literal */
+static int char_escape(char c, char *out) {
+    switch (c) {
+        case 'n':  *out = '\n'; return 1;
+        case 't':  *out = '\t'; return 1;
+        case '\\': *out = '\\'; return 1;
+        case '\'': *out = '\''; return 1;
+        case '0':  *out = '\0'; return 1;
+        default:   return 0;
+    }
+}
+
+/* Closing quote of the string opened at p, or NULL when it is not closed
+   on this line */
+static char *string_close(char *open, char *end) {
+    char *quote = open + 1;
+    for (;;) {
+        char *stop = find_either(quote, end, '"', '\n');
+        char *esc = memchr(quote, '\\', (size_t)(stop - quote));
+        if (!esc) return stop < end && *stop == '"' ? stop : NULL;
+        if (esc + 1 >= end || esc[1] == '\n') return NULL;
+        quote = esc + 2;
+    }
+}
+
+int scanner_next(Scanner *s, YYSTYPE *lval) {
+    if (s->heldAt) {
+        *s->heldAt = s->held;
+        s->heldAt = NULL;
+    }
+    if (s->badChar) {
+        s->cur = s->end;
+        s->tok = s->end;
+        return 0;
+    }
+
+    for (;;) {
+        char *p = skip_blanks(s->cur);
+        if (p >= s->end) {
+            s->cur = s->end;
+            s->tok = s->end;
+            return 0;
+        }
+
+        char c = *p;
+        s->cur = p + 1;
+        switch (c) {
+            case '\n':
+                s->line++;
+                return token(s, p, TOK_NEWLINE);
+            case '\r':
+                if (p[1] != '\n') return unexpected(s, p);
+                s->cur = p + 2;
+                s->line++;
+                return token(s, p, TOK_NEWLINE);
+
+            case '@':
+                s->cur = find_either(p, s->end, '\n', '\n');
+                continue;
+            case '/':
+                if (p[1] == '/') {
+                    s->cur = find_either(p, s->end, '\n', '\n');
+                    continue;
+                }
+                if (p[1] == '*') {
+                    // Unterminated comments run to the end of input
+                    char *q = p + 2;
+                    for (;;) {
+                        q = find_either(q, s->end, '*', '\n');
+                        if (q >= s->end) break;
+                        if (*q == '\n') {
+                            s->line++;
+                            q++;
+                        } else if (q[1] == '/') {
+                            q += 2;
+                            break;
+                        } else {
+                            q++;
+                        }
+                    }
+                    s->cur = q;
+                    continue;
+                }
+                if (p[1] == ':') {
+                    s->cur = p + 2;
+                    return token(s, p, TOK_DIV_ASSIGN);
+                }
+                return token(s, p, TOK_DIV);
+            case '+':
+            case '-':
+            case '*':
+                if (p[1] == ':') {
+                    s->cur = p + 2;
+                    return token(s, p, c == '+' ? TOK_PLUS_ASSIGN : c == '-' ? TOK_MINUS_ASSIGN : TOK_MULT_ASSIGN);
+                }
+                return token(s, p, c == '+' ? TOK_PLUS : c == '-' ? TOK_MINUS : TOK_MULT);
+            case ':': return token(s, p, TOK_ASSIGN);
+            case '.': return token(s, p, TOK_CONCAT);
+            case ',': return token(s, p, TOK_COMMA);
+            case '(': return token(s, p, TOK_LPAREN);
+            case ')': return token(s, p, TOK_RPAREN);
+
+            case '\\': {
+                // Line continuation: backslash, blanks, newline
+                char *q = skip_blanks(p + 1);
+                if (*q == '\r') q++;
+                if (q >= s->end || *q != '\n') return unexpected(s, p);
+                s->line++;
+                s->cur = q + 1;
+                continue;
+            }
+
+            case '\'':
+                if (p[1] == '\\') {
+                    if (p + 3 >= s->end || p[3] != '\'' || !char_escape(p[2], &lval->ch)) return unexpected(s, p);
+                    s->cur = p + 4;
+                    return token(s, p, TOK_CHAR_LITERAL);
+                }
+                if (p + 2 >= s->end || p[2] != '\'') return unexpected(s, p);
+                if (p[1] == '\n') s->line++;
+                lval->ch = p[1];
+                s->cur = p + 3;
+                return token(s, p, TOK_CHAR_LITERAL);
+
+            case '"': {
+                char *close = string_close(p, s->end);
+                if (!close) return unexpected(s, p);
+                lval->slice.text = p + 1;
+                lval->slice.len = (int)(close - p - 1);
+                lval->slice.escaped = memchr(p + 1, '\\', (size_t)lval->slice.len) != NULL;
+                s->cur = close + 1;
+                return token(s, p, TOK_STRING_LITERAL);
+            }
+
+            default:
+                break;
+        }
+
+        if (is_digit((unsigned char)c)) {
+            char *q = p + 1;
+            while (is_digit((unsigned char)*q)) q++;
+            s->cur = q;
+            token(s, p, TOK_NUMBER_LITERAL);
+            lval->num = atoi(s->tok);
+            return TOK_NUMBER_LITERAL;
+        }
+        if (is_alpha((unsigned char)c)) {
+            char *q = skip_ident(p + 1);
+            int len = (int)(q - p);
+            s->cur = q;
+            int code = keyword(p, len);
+            if (code == TOK_IDENTIFIER) {
+                lval->slice.text = p;
+                lval->slice.len = len;
+                lval->slice.escaped = 0;
+            }
+            return token(s, p, code);
+        }
+        return unexpected(s, p);
+    }
+}
+
+/* ---- The flex scanner (lex.yy.c, prefix "flex") ---- */
+
+#ifndef COLANG_HAND_SCANNER
+extern YYSTYPE flexlval;
+extern int flexlineno;
+extern int flexlex(void);
+extern void flex_scan_source(char *text, size_t size);
+#endif
+
+/* ---- Throughput ---- */
+
+typedef struct {
+    long tokens;
+    uint64_t digest;    // token codes, values and lines, to compare scanners
+} ScanRun;
+
+static void digest_token(ScanRun *run, int code, const YYSTYPE *v, int line) {
+    uint64_t h = run->digest ^ (uint64_t)code;
+    h = (h ^ (uint64_t)line) * 1099511628211u;
+    if (code == TOK_NUMBER_LITERAL) h ^= (uint32_t)v->num;
+    else if (code == TOK_CHAR_LITERAL) h ^= (unsigned char)v->ch;
+    else if (code == TOK_IDENTIFIER || code == TOK_STRING_LITERAL) {
+        for (int i = 0; i < v->slice.len; i++) h = (h ^ (unsigned char)v->slice.text[i]) * 1099511628211u;
+        h ^= (uint64_t)v->slice.escaped << 40;
+    }
+    run->digest = h * 1099511628211u;
+    run->tokens++;
+}
+
+static void run_hand(Source *src, ScanRun *run, int digest) {
+    Scanner s;
+    YYSTYPE v;
+    int code;
+    memset(run, 0, sizeof(*run));
+    scanner_init(&s, src->text, src->size);
+    while ((code = scanner_next(&s, &v)) != 0) {
+        if (digest) digest_token(run, code, &v, s.line);
+        else run->tokens++;
+    }
+}
+
+#ifndef COLANG_HAND_SCANNER
+static void run_flex(Source *src, ScanRun *run, int digest) {
+    int code;
+    memset(run, 0, sizeof(*run));
+    flex_scan_source(src->text, src->size);
+    flexlineno = 1;
+    while ((code = flexlex()) != 0) {
+        if (digest) digest_token(run, code, &flexlval, flexlineno);
+        else run->tokens++;
+    }
+}
+#endif
+
+/* Best MB/s over repeated runs lasting at least SCANNER_BENCH_MS */
+static double throughput(Source *src, void (*scan)(Source *, ScanRun *, int)) {
+    double best = 0, total = 0;
+    ScanRun run;
+    for (int i = 0; i < 3 || total < SCANNER_BENCH_MS; i++) {
+        double start = native_now_ms();
+        scan(src, &run, 0);
+        double ms = native_now_ms() - start;
+        total += ms;
+        if (ms > 0 && (best == 0 || ms < best)) best = ms;
+    }
+    return best > 0 ? (double)src->size / (1024.0 * 1024.0) / (best / 1000.0) : 0;
+}
+
+int scanner_bench(FILE *in, FILE *out) {
+    Source src;
+    if (source_load(in, &src) != 0) return 1;
+
+    ScanRun hand;
+    run_hand(&src, &hand, 1);
+    int matches = 1;
+#ifndef COLANG_HAND_SCANNER
+    ScanRun ref;
+    run_flex(&src, &ref, 1);
+    matches = hand.tokens == ref.tokens && hand.digest == ref.digest;
+#endif
+
+    fprintf(out, "source: %zu bytes, %ld tokens\n", src.size, hand.tokens);
+#ifdef __SSE2__
+    fprintf(out, "hand scanner (SSE2): %.1f MB/s\n", throughput(&src, run_hand));
+#else
+    fprintf(out, "hand scanner: %.1f MB/s\n", throughput(&src, run_hand));
+#endif
+#ifdef COLANG_HAND_SCANNER
+    fprintf(out, "flex scanner: not linked in this build\n");
+#else
+    fprintf(out, "flex scanner: %.1f MB/s\n", throughput(&src, run_flex));
+    fprintf(out, "tokens: %s\n", matches ? "identical" : "differ");
+#endif
+
+    source_free(&src);
+    return matches ? 0 : 1;
+}
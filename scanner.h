@@ -0,0 +1,42 @@
+#ifndef SCANNER_H
+#define SCANNER_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include "ast.h"
+#include "parser.tab.h"
+
+/* Hand-written scanner producing the same tokens as lexer.l. Blank runs,
+   comments, string bodies and identifier runs are scanned 16 bytes at a
+   time with SSE2 where available. All its state is in the Scanner, so it
+   is the pure parser's yylex (through the Compiler).
+
+   Building scanner.c with -DCOLANG_HAND_SCANNER leaves the flex scanner
+   out: lex.yy.c is then not needed and --scan-bench times this one only. */
+typedef struct {
+    char *cur;          // next byte to scan
+    char *end;          // text + size; end[0] and end[1] are NUL
+    char *tok;          // last token, NUL-terminated like yytext
+    char *heldAt;       // byte overwritten by that NUL
+    char held;
+    int line;
+    int badChar;        // an unexpected character was reported; end of input from here
+} Scanner;
+
+/* Token code for an unexpected character; no grammar token uses it */
+#define SCANNER_BAD_TOKEN 1
+
+/* Scan text in place; text[size] and text[size + 1] must be NUL, and the
+   16-byte blocks holding text[0] through them must be readable (Source
+   and libcolang's copy provide both). Token slices point into text, so it
+   has to outlive the parse. */
+void scanner_init(Scanner *s, char *text, size_t size);
+
+/* Next token code, 0 at end of input; values go to *lval */
+int scanner_next(Scanner *s, YYSTYPE *lval);
+
+/* Time the hand scanner (and flex, when it is linked) over the program
+   on `in`, check that both produce the same tokens and report MB/s */
+int scanner_bench(FILE *in, FILE *out);
+
+#endif
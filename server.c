@@ -0,0 +1,638 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "server.h"
+
+#ifdef __linux__
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "cache.h"
+#include "native.h"
+#include "textbuf.h"
+
+/* ---- Framing ---- */
+
+static void put_u32(TextBuf *b, uint32_t v) {
+    unsigned char bytes[4] = { (unsigned char)(v >> 24), (unsigned char)(v >> 16),
+                               (unsigned char)(v >> 8), (unsigned char)v };
+    textbuf_append(b, (const char *)bytes, 4);
+}
+
+static uint32_t get_u32(const char *p) {
+    const unsigned char *u = (const unsigned char *)p;
+    return (uint32_t)u[0] << 24 | (uint32_t)u[1] << 16 | (uint32_t)u[2] << 8 | u[3];
+}
+
+static void put_text(TextBuf *b, const ColangText *t) {
+    put_u32(b, (uint32_t)t->len);
+    textbuf_append(b, t->data, t->len);
+}
+
+static uint32_t micros(double ms) {
+    return ms <= 0 ? 0 : (uint32_t)(ms * 1000.0);
+}
+
+/* The whole response frame, length prefix included */
+static void encode_response(TextBuf *out, const ColangResult *r) {
+    size_t start = out->len;
+    put_u32(out, 0);
+    unsigned flags = r->cached ? SERVER_RESULT_CACHED : 0;
+    unsigned char head[4] = { (unsigned char)r->status, (unsigned char)r->limit,
+                              (unsigned char)(flags >> 8), (unsigned char)flags };
+    textbuf_append(out, (const char *)head, 4);
+    put_u32(out, (uint32_t)r->errorLine);
+    put_u32(out, (uint32_t)r->instructions);
+    put_u32(out, micros(r->compileMs));
+    put_u32(out, micros(r->runMs));
+    put_text(out, &r->console);
+    put_text(out, &r->assembly);
+    put_text(out, &r->binary);
+    put_text(out, &r->hex);
+
+    uint32_t len = (uint32_t)(out->len - start - 4);
+    out->data[start] = (char)(len >> 24);
+    out->data[start + 1] = (char)(len >> 16);
+    out->data[start + 2] = (char)(len >> 8);
+    out->data[start + 3] = (char)len;
+}
+
+static void decode_options(uint32_t bits, ColangOptions *opts) {
+    colang_options_init(opts);
+    opts->engine = (ColangEngine)(bits & SERVER_ENGINE_MASK);
+    opts->artifacts = (bits >> SERVER_ARTIFACT_SHIFT) & COLANG_ARTIFACT_ALL;
+    opts->peephole = !(bits & SERVER_NO_PEEPHOLE);
+    opts->schedule = !(bits & SERVER_NO_SCHEDULE);
+    opts->peval = (bits & (SERVER_PEVAL | SERVER_PEVAL_VARS)) != 0;
+    opts->pevalVars = (bits & SERVER_PEVAL_VARS) != 0;
+    opts->maxSourceBytes = SERVER_MAX_FRAME;
+}
+
+/* ---- Server state ---- */
+
+typedef struct {
+    int fd;
+    TextBuf in;         // received bytes not yet taken as a request
+    TextBuf out;        // response bytes not yet written
+    size_t outPos;
+    uint32_t events;    // what epoll is watching for
+    int busy;           // a request is with the workers
+    int closed;         // peer gone; freed once no longer busy
+} Conn;
+
+typedef struct Job {
+    Conn *conn;
+    char *frame;        // request payload, options first
+    size_t len;
+    TextBuf reply;
+    struct Job *next;
+} Job;
+
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t ready;
+    Job *pending;       // FIFO for the workers
+    Job *pendingTail;
+    Job *done;          // finished, for the event loop
+    int stopping;
+    int wake;           // eventfd the workers signal the loop with
+    int epoll;
+    long served;
+    ColangCache *cache;
+} Server;
+
+static volatile sig_atomic_t stop_requested;
+
+static void on_signal(int sig) {
+    (void)sig;
+    stop_requested = 1;
+}
+
+static void *xcalloc(size_t n, size_t size) {
+    void *p = calloc(n, size);
+    if (!p) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    return p;
+}
+
+/* ---- Workers ---- */
+
+static void *worker_main(void *arg) {
+    Server *srv = arg;
+    ColangContext *ctx = colang_create();
+    colang_set_cache(ctx, srv->cache);
+    TextBuf report;
+    textbuf_init(&report);
+
+    for (;;) {
+        pthread_mutex_lock(&srv->lock);
+        while (!srv->pending && !srv->stopping) pthread_cond_wait(&srv->ready, &srv->lock);
+        Job *job = srv->pending;
+        if (!job) {
+            pthread_mutex_unlock(&srv->lock);
+            break;
+        }
+        srv->pending = job->next;
+        if (!srv->pending) srv->pendingTail = NULL;
+        pthread_mutex_unlock(&srv->lock);
+
+        ColangOptions opts;
+        ColangResult result;
+        uint32_t bits = get_u32(job->frame);
+        if (bits & SERVER_CACHE_STATS) {
+            memset(&result, 0, sizeof(result));
+            textbuf_clear(&report);
+            if (srv->cache) cache_report(srv->cache, &report);
+            else textbuf_puts(&report, "no cache\n");
+            result.console.data = report.data;
+            result.console.len = report.len;
+            result.assembly.data = result.binary.data = result.hex.data = "";
+        } else {
+            decode_options(bits, &opts);
+            colang_run(ctx, job->frame + 4, job->len - 4, &opts, &result);
+        }
+        encode_response(&job->reply, &result);
+
+        pthread_mutex_lock(&srv->lock);
+        job->next = srv->done;
+        srv->done = job;
+        pthread_mutex_unlock(&srv->lock);
+        uint64_t one = 1;
+        if (write(srv->wake, &one, sizeof(one)) < 0 && errno != EAGAIN) perror("eventfd");
+    }
+
+    textbuf_free(&report);
+    colang_free(ctx);
+    return NULL;
+}
+
+/* ---- Connections ---- */
+
+static void conn_free(Conn *c) {
+    textbuf_free(&c->in);
+    textbuf_free(&c->out);
+    free(c);
+}
+
+static void conn_close(Server *srv, Conn *c) {
+    if (c->closed) return;
+    epoll_ctl(srv->epoll, EPOLL_CTL_DEL, c->fd, NULL);
+    close(c->fd);
+    c->closed = 1;
+    if (!c->busy) conn_free(c);
+}
+
+/* Read only while idle with nothing left to write, so a client that
+   pipelines requests, or never reads its responses, waits in its own
+   socket buffer instead of ours */
+static void conn_watch(Server *srv, Conn *c) {
+    int writing = c->outPos < c->out.len;
+    uint32_t events = (c->busy || writing ? 0 : EPOLLIN) | (writing ? EPOLLOUT : 0);
+    if (events == c->events) return;
+    c->events = events;
+    struct epoll_event ev = { .events = events, .data.ptr = c };
+    epoll_ctl(srv->epoll, EPOLL_CTL_MOD, c->fd, &ev);
+}
+
+/* Write what the socket takes; returns -1 when the peer is gone */
+static int conn_flush(Server *srv, Conn *c) {
+    while (c->outPos < c->out.len) {
+        ssize_t n = send(c->fd, c->out.data + c->outPos, c->out.len - c->outPos, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                conn_watch(srv, c);
+                return 0;
+            }
+            return -1;
+        }
+        c->outPos += (size_t)n;
+    }
+    textbuf_clear(&c->out);
+    c->outPos = 0;
+    conn_watch(srv, c);
+    return 0;
+}
+
+/* Hand the next complete request to the workers, one at a time per
+   connection so responses go back in order. Returns -1 on a bad frame. */
+static int conn_dispatch(Server *srv, Conn *c) {
+    if (c->busy || c->outPos < c->out.len || c->in.len < 4) return 0;
+    uint32_t len = get_u32(c->in.data);
+    if (len < 4 || len > SERVER_MAX_FRAME) return -1;
+    if (c->in.len < 4 + (size_t)len) return 0;
+
+    Job *job = xcalloc(1, sizeof(Job));
+    job->conn = c;
+    job->len = len;
+    job->frame = malloc(len);
+    if (!job->frame) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    memcpy(job->frame, c->in.data + 4, len);
+    textbuf_init(&job->reply);
+    c->in.len -= 4 + (size_t)len;
+    memmove(c->in.data, c->in.data + 4 + len, c->in.len);
+    c->busy = 1;
+    conn_watch(srv, c);
+
+    pthread_mutex_lock(&srv->lock);
+    if (srv->pendingTail) srv->pendingTail->next = job;
+    else srv->pending = job;
+    srv->pendingTail = job;
+    pthread_cond_signal(&srv->ready);
+    pthread_mutex_unlock(&srv->lock);
+    return 0;
+}
+
+/* Stops as soon as a request is dispatched, so c->in never holds more
+   than one frame and the chunk that completed it */
+static void conn_read(Server *srv, Conn *c) {
+    char chunk[65536];
+    while (c->events & EPOLLIN) {
+        ssize_t n = recv(c->fd, chunk, sizeof(chunk), 0);
+        if (n > 0) {
+            textbuf_append(&c->in, chunk, (size_t)n);
+            if (conn_dispatch(srv, c) != 0) break;
+            continue;
+        }
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return;
+        break;
+    }
+    if (!(c->events & EPOLLIN)) return;
+    conn_close(srv, c);
+}
+
+static void accept_all(Server *srv, int listener) {
+    for (;;) {
+        int fd = accept(listener, NULL, NULL);
+        if (fd < 0) return;
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+        Conn *c = xcalloc(1, sizeof(Conn));
+        c->fd = fd;
+        textbuf_init(&c->in);
+        textbuf_init(&c->out);
+        c->events = EPOLLIN;
+        struct epoll_event ev = { .events = EPOLLIN, .data.ptr = c };
+        epoll_ctl(srv->epoll, EPOLL_CTL_ADD, fd, &ev);
+    }
+}
+
+/* Queue finished responses on their connections */
+static void collect_done(Server *srv) {
+    uint64_t count;
+    if (read(srv->wake, &count, sizeof(count)) < 0 && errno != EAGAIN) perror("eventfd");
+
+    pthread_mutex_lock(&srv->lock);
+    Job *job = srv->done;
+    srv->done = NULL;
+    pthread_mutex_unlock(&srv->lock);
+
+    while (job) {
+        Job *next = job->next;
+        Conn *c = job->conn;
+        c->busy = 0;
+        srv->served++;
+        if (c->closed) {
+            conn_free(c);
+        } else {
+            textbuf_append(&c->out, job->reply.data, job->reply.len);
+            if (conn_flush(srv, c) != 0 || conn_dispatch(srv, c) != 0) conn_close(srv, c);
+        }
+        free(job->frame);
+        textbuf_free(&job->reply);
+        free(job);
+        job = next;
+    }
+}
+
+static int listen_on(const char *path) {
+    struct sockaddr_un addr;
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "Socket path too long: %s\n", path);
+        return -1;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        perror("socket");
+        return -1;
+    }
+    unlink(path);
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(fd, 128) != 0) {
+        fprintf(stderr, "Cannot listen on '%s': %s\n", path, strerror(errno));
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+int server_run(const char *path, int workers, ColangCache *cache, FILE *log) {
+    if (workers <= 0) workers = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (workers <= 0) workers = 1;
+
+    int listener = listen_on(path);
+    if (listener < 0) return 1;
+
+    Server srv;
+    memset(&srv, 0, sizeof(srv));
+    srv.cache = cache;
+    pthread_mutex_init(&srv.lock, NULL);
+    pthread_cond_init(&srv.ready, NULL);
+    srv.wake = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    srv.epoll = epoll_create1(EPOLL_CLOEXEC);
+    if (srv.wake < 0 || srv.epoll < 0) {
+        perror("epoll");
+        close(listener);
+        return 1;
+    }
+
+    // Markers telling the listener and the wake-up fd apart from connections
+    static char listenMark, wakeMark;
+    struct epoll_event ev = { .events = EPOLLIN, .data.ptr = &listenMark };
+    epoll_ctl(srv.epoll, EPOLL_CTL_ADD, listener, &ev);
+    ev.data.ptr = &wakeMark;
+    epoll_ctl(srv.epoll, EPOLL_CTL_ADD, srv.wake, &ev);
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = on_signal;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+    stop_requested = 0;
+
+    pthread_t *threads = xcalloc((size_t)workers, sizeof(pthread_t));
+    for (int i = 0; i < workers; i++) pthread_create(&threads[i], NULL, worker_main, &srv);
+    fprintf(log, "serving on %s with %d worker(s)\n", path, workers);
+    fflush(log);
+
+    struct epoll_event events[64];
+    while (!stop_requested) {
+        int n = epoll_wait(srv.epoll, events, 64, -1);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            perror("epoll_wait");
+            break;
+        }
+        for (int i = 0; i < n; i++) {
+            void *p = events[i].data.ptr;
+            if (p == &listenMark) {
+                accept_all(&srv, listener);
+            } else if (p == &wakeMark) {
+                collect_done(&srv);
+            } else {
+                Conn *c = p;
+                if (events[i].events & (EPOLLERR | EPOLLHUP) && !(events[i].events & EPOLLIN)) {
+                    conn_close(&srv, c);
+                    continue;
+                }
+                if (events[i].events & EPOLLOUT && (conn_flush(&srv, c) != 0 || conn_dispatch(&srv, c) != 0)) {
+                    conn_close(&srv, c);
+                    continue;
+                }
+                if (events[i].events & EPOLLIN) conn_read(&srv, c);
+            }
+        }
+    }
+
+    pthread_mutex_lock(&srv.lock);
+    srv.stopping = 1;
+    pthread_cond_broadcast(&srv.ready);
+    pthread_mutex_unlock(&srv.lock);
+    for (int i = 0; i < workers; i++) pthread_join(threads[i], NULL);
+    free(threads);
+    fprintf(log, "served %ld request(s)\n", srv.served);
+    if (cache) {
+        TextBuf report;
+        textbuf_init(&report);
+        cache_report(cache, &report);
+        fwrite(report.data, 1, report.len, log);
+        textbuf_free(&report);
+    }
+
+    // Open connections are dropped without their pending responses
+    close(listener);
+    unlink(path);
+    close(srv.wake);
+    close(srv.epoll);
+    pthread_mutex_destroy(&srv.lock);
+    pthread_cond_destroy(&srv.ready);
+    return 0;
+}
+
+/* ---- Load test client ---- */
+
+typedef struct {
+    const char *path;
+    const TextBuf *request;
+    int requests;
+    double *latencies;  // ms, one per request
+    int answered;
+    int failed;         // status other than COLANG_OK
+    int cached;         // answered from the server's cache
+} Client;
+
+static int read_full(int fd, char *p, size_t n) {
+    while (n > 0) {
+        ssize_t got = recv(fd, p, n, 0);
+        if (got < 0 && errno == EINTR) continue;
+        if (got <= 0) return -1;
+        p += got;
+        n -= (size_t)got;
+    }
+    return 0;
+}
+
+static int write_full(int fd, const char *p, size_t n) {
+    while (n > 0) {
+        ssize_t put = send(fd, p, n, MSG_NOSIGNAL);
+        if (put < 0 && errno == EINTR) continue;
+        if (put <= 0) return -1;
+        p += put;
+        n -= (size_t)put;
+    }
+    return 0;
+}
+
+static int connect_to(const char *path) {
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, path, sizeof(addr.sun_path) - 1);
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) return -1;
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static void *client_main(void *arg) {
+    Client *cl = arg;
+    int fd = connect_to(cl->path);
+    if (fd < 0) {
+        fprintf(stderr, "Cannot connect to '%s': %s\n", cl->path, strerror(errno));
+        return NULL;
+    }
+
+    char *reply = NULL;
+    size_t replyCap = 0;
+    for (int i = 0; i < cl->requests; i++) {
+        double start = native_now_ms();
+        char head[4];
+        if (write_full(fd, cl->request->data, cl->request->len) != 0 || read_full(fd, head, 4) != 0) break;
+        uint32_t len = get_u32(head);
+        if (len < SERVER_RESPONSE_HEADER || len > SERVER_MAX_FRAME) break;
+        if (len > replyCap) {
+            free(reply);
+            reply = xcalloc(1, len);
+            replyCap = len;
+        }
+        if (read_full(fd, reply, len) != 0) break;
+        cl->latencies[cl->answered++] = native_now_ms() - start;
+        if ((unsigned char)reply[0] != COLANG_OK) cl->failed++;
+        if ((unsigned char)reply[3] & SERVER_RESULT_CACHED) cl->cached++;
+    }
+    free(reply);
+    close(fd);
+    return NULL;
+}
+
+static int compare_ms(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return x < y ? -1 : x > y;
+}
+
+int server_load_test(const char *path, const char *source, size_t len,
+                     int clients, int requests, uint32_t options, FILE *out) {
+    if (clients <= 0) clients = 1;
+    if (requests <= 0) requests = 1;
+
+    TextBuf request;
+    textbuf_init(&request);
+    put_u32(&request, (uint32_t)(len + 4));
+    put_u32(&request, options);
+    textbuf_append(&request, source, len);
+
+    Client *cls = xcalloc((size_t)clients, sizeof(Client));
+    pthread_t *threads = xcalloc((size_t)clients, sizeof(pthread_t));
+    double *all = xcalloc((size_t)clients * (size_t)requests, sizeof(double));
+
+    double start = native_now_ms();
+    for (int i = 0; i < clients; i++) {
+        cls[i].path = path;
+        cls[i].request = &request;
+        cls[i].requests = requests;
+        cls[i].latencies = all + (size_t)i * (size_t)requests;
+        pthread_create(&threads[i], NULL, client_main, &cls[i]);
+    }
+    long answered = 0, failed = 0, cached = 0;
+    for (int i = 0; i < clients; i++) {
+        pthread_join(threads[i], NULL);
+        // Pack each client's answered latencies to the front
+        memmove(all + answered, cls[i].latencies, (size_t)cls[i].answered * sizeof(double));
+        answered += cls[i].answered;
+        failed += cls[i].failed;
+        cached += cls[i].cached;
+    }
+    double elapsed = native_now_ms() - start;
+
+    long expected = (long)clients * requests;
+    fprintf(out, "requests: %ld of %ld answered (%d client(s))\n", answered, expected, clients);
+    fprintf(out, "program errors: %ld\n", failed);
+    fprintf(out, "cached answers: %ld\n", cached);
+    if (answered > 0) {
+        qsort(all, (size_t)answered, sizeof(double), compare_ms);
+        fprintf(out, "throughput: %.0f requests/s\n", answered * 1000.0 / elapsed);
+        fprintf(out, "latency p50: %.3f ms\n", all[answered / 2]);
+        fprintf(out, "latency p99: %.3f ms\n", all[(answered * 99) / 100 < answered ? (answered * 99) / 100 : answered - 1]);
+        fprintf(out, "latency max: %.3f ms\n", all[answered - 1]);
+    }
+
+    free(all);
+    free(threads);
+    free(cls);
+    textbuf_free(&request);
+    return answered == expected ? 0 : 1;
+}
+
+int server_cache_stats(const char *path, FILE *out) {
+    int fd = connect_to(path);
+    if (fd < 0) {
+        fprintf(stderr, "Cannot connect to '%s': %s\n", path, strerror(errno));
+        return 1;
+    }
+    TextBuf request;
+    textbuf_init(&request);
+    put_u32(&request, 4);
+    put_u32(&request, SERVER_CACHE_STATS);
+
+    int status = 1;
+    char head[4];
+    char *reply = NULL;
+    if (write_full(fd, request.data, request.len) == 0 && read_full(fd, head, 4) == 0) {
+        uint32_t len = get_u32(head);
+        if (len >= SERVER_RESPONSE_HEADER + 4 && len <= SERVER_MAX_FRAME) {
+            reply = xcalloc(1, len);
+            uint32_t consoleLen = read_full(fd, reply, len) == 0 ? get_u32(reply + SERVER_RESPONSE_HEADER) : UINT32_MAX;
+            if (consoleLen <= len - SERVER_RESPONSE_HEADER - 4) {
+                fwrite(reply + SERVER_RESPONSE_HEADER + 4, 1, consoleLen, out);
+                status = 0;
+            }
+        }
+    }
+    if (status) fprintf(stderr, "No answer from '%s'\n", path);
+    free(reply);
+    textbuf_free(&request);
+    close(fd);
+    return status;
+}
+
+#else
+
+int server_run(const char *path, int workers, ColangCache *cache, FILE *log) {
+    (void)path;
+    (void)workers;
+    (void)cache;
+    (void)log;
+    fprintf(stderr, "--serve needs epoll and UNIX domain sockets (Linux)\n");
+    return 1;
+}
+
+int server_load_test(const char *path, const char *source, size_t len,
+                     int clients, int requests, uint32_t options, FILE *out) {
+    (void)path;
+    (void)source;
+    (void)len;
+    (void)clients;
+    (void)requests;
+    (void)options;
+    (void)out;
+    fprintf(stderr, "--load-test needs UNIX domain sockets (Linux)\n");
+    return 1;
+}
+
+int server_cache_stats(const char *path, FILE *out) {
+    (void)path;
+    (void)out;
+    fprintf(stderr, "--cache-stats needs UNIX domain sockets (Linux)\n");
+    return 1;
+}
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "colang.h"
+
+/* Compile daemon on a UNIX domain socket (--serve). One epoll loop owns
+   the connections; a pool of workers, each with its own ColangContext,
+   compiles and runs the programs, so the compiler's tables and buffers
+   stay warm from request to request. With a cache, the workers share it,
+   so a program any client sent before is answered without running it.
+   Linux only.
+
+   Every message is a frame: a u32 byte count, then that many bytes.
+   Integers are big-endian. A connection may send requests back to back;
+   they are answered in order.
+
+   request:  u32 options, then the program text
+   response: u8 status (ColangStatus), u8 limit (ColangLimit), u16 flags,
+             i32 runtime error line, u32 TAC instructions,
+             u32 compile time in us, u32 run time in us,
+             then console, assembly, binary and hex, each a u32 length
+             followed by the bytes */
+
+/* Request option bits */
+#define SERVER_ENGINE_MASK      0x03    // ColangEngine
+#define SERVER_ARTIFACT_SHIFT   2       // COLANG_ARTIFACT_* << 2
+#define SERVER_NO_PEEPHOLE      0x20
+#define SERVER_NO_SCHEDULE      0x40
+#define SERVER_PEVAL            0x80
+#define SERVER_PEVAL_VARS       0x100
+#define SERVER_CACHE_STATS      0x200   // no program: the console is the cache report
+
+/* Response flags */
+#define SERVER_RESULT_CACHED    0x1
+
+/* Largest frame accepted; a connection sending more is dropped */
+#define SERVER_MAX_FRAME        (16u << 20)
+
+#define SERVER_RESPONSE_HEADER  20      // fixed fields after the length prefix
+
+/* Serve on path until SIGINT or SIGTERM. workers <= 0 means one per
+   online CPU; cache may be NULL. Returns 0 after a clean shutdown. */
+int server_run(const char *path, int workers, ColangCache *cache, FILE *log);
+
+/* Load test a running server: `clients` connections each send `requests`
+   copies of the program one after another. Reports throughput and the
+   p50/p99 latencies. Returns 0 when every request got an answer. */
+int server_load_test(const char *path, const char *source, size_t len,
+                     int clients, int requests, uint32_t options, FILE *out);
+
+/* Print a running server's cache report. Returns 0 on an answer. */
+int server_cache_stats(const char *path, FILE *out);
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef SHA256_H
+#define SHA256_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SHA256_SIZE 32
+
+/* FIPS 180-4 SHA-256, fed incrementally */
+typedef struct {
+    uint32_t state[8];
+    uint64_t bytes;         // total fed so far
+    unsigned char block[64];
+    size_t fill;            // bytes waiting in block
+} Sha256;
+
+void sha256_init(Sha256 *h);
+void sha256_update(Sha256 *h, const void *data, size_t len);
+void sha256_final(Sha256 *h, unsigned char digest[SHA256_SIZE]);
+
+#endif
@@ -0,0 +1,92 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "source.h"
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/* Map a regular file read from its start. The two NULs come from the
+   zero fill after end of file, so the size must stop short of a page
+   boundary by at least two bytes. */
+static int map_file(FILE *in, Source *src) {
+#ifdef _WIN32
+    (void)in;
+    (void)src;
+    return 0;
+#else
+    int fd = fileno(in);
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0) return 0;
+    if (lseek(fd, 0, SEEK_CUR) != 0) return 0;
+
+    size_t size = (size_t)st.st_size;
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    if (size % page == 0 || size % page > page - 2) return 0;
+
+    void *p = mmap(NULL, size + 2, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    if (p == MAP_FAILED) return 0;
+    src->text = p;
+    src->size = size;
+    src->mapSize = size + 2;
+    return 1;
+#endif
+}
+
+/* Make room for cap bytes of text starting on a 16-byte boundary. cap is
+   a multiple of 16, so the buffer is whole blocks and the scanner's loads
+   never reach outside it. realloc may move the start off the boundary, in
+   which case the text read so far moves with it. */
+static void heap_reserve(Source *src, size_t cap) {
+    size_t was = src->text ? (size_t)(src->text - src->heap) : 0;
+    char *heap = realloc(src->heap, cap + 15);
+    if (!heap) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    char *text = heap + (-(uintptr_t)heap & 15);
+    if (src->text && (size_t)(text - heap) != was) memmove(text, heap + was, src->size);
+    src->heap = heap;
+    src->text = text;
+}
+
+int source_load(FILE *in, Source *src) {
+    memset(src, 0, sizeof(*src));
+    if (map_file(in, src)) return 0;
+
+    size_t cap = 65536, n;
+    heap_reserve(src, cap);
+    while ((n = fread(src->text + src->size, 1, cap - src->size - 2, in)) > 0) {
+        src->size += n;
+        if (cap - src->size - 2 == 0) {
+            cap *= 2;
+            heap_reserve(src, cap);
+        }
+    }
+    if (ferror(in)) {
+        fprintf(stderr, "Could not read the source\n");
+        source_free(src);
+        return 1;
+    }
+    src->text[src->size] = '\0';
+    src->text[src->size + 1] = '\0';
+    return 0;
+}
+
+void source_free(Source *src) {
+    if (!src->text) return;
+#ifndef _WIN32
+    if (src->mapSize) {
+        munmap(src->text, src->mapSize);
+        src->text = NULL;
+        return;
+    }
+#endif
+    free(src->heap);
+    src->heap = NULL;
+    src->text = NULL;
+}
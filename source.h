@@ -0,0 +1,23 @@
+#ifndef SOURCE_H
+#define SOURCE_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+/* The whole program text in one buffer the scanner works on in place:
+   text[size] and text[size + 1] are NUL, as flex requires, and every
+   16-byte block holding part of text through those NULs is readable, as
+   the hand scanner's aligned loads require. Regular files are mapped
+   privately (flex briefly writes a NUL after each token); pipes and
+   terminals are read into the heap. */
+typedef struct {
+    char *text;
+    size_t size;
+    size_t mapSize;     // nonzero when text is a file mapping
+    char *heap;         // allocation text lies in when read into the heap
+} Source;
+
+int source_load(FILE *in, Source *src);
+void source_free(Source *src);
+
+#endif
@@ -1,20 +1,36 @@
 #include "symbol_table.h"
 #include<stdbool.h>
-Symbol symtab[MAX_SYMBOLS];
-int symcount = 0;
 
-bool DEBUG_MODE_SYMB = false;
+static const bool DEBUG_MODE_SYMB = false;
 
-Symbol *lookup(const char *name) {
-    for (int i = 0; i < symcount; i++) {
-        if (strcmp(symtab[i].name, name) == 0)
-            return &symtab[i];
-    }
-    return NULL;
+void symtab_init(SymbolTable *st) {
+    st->count = 0;
+    intern_init(&st->names);
+}
+
+void symtab_reset(SymbolTable *st) {
+    st->count = 0;
+    intern_reset(&st->names);
+}
+
+void symtab_free(SymbolTable *st) {
+    st->count = 0;
+    intern_free(&st->names);
+}
+
+/* Names are keyed by atom: the atom carries its symbol's index */
+Symbol *lookup_atom(SymbolTable *st, Atom name) {
+    int slot = atom_slot(name);
+    return slot ? &st->entries[slot - 1] : NULL;
 }
 
-Symbol *insert(const char *name, VarType type, int line, int *error) {
-    Symbol *s = lookup(name);
+Symbol *lookup(SymbolTable *st, const char *name) {
+    Atom atom = intern_find(&st->names, name);
+    return atom ? lookup_atom(st, atom) : NULL;
+}
+
+Symbol *insert(SymbolTable *st, Atom name, VarType type, int line, int *error) {
+    Symbol *s = lookup_atom(st, name);
     if (s) {
         fprintf(stderr, "Error at line %d: Variable '%s' is already declared (first declared as %s)\n", 
                 line, name, type_to_string(s->type));
@@ -22,28 +38,24 @@ Symbol *insert(const char *name, VarType type, int line, int *error) {
         return NULL;
     }
 
-    if (symcount >= MAX_SYMBOLS) {
+    if (st->count >= MAX_SYMBOLS) {
         fprintf(stderr, "Symbol table full\n");
         if (error) *error = 1;
         return NULL;
     }
 
-    Symbol *newSym = &symtab[symcount++];
-    newSym->name = strdup(name);
+    Symbol *newSym = &st->entries[st->count++];
+    newSym->name = name;
+    atom_set_slot(newSym->name, st->count);
     newSym->type = type;
 
-    newSym->numVal = 0;
-    newSym->chrVal = '\0';
-    newSym->strVal = NULL;
-
-    if (type == TYPE_FLEX)
-        newSym->flexType = FLEX_NONE;
-    else
-        newSym->flexType = FLEX_NONE;
+    newSym->value = VALUE_MAKE(0, FLEX_NONE);
 
     // Initialize memory info (will be computed later default to -1 muna)
     newSym->memOffset = -1;
     newSym->size = get_size_for_type(type);
+    newSym->hasInitValue = 0;
+    newSym->initValue = 0;
 
     return newSym;
 }
@@ -58,31 +70,17 @@ const char *type_to_string(VarType type) {
 }
 
 void set_number(Symbol *s, int value) {
-    if (s->type == TYPE_FLEX && s->strVal) {
-        free(s->strVal);
-        s->strVal = NULL;
-    }
-    
-    /* For chr type, store both representations */
+    /* chr keeps only the char */
     if (s->type == TYPE_CHR) {
-        s->chrVal = (char)value;
-        s->numVal = value;
+        s->value = VALUE_MAKE((char)value, FLEX_CHAR);
     } else {
-        s->numVal = value;
+        s->value = VALUE_MAKE(value, FLEX_NUMBER);
     }
-
-    if (s->type == TYPE_FLEX)
-        s->flexType = FLEX_NUMBER;
 }
 
 void set_char(Symbol *s, char value) {
-    if (s->type == TYPE_FLEX) {
-        s->flexType = FLEX_CHAR;
-        s->chrVal = value;
-        s->numVal = (int)value;  // Store integer representation too
-    } else if (s->type == TYPE_CHR) {
-        s->chrVal = value;
-        s->numVal = (int)value;
+    if (s->type != TYPE_NMBR) {
+        s->value = VALUE_MAKE(value, FLEX_CHAR);
     }
 }
 
@@ -90,7 +88,7 @@ FlexType get_runtime_type(Symbol *s) {
     switch (s->type) {
         case TYPE_NMBR: return FLEX_NUMBER;
         case TYPE_CHR:  return FLEX_CHAR;
-        case TYPE_FLEX: return s->flexType;
+        case TYPE_FLEX: return VALUE_TAG(s->value);
         default:        return FLEX_NONE;
     }
 }
@@ -106,28 +104,28 @@ int get_size_for_type(VarType type) {
 }
 
 //after parsing is complete, before TAC generation
-void compute_symbol_offsets(void) {
+void compute_symbol_offsets(SymbolTable *st) {
     int currentOffset = 0;
     
     // Compute offsets with proper alignment
-    for (int i = 0; i < symcount; i++) {
+    for (int i = 0; i < st->count; i++) {
         // 
-        // if (symtab[i].type == TYPE_NMBR || symtab[i].type == TYPE_FLEX) {
+        // if (st->entries[i].type == TYPE_NMBR || st->entries[i].type == TYPE_FLEX) {
         //     currentOffset = (currentOffset + 3) & ~3; // Align to 4-byte boundary
         // }
         
-        symtab[i].memOffset = currentOffset;
-        currentOffset += symtab[i].size;
+        st->entries[i].memOffset = currentOffset;
+        currentOffset += st->entries[i].size;
     }
     
     if(DEBUG_MODE_SYMB){
         printf("\n=== Memory Layout ===\n");
-        for (int i = 0; i < symcount; i++) {
+        for (int i = 0; i < st->count; i++) {
             printf("%s: type=%s, offset=%d, size=%d bytes\n", 
-                symtab[i].name, 
-                type_to_string(symtab[i].type),
-                symtab[i].memOffset, 
-                symtab[i].size);
+                st->entries[i].name, 
+                type_to_string(st->entries[i].type),
+                st->entries[i].memOffset, 
+                st->entries[i].size);
         }
         printf("Total memory required: %d bytes\n\n", currentOffset);
     }
@@ -4,6 +4,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
+#include "intern.h"
 
 #define MAX_SYMBOLS 999
 
@@ -19,22 +21,42 @@ typedef enum {
     FLEX_CHAR,
 } FlexType;
 
+/* Runtime value in one 64-bit word: the low 32 bits hold the number (chr
+   and char-tagged flex hold the sign-extended char code) and the bits
+   above hold the FlexType tag, so an assignment is a single store */
+typedef uint64_t Value;
+
+#define VALUE_MAKE(num, tag)    (((Value)(tag) << 32) | (uint32_t)(num))
+#define VALUE_NUM(v)            ((int32_t)(uint32_t)(v))
+#define VALUE_CHR(v)            ((char)(v))
+#define VALUE_TAG(v)            ((FlexType)((v) >> 32))
+
 typedef struct {
-    char *name;
+    Atom name;
     VarType type;     
-    FlexType flexType;
-    int numVal;
-    char chrVal;
-    char *strVal;
+    Value value;
     int memOffset;    
     int size;         
+    int hasInitValue; // set by the backend when the first write is a constant
+    int initValue;
 } Symbol;
 
-extern Symbol symtab[MAX_SYMBOLS];
-extern int symcount;
+/* One compilation's variables. Names are atoms of the table's own intern
+   table, and each atom's slot is its symbol's index + 1. */
+typedef struct {
+    Symbol entries[MAX_SYMBOLS];
+    int count;
+    InternTable names;
+} SymbolTable;
+
+void symtab_init(SymbolTable *st);
+/* Empty the table for the next compilation; its atoms become invalid */
+void symtab_reset(SymbolTable *st);
+void symtab_free(SymbolTable *st);
 
-Symbol *lookup(const char *name);
-Symbol *insert(const char *name, VarType type, int line, int *error);
+Symbol *lookup(SymbolTable *st, const char *name);
+Symbol *lookup_atom(SymbolTable *st, Atom name);
+Symbol *insert(SymbolTable *st, Atom name, VarType type, int line, int *error);
 const char *type_to_string(VarType type);
 
 // New functions
@@ -43,7 +65,7 @@ void set_char(Symbol *s, char value);
 FlexType get_runtime_type(Symbol *s);
 
 // NEW: Function to compute memory layout after all symbols are declared
-void compute_symbol_offsets(void);
+void compute_symbol_offsets(SymbolTable *st);
 int get_size_for_type(VarType type);
 
 #endif
\ No newline at end of file
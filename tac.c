@@ -3,26 +3,9 @@
 #include <string.h>
 #include <stdint.h>
 #include "tac.h"
-
-
-/* MIPS64 Opcodes and Function Codes */
-#define OPCODE_DADDIU   0x19
-#define OPCODE_LD       0x37
-#define OPCODE_SD       0x3F
-
-/* Function codes for R-format instructions */
-#define FUNCT_DADDU     0x2D
-#define FUNCT_DSUBU     0x2F
-#define FUNCT_DMULT     0x1C
-#define FUNCT_DDIV      0x1E
-#define FUNCT_MFLO      0x12
-
-#define OPCODE_LB       0x20   // Load byte
-#define OPCODE_SB       0x28   // Store byte
-#define OPCODE_LW       0x23   // Load word
-#define OPCODE_SW       0x2B   // Store word
-#define OPCODE_ADDIU    0x09   // Add immediate unsigned (32-bit)
-
+#include "mips.h"
+#include "target.h"
+#include "output.h"
 
 
 /* MIPS64 Instruction Formats */
@@ -32,62 +15,86 @@ typedef enum {
 } InstrFormat;
 
 
-static int next_register = 0;
-/* Track which register holds which temp/var value */
 /* Register allocation tracking */
 typedef struct {
     int tempNum;           
     int lastUseDistance;   
     int isDirty;          
+    Symbol *var;           // variable whose current value the register holds
 } RegisterState;
 
-/* Get instruction mnemonic for assembly output */
-static const char* get_load_mnemonic(VarType type) {
-    switch (type) {
-        case TYPE_CHR: return "lb";
-        case TYPE_NMBR: return "lw";
-        case TYPE_FLEX: 
-        default: return "lw";
+/* State of one tac_lower run; the allocator works in the target's
+   register indices */
+typedef struct {
+    const TargetDesc *target;
+    void *ctx;
+    SymbolTable *symbols;
+    RegisterState regs[TARGET_MAX_REGS];
+} Lowering;
+
+/* Forward declarations */
+static int get_register_number(const char *reg);
+static uint32_t encode_i_format(int opcode, int rs, int rt, int16_t immediate);
+static uint32_t encode_r_format(int funct, int rs, int rt, int rd, int shamt);
+static int find_temp_in_register(Lowering *lw, int tempNum);
+static void get_load_store_opcodes(VarType type, int *load_opcode, int *store_opcode, int *imm_opcode);
+
+/* Initialize register state */
+static void init_register_state(Lowering *lw) {
+    for (int i = 0; i < lw->target->numRegs; i++) {
+        lw->regs[i].tempNum = -1;
+        lw->regs[i].lastUseDistance = 0;
+        lw->regs[i].isDirty = 0;
+        lw->regs[i].var = NULL;
     }
 }
 
-static const char* get_store_mnemonic(VarType type) {
-    switch (type) {
-        case TYPE_CHR: return "sb";
-        case TYPE_NMBR: return "sw";
-        case TYPE_FLEX:
-        default: return "sw";
-    }
+/* Does the instruction itself still need this temp as an operand? */
+static int temp_read_by(TACInstr *instr, int tempNum) {
+    if (tempNum == -1) return 0;
+    return (instr->arg1.type == OPERAND_TEMP && instr->arg1.val.tempNum == tempNum) ||
+           (instr->arg2.type == OPERAND_TEMP && instr->arg2.val.tempNum == tempNum);
 }
 
-static const char* get_imm_mnemonic(VarType type) {
-   
-    return "daddiu";
+/* Find a register that still holds a variable's current value */
+static int find_var_in_register(Lowering *lw, Symbol *s) {
+    for (int i = 0; i < lw->target->numRegs; i++) {
+        if (lw->regs[i].var == s) {
+            return i;
+        }
+    }
+    return -1;
 }
 
-#define NUM_WORK_REGS 8 
-static RegisterState regState[NUM_WORK_REGS];
+/* A register is about to be overwritten */
+static void clobber_register(Lowering *lw, int regIdx) {
+    lw->regs[regIdx].var = NULL;
+}
 
-/* Forward declarations */
-static int get_register_number(const char *reg);
-static uint32_t encode_i_format(int opcode, int rs, int rt, int16_t immediate);
-static uint32_t encode_r_format(int funct, int rs, int rt, int rd, int shamt);
-static int find_temp_in_register(int tempNum);
-static void get_load_store_opcodes(VarType type, int *load_opcode, int *store_opcode, int *imm_opcode);
+/* A register was just stored into a variable: it is now the only cached
+   copy, unless the store changed the value (e.g. a byte store truncates) */
+static void note_var_store(Lowering *lw, Symbol *s, int regIdx, int mirrors) {
+    for (int i = 0; i < lw->target->numRegs; i++) {
+        if (lw->regs[i].var == s) lw->regs[i].var = NULL;
+    }
+    if (mirrors) lw->regs[regIdx].var = s;
+}
 
-/* Initialize register state */
-static void init_register_state(void) {
-    for (int i = 0; i < NUM_WORK_REGS; i++) {
-        regState[i].tempNum = -1;
-        regState[i].lastUseDistance = 0;
-        regState[i].isDirty = 0;
+/* First register without a live temp, preferring ones with no cached variable */
+static int find_free_register(Lowering *lw, int excludeReg) {
+    int fallback = -1;
+    for (int i = 0; i < lw->target->numRegs; i++) {
+        if (i == excludeReg || lw->regs[i].tempNum != -1) continue;
+        if (lw->regs[i].var == NULL) return i;
+        if (fallback == -1) fallback = i;
     }
+    return fallback;
 }
 
 /* Get register name by index */
 static const char* get_reg_name(int idx) {
     static const char* regNames[] = {"r2", "r3", "r4", "r5", "r6", "r7", "r8", "r9"};
-    if (idx >= 0 && idx < NUM_WORK_REGS) {
+    if (idx >= 0 && idx < 8) {
         return regNames[idx];
     }
     return "r2"; // fallback
@@ -139,17 +146,17 @@ static int temp_is_used_later(TACInstr *current, int tempNum) {
 }
 
 /* Find best register to evict (using LRU - Least Recently Used / Furthest Next Use) */
-static int find_register_to_evict(TACInstr *current) {
+static int find_register_to_evict(Lowering *lw, TACInstr *current) {
     int bestReg = 0;
-    int maxDistance = regState[0].lastUseDistance;
+    int maxDistance = lw->regs[0].lastUseDistance;
     
-    for (int i = 1; i < NUM_WORK_REGS; i++) {
-        if (regState[i].tempNum == -1) {
+    for (int i = 1; i < lw->target->numRegs; i++) {
+        if (lw->regs[i].tempNum == -1) {
             return i; // Empty register, use it
         }
         
-        if (regState[i].lastUseDistance > maxDistance) {
-            maxDistance = regState[i].lastUseDistance;
+        if (lw->regs[i].lastUseDistance > maxDistance) {
+            maxDistance = lw->regs[i].lastUseDistance;
             bestReg = i;
         }
     }
@@ -157,152 +164,128 @@ static int find_register_to_evict(TACInstr *current) {
     return bestReg;
 }
 
-static void spill_register(int regIdx, char *output, char *hex_out, char *bin_out, int tempStorageOffset) {
-    if (regState[regIdx].tempNum == -1 || !regState[regIdx].isDirty) {
+static void spill_register(Lowering *lw, int regIdx) {
+    if (lw->regs[regIdx].tempNum == -1 || !lw->regs[regIdx].isDirty) {
         return; // Nothing to spill
     }
     
-    int tempNum = regState[regIdx].tempNum;
-    int offset = tempStorageOffset + (tempNum * 8);
-    const char *regName = get_reg_name(regIdx);
+    lw->target->spill(lw->ctx, regIdx, lw->regs[regIdx].tempNum);
     
-    char line[256];
-    snprintf(line, sizeof(line), "sd %s, %d(r0)\n", regName, offset);
-    strcat(output, line);
-    
-    // Generate machine code
-    int rt = get_register_number(regName);
-    uint32_t machine_code = encode_i_format(OPCODE_SD, 0, rt, (int16_t)offset);
+    lw->regs[regIdx].isDirty = 0;
+}
+
+/* Write back the temp a register holds, if any, and free it for other use */
+static void evict_register(Lowering *lw, int regIdx) {
+    spill_register(lw, regIdx);
+    lw->regs[regIdx].tempNum = -1;
+    lw->regs[regIdx].isDirty = 0;
+    clobber_register(lw, regIdx);
+}
+
+/* Register to load an operand of current into; never excludeReg, and never
+   one holding a temp the instruction itself reads */
+static int choose_load_register(Lowering *lw, TACInstr *current, int excludeReg) {
+    int regIdx = find_free_register(lw, excludeReg);
     
-    char hex_str[32];
-    sprintf(hex_str, "0x%08X\n", machine_code);
-    strcat(hex_out, hex_str);
+    if (regIdx == -1) {
+        for (int i = 0; i < lw->target->numRegs; i++) {
+            if (i != excludeReg && lw->regs[i].tempNum != -1 &&
+                !temp_read_by(current, lw->regs[i].tempNum)) {
+                if (find_next_use_distance(current, lw->regs[i].tempNum) == 9999) {
+                    regIdx = i;
+                    break;
+                }
+            }
+        }
+    }
     
-    char bin_str[40];
-    for (int i = 31; i >= 0; i--) {
-        sprintf(bin_str + (31 - i), "%d", (machine_code >> i) & 1);
+    if (regIdx == -1) {
+        for (int i = 0; i < lw->target->numRegs; i++) {
+            if (i != excludeReg && !temp_read_by(current, lw->regs[i].tempNum)) {
+                regIdx = i;
+                break;
+            }
+        }
     }
-    strcat(bin_out, bin_str);
-    strcat(bin_out, "\n");
     
-    regState[regIdx].isDirty = 0;
+    return regIdx == -1 ? 0 : regIdx;
 }
 
 /* Allocate register for a temp */
-static int allocate_register_for_temp(TACInstr *current, int tempNum, 
-                                      char *output, char *hex_out, char *bin_out, 
-                                      int tempStorageOffset) {
+static int allocate_register_for_temp(Lowering *lw, TACInstr *current, int tempNum) {
     // Check if already in a register
-    int regIdx = find_temp_in_register(tempNum);
+    int regIdx = find_temp_in_register(lw, tempNum);
     if (regIdx != -1) {
         return regIdx;
     }
     
     // First, try to find an empty register or one with a dead temp
-    for (int i = 0; i < NUM_WORK_REGS; i++) {
-        if (regState[i].tempNum == -1) {
-            // Empty register - use it
-            regState[i].tempNum = tempNum;
-            regState[i].lastUseDistance = find_next_use_distance(current, tempNum);
-            regState[i].isDirty = 0;
-            return i;
-        }
-        
+    regIdx = find_free_register(lw, -1);
+    if (regIdx != -1) {
+        // Empty register - use it
+        clobber_register(lw, regIdx);
+        lw->regs[regIdx].tempNum = tempNum;
+        lw->regs[regIdx].lastUseDistance = find_next_use_distance(current, tempNum);
+        lw->regs[regIdx].isDirty = 0;
+        return regIdx;
+    }
+    
+    for (int i = 0; i < lw->target->numRegs; i++) {
         // Check if this register holds a dead temp (never used again)
-        if (find_next_use_distance(current, regState[i].tempNum) == 9999) {
+        if (find_next_use_distance(current, lw->regs[i].tempNum) == 9999) {
             // This temp is dead - can safely reuse
-            regState[i].tempNum = tempNum;
-            regState[i].lastUseDistance = find_next_use_distance(current, tempNum);
-            regState[i].isDirty = 0;
+            clobber_register(lw, i);
+            lw->regs[i].tempNum = tempNum;
+            lw->regs[i].lastUseDistance = find_next_use_distance(current, tempNum);
+            lw->regs[i].isDirty = 0;
             return i;
         }
     }
     //HMMMMM
-    regIdx = find_register_to_evict(current);
-    spill_register(regIdx, output, hex_out, bin_out, tempStorageOffset);
+    regIdx = find_register_to_evict(lw, current);
+    spill_register(lw, regIdx);
     
-    regState[regIdx].tempNum = tempNum;
-    regState[regIdx].lastUseDistance = find_next_use_distance(current, tempNum);
-    regState[regIdx].isDirty = 0;
+    clobber_register(lw, regIdx);
+    lw->regs[regIdx].tempNum = tempNum;
+    lw->regs[regIdx].lastUseDistance = find_next_use_distance(current, tempNum);
+    lw->regs[regIdx].isDirty = 0;
     
     return regIdx;
 }
 /* Load operand into register, with optional exclusion list */
-static int load_operand_ex(TACOperand op, TACInstr *current,
-                       char *output, char *hex_out, char *bin_out,
-                       int tempStorageOffset, int excludeReg) {
+static int load_operand_ex(Lowering *lw, TACOperand op, TACInstr *current, int excludeReg) {
     
     if (op.type == OPERAND_TEMP) {
-        int regIdx = find_temp_in_register(op.val.tempNum);
+        int regIdx = find_temp_in_register(lw, op.val.tempNum);
         if (regIdx != -1) {
             return regIdx;
         }
-        fprintf(stderr, "ERROR: Temp t%d not in register\n", op.val.tempNum);
-        return 0;
-        
-    } else if (op.type == OPERAND_VAR) {
-        int regIdx = -1;
         
-        // Find best register
-        for (int i = 0; i < NUM_WORK_REGS; i++) {
-            if (i != excludeReg && regState[i].tempNum == -1) {
-                regIdx = i;
-                break;
-            }
-        }
+        // Evicted since it was computed: read it back from its spill slot
+        regIdx = choose_load_register(lw, current, excludeReg);
+        evict_register(lw, regIdx);
+        lw->target->reload(lw->ctx, regIdx, op.val.tempNum);
+        lw->regs[regIdx].tempNum = op.val.tempNum;
+        lw->regs[regIdx].lastUseDistance = find_next_use_distance(current, op.val.tempNum);
+        return regIdx;
         
-        if (regIdx == -1) {
-            for (int i = 0; i < NUM_WORK_REGS; i++) {
-                if (i != excludeReg && regState[i].tempNum != -1) {
-                    if (find_next_use_distance(current, regState[i].tempNum) == 9999) {
-                        regIdx = i;
-                        break;
-                    }
-                }
-            }
-        }
+    } else if (op.type == OPERAND_VAR) {
+        Symbol *s = lookup_atom(lw->symbols, op.val.varName);
         
-        if (regIdx == -1) {
-            for (int i = 0; i < NUM_WORK_REGS; i++) {
-                if (i != excludeReg) {
-                    regIdx = i;
-                    break;
-                }
-            }
+        // Reuse a register that already holds the value
+        int regIdx = s ? find_var_in_register(lw, s) : -1;
+        if (regIdx != -1) {
+            return regIdx;
         }
         
-        if (regIdx == -1) regIdx = 0;
-        
-        regState[regIdx].tempNum = -1;
-        regState[regIdx].isDirty = 0;
+        regIdx = choose_load_register(lw, current, excludeReg);
+        evict_register(lw, regIdx);
         
-        Symbol *s = lookup(op.val.varName);
         if (!s) return regIdx;
         
         // TYPE-AWARE LOAD
-        int load_op, store_op, imm_op;
-        get_load_store_opcodes(s->type, &load_op, &store_op, &imm_op);
-        const char *load_instr = get_load_mnemonic(s->type);
-        
-        const char *regName = get_reg_name(regIdx);
-        
-        char line[256];
-        snprintf(line, sizeof(line), "%s %s, %d(r0)\n", load_instr, regName, s->memOffset);
-        strcat(output, line);
-        
-        int rt = get_register_number(regName);
-        uint32_t machine_code = encode_i_format(load_op, 0, rt, (int16_t)s->memOffset);
-        
-        char hex_str[32];
-        sprintf(hex_str, "0x%08X\n", machine_code);
-        strcat(hex_out, hex_str);
-        
-        char bin_str[40];
-        for (int i = 31; i >= 0; i--) {
-            sprintf(bin_str + (31 - i), "%d", (machine_code >> i) & 1);
-        }
-        strcat(bin_out, bin_str);
-        strcat(bin_out, "\n");
+        lw->target->load_var(lw->ctx, regIdx, s);
+        lw->regs[regIdx].var = s;
         
         return regIdx;
     }
@@ -311,16 +294,14 @@ static int load_operand_ex(TACOperand op, TACInstr *current,
 }
 
 /* Load operand into register */
-static int load_operand(TACOperand op, TACInstr *current,
-                       char *output, char *hex_out, char *bin_out,
-                       int tempStorageOffset) {
-    return load_operand_ex(op, current, output, hex_out, bin_out, tempStorageOffset, -1);
+static int load_operand(Lowering *lw, TACOperand op, TACInstr *current) {
+    return load_operand_ex(lw, op, current, -1);
 }
 
 /* Find register holding a temp, or -1 if not in register */
-static int find_temp_in_register(int tempNum) {
-    for (int i = 0; i < NUM_WORK_REGS; i++) {
-        if (regState[i].tempNum == tempNum) {
+static int find_temp_in_register(Lowering *lw, int tempNum) {
+    for (int i = 0; i < lw->target->numRegs; i++) {
+        if (lw->regs[i].tempNum == tempNum) {
             return i;
         }
     }
@@ -333,19 +314,19 @@ static void get_load_store_opcodes(VarType type, int *load_opcode, int *store_op
         case TYPE_CHR:
             *load_opcode = OPCODE_LB;
             *store_opcode = OPCODE_SB;
-            *imm_opcode = OPCODE_ADDIU;  // Use 32-bit immediate for consistency
+            *imm_opcode = OPCODE_DADDIU;
             break;
         case TYPE_NMBR:
             *load_opcode = OPCODE_LW;
             *store_opcode = OPCODE_SW;
-            *imm_opcode = OPCODE_ADDIU;
+            *imm_opcode = OPCODE_DADDIU;
             break;
         case TYPE_FLEX:
         default:
-            // FLEX uses word operations by default
+            // Mixed flex uses word operations; char-only flex arrives as TYPE_CHR
             *load_opcode = OPCODE_LW;
             *store_opcode = OPCODE_SW;
-            *imm_opcode = OPCODE_ADDIU;
+            *imm_opcode = OPCODE_DADDIU;
             break;
     }
 }
@@ -410,11 +391,19 @@ static int temp_needs_memory(TACProgram *prog, TACInstr *current, int tempNum) {
     return useCount > 0;
 }
 
-TACProgram *tac_create_program(void) {
+TACProgram *tac_create_program(SymbolTable *symbols) {
     TACProgram *prog = malloc(sizeof(TACProgram));
+    if (!prog) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    prog->symbols = symbols;
+    prog->quiet = 0;
     prog->head = NULL;
     prog->tail = NULL;
     prog->tempCount = 0;
+    prog->fault = NULL;
+    prog->quickened = 0;
     return prog;
 }
 
@@ -428,8 +417,8 @@ TACOperand tac_operand_temp(int num) {
     return op;
 }
 
-TACOperand tac_operand_var(const char *name) {
-    TACOperand op = {.type = OPERAND_VAR, .val.varName = strdup(name)};
+TACOperand tac_operand_var(Atom name) {
+    TACOperand op = {.type = OPERAND_VAR, .val.varName = name};
     return op;
 }
 
@@ -455,8 +444,11 @@ TACInstr *tac_emit(TACProgram *prog, TACOp op, TACOperand res, TACOperand a1, TA
     instr->arg2 = a2;
     instr->line = line;
     instr->inShwContext = 0;
-    instr->resultIsChar = 0;  // ← ADD THIS LINE
+    instr->resultIsChar = 0;
+    instr->isStaticInit = 0;
+    instr->quick = QUICK_NONE;
     instr->next = NULL;
+    prog->quickened = 0;
 
     if (!prog->head) {
         prog->head = prog->tail = instr;
@@ -503,8 +495,8 @@ TACOperand tac_gen_expr_ctx(TACProgram *prog, ASTNode *node, int inShwContext) {
         }
         
         case NODE_IDENT: {
-            TACOperand op = tac_operand_var(node->data.strVal);
-            Symbol *s = lookup(node->data.strVal);
+            TACOperand op = tac_operand_var(node->data.ident);
+            Symbol *s = lookup_atom(prog->symbols, node->data.ident);
             if (s && s->type == TYPE_CHR) {
                 op.isCharType = 1;
             }
@@ -653,10 +645,10 @@ void tac_gen_stmt(TACProgram *prog, ASTNode *node) {
         }
 
         case NODE_NAME_ITEM: {
-            const char *name = node->data.nameItem.name;
+            Atom name = node->data.nameItem.name;
             ASTNode *init = node->data.nameItem.initExpr;
             
-            Symbol *s = lookup(name);
+            Symbol *s = lookup_atom(prog->symbols, name);
             if (!s) break; // Symbol should already exist
             
             if (init) {
@@ -988,14 +980,179 @@ static void optimize_arithmetic_assignments(TACProgram *prog) {
 }
 
 
-TACProgram *tac_generate(ASTNode *ast) {
-    TACProgram *prog = tac_create_program();
+static void free_instr(TACInstr *instr) {
+    if (instr->result.type == OPERAND_STR) free(instr->result.val.strVal);
+    if (instr->arg1.type == OPERAND_STR) free(instr->arg1.val.strVal);
+    if (instr->arg2.type == OPERAND_STR) free(instr->arg2.val.strVal);
+    free(instr);
+}
+
+typedef struct {
+    int writes;
+    int uses;
+    int value;      // valid when the only write is a literal load
+    int isConst;
+    int isChar;
+} PlanTemp;
+
+/* Text a print instruction writes when it is known at compile time, or
+   NULL. Formatting follows print_operand_value. */
+static const char *print_literal_text(TACInstr *instr, const PlanTemp *temps, char *scratch, size_t size) {
+    TACOperand op = instr->arg1;
+    if (instr->op == TAC_PRINT) return op.type == OPERAND_STR ? op.val.strVal : NULL;
+    if (instr->op != TAC_CONCAT) return NULL;
+
+    int value, isChar;
+    switch (op.type) {
+        case OPERAND_STR:
+            return op.val.strVal;
+        case OPERAND_INT:
+            value = op.val.intVal;
+            isChar = op.isCharType;
+            break;
+        case OPERAND_TEMP:
+            if (!temps[op.val.tempNum].isConst) return NULL;
+            value = temps[op.val.tempNum].value;
+            isChar = temps[op.val.tempNum].isChar;
+            break;
+        default:
+            return NULL;
+    }
+    if (isChar) {
+        // %c writes a NUL byte, which a string literal cannot carry
+        if ((char)value == '\0') return NULL;
+        scratch[0] = (char)value;
+        scratch[1] = '\0';
+    } else {
+        snprintf(scratch, size, "%d", value);
+    }
+    return scratch;
+}
+
+static int is_literal_load(TACInstr *instr) {
+    return instr->op == TAC_LOAD_INT && instr->result.type == OPERAND_TEMP &&
+           instr->arg1.type == OPERAND_INT;
+}
+
+/* Print plans. Within a run of print instructions whose text is known at
+   compile time (string, number and char literals), the text is rendered
+   into one string literal on the run's first print, so a shw line is left
+   with literal segments around its variable slots. Literal loads are pure
+   and may sit inside a run; anything else, including a division that can
+   fail, ends it, so output before a runtime error is unchanged. */
+static void merge_print_literals(TACProgram *prog) {
+    PlanTemp *temps = calloc(prog->tempCount > 0 ? prog->tempCount : 1, sizeof(PlanTemp));
+    if (!temps) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (TACInstr *instr = prog->head; instr; instr = instr->next) {
+        if (instr->result.type == OPERAND_TEMP) {
+            PlanTemp *t = &temps[instr->result.val.tempNum];
+            t->writes++;
+            t->isConst = t->writes == 1 && is_literal_load(instr);
+            t->value = instr->arg1.val.intVal;
+            t->isChar = instr->resultIsChar;
+        }
+        if (instr->arg1.type == OPERAND_TEMP) temps[instr->arg1.val.tempNum].uses++;
+        if (instr->arg2.type == OPERAND_TEMP) temps[instr->arg2.val.tempNum].uses++;
+    }
+
+    char *text = NULL;
+    size_t cap = 0;
+    char scratch[16];
+    TACInstr *prev = NULL;
+    TACInstr *curr = prog->head;
+    while (curr) {
+        if (!is_literal_load(curr) && !print_literal_text(curr, temps, scratch, sizeof(scratch))) {
+            prev = curr;
+            curr = curr->next;
+            continue;
+        }
+
+        // Collect the run's text; the first print becomes the segment
+        TACInstr *anchor = NULL;
+        TACInstr *end = curr;
+        int pieces = 0;
+        size_t len = 0;
+        for (; end; end = end->next) {
+            const char *piece = print_literal_text(end, temps, scratch, sizeof(scratch));
+            if (!piece) {
+                if (is_literal_load(end)) continue;
+                break;
+            }
+            size_t n = strlen(piece);
+            if (len + n + 1 > cap) {
+                while (len + n + 1 > cap) cap = cap ? cap * 2 : 256;
+                text = realloc(text, cap);
+                if (!text) {
+                    fprintf(stderr, "Out of memory\n");
+                    exit(1);
+                }
+            }
+            memcpy(text + len, piece, n + 1);
+            len += n;
+            if (end->arg1.type == OPERAND_TEMP) temps[end->arg1.val.tempNum].uses--;
+            if (!anchor) anchor = end;
+            pieces++;
+        }
+
+        if (anchor && (pieces > 1 || anchor->arg1.type != OPERAND_STR)) {
+            if (anchor->arg1.type == OPERAND_STR) free(anchor->arg1.val.strVal);
+            anchor->arg1 = tac_operand_str(text);
+        }
+
+        // Drop the merged prints and the loads nothing reads any more
+        while (curr != end) {
+            TACInstr *next = curr->next;
+            int merged = curr != anchor && pieces > 1 && print_literal_text(curr, temps, scratch, sizeof(scratch));
+            int dead = is_literal_load(curr) && temps[curr->result.val.tempNum].uses == 0;
+            if (merged || dead) {
+                if (prev) prev->next = next;
+                else prog->head = next;
+                if (curr == prog->tail) prog->tail = prev;
+                free_instr(curr);
+            } else {
+                prev = curr;
+            }
+            curr = next;
+        }
+    }
+    free(text);
+    free(temps);
+}
+
+static Symbol *flex_symbol(SymbolTable *st, TACOperand op) {
+    if (op.type != OPERAND_VAR) return NULL;
+    Symbol *s = lookup_atom(st, op.val.varName);
+    return s && s->type == TYPE_FLEX ? s : NULL;
+}
+
+/* Flex tag inference. tac_execute tags a flex as char only through an
+   arithmetic store whose result has isCharType, and the front end never
+   gives a variable result that flag (optimize_arithmetic_assignments
+   retargets the op at the plain variable operand). Every flex therefore
+   holds a number; recording that on each flex operand lets the engines
+   print it without a runtime tag. */
+static void infer_flex_types(TACProgram *prog) {
+    for (TACInstr *instr = prog->head; instr; instr = instr->next) {
+        TACOperand *ops[3] = {&instr->result, &instr->arg1, &instr->arg2};
+        for (int i = 0; i < 3; i++) {
+            if (flex_symbol(prog->symbols, *ops[i])) ops[i]->flexType = FLEX_NUMBER;
+        }
+    }
+}
+
+TACProgram *tac_generate(ASTNode *ast, SymbolTable *symbols) {
+    TACProgram *prog = tac_create_program(symbols);
     tac_gen_stmt(prog, ast);
 
     optimize_constant_folding(prog);
     eliminate_dead_code(prog);     
     optimize_simple_assignments(prog);
     optimize_arithmetic_assignments(prog); 
+    merge_print_literals(prog);
+    infer_flex_types(prog);
 
     return prog;
 }
@@ -1010,14 +1167,14 @@ static void print_operand_value(TACOperand op, int *tempValues, TACProgram *prog
     switch (op.type) {
         case OPERAND_INT:
             if (isCharContext) {
-                printf("%c", op.val.intVal);
+                output_chr(op.val.intVal);
             } else {
-                printf("%d", op.val.intVal);
+                output_num(op.val.intVal);
             }
             break;
         
         case OPERAND_STR:  
-            printf("%s", op.val.strVal);
+            output_str(op.val.strVal);
             break;
             
         case OPERAND_TEMP: {
@@ -1037,20 +1194,21 @@ static void print_operand_value(TACOperand op, int *tempValues, TACProgram *prog
             }
             
             if (shouldPrintAsChar) {
-                printf("%c", value);
+                output_chr(value);
             } else {
-                printf("%d", value);
+                output_num(value);
             }
             break;
         }
             
         case OPERAND_VAR: {
-            Symbol *s = lookup(op.val.varName);
+            Symbol *s = lookup_atom(prog->symbols, op.val.varName);
             if (s) {
-                if (s->type == TYPE_CHR || (s->type == TYPE_FLEX && s->flexType == FLEX_CHAR)) {
-                    printf("%c", s->chrVal);
+                FlexType tag = op.flexType != FLEX_NONE ? op.flexType : VALUE_TAG(s->value);
+                if (s->type == TYPE_CHR || (s->type == TYPE_FLEX && tag == FLEX_CHAR)) {
+                    output_chr(VALUE_CHR(s->value));
                 } else {
-                    printf("%d", s->numVal);
+                    output_num(VALUE_NUM(s->value));
                 }
             }
             break;
@@ -1123,31 +1281,18 @@ void tac_print(TACProgram *prog) {
     }
 }
 /* Helper to get operand value */
-static int get_operand_value(TACOperand op, int *tempValues) {
+static int get_operand_value(SymbolTable *st, TACOperand op, int *tempValues) {
     switch (op.type) {
         case OPERAND_INT:
             return op.val.intVal;
         case OPERAND_TEMP:
             return tempValues[op.val.tempNum];
         case OPERAND_VAR: {
-            Symbol *s = lookup(op.val.varName);
+            Symbol *s = lookup_atom(st, op.val.varName);
             if (s) {
-                /*For chr type, return ASCII value as integer for arithmetic */
-                if (s->type == TYPE_CHR) {
-                    return (int)s->chrVal;
-                }
-                /* For flex, check runtime type */
-                else if (s->type == TYPE_FLEX) {
-                    if (s->flexType == FLEX_CHAR) {
-                        return (int)s->chrVal;
-                    } else {
-                        return s->numVal;
-                    }
-                }
-                /* For nmbr */
-                else {
-                    return s->numVal;
-                }
+                /* chr and char-tagged flex hold the sign-extended char code,
+                   so every type reads the same way */
+                return VALUE_NUM(s->value);
             }
             return 0;
         }
@@ -1157,29 +1302,19 @@ static int get_operand_value(TACOperand op, int *tempValues) {
 }
 
 /* Helper to set operand value */
-static void set_operand_value(TACOperand op, int value, int *tempValues) {
+static void set_operand_value(SymbolTable *st, TACOperand op, int value, int *tempValues) {
     switch (op.type) {
         case OPERAND_TEMP:
             tempValues[op.val.tempNum] = value;
             break;
         case OPERAND_VAR: {
-            Symbol *s = lookup(op.val.varName);
+            Symbol *s = lookup_atom(st, op.val.varName);
             if (s) {
                 // Check if the value being set has char type info
                 if (op.isCharType) {
                     // This is a character value, use set_char
                     set_char(s, (char)value);
                 }
-                // For flex types, determine the type based on context
-                else if (s->type == TYPE_FLEX) {
-                    // If assigning a char to flex, preserve char type
-                    if (op.isCharType || (value >= 0 && value <= 127)) {
-                        // default to number unless explicitly marked as char
-                        set_number(s, value);
-                    } else {
-                        set_number(s, value);
-                    }
-                }
                 // Use appropriate setter based on variable type
                 else if (s->type == TYPE_CHR) {
                     set_char(s, (char)value);
@@ -1195,8 +1330,164 @@ static void set_operand_value(TACOperand op, int value, int *tempValues) {
 }
 
 
+/* Quickening. Before a program first runs, each instruction is rewritten
+   in place into a form with its symbols resolved and its print decision
+   taken. Colang programs are straight-line, so the gain is on the next
+   executions of the same program (native_check's repeated runs,
+   embedders); the first run pays one extra walk over the program. */
+static void quicken(TACProgram *prog, TACInstr *instr, const unsigned char *tempIsChar) {
+    TACOperand *ops[3] = {&instr->result, &instr->arg1, &instr->arg2};
+    for (int i = 0; i < 3; i++) {
+        instr->quickSym[i] = ops[i]->type == OPERAND_VAR ? lookup_atom(prog->symbols, ops[i]->val.varName) : NULL;
+        if (ops[i]->type == OPERAND_VAR && !instr->quickSym[i]) return;
+    }
+
+    switch (instr->op) {
+        case TAC_ADD:
+        case TAC_SUB:
+        case TAC_MUL:
+        case TAC_DIV:
+            instr->quick = instr->op == TAC_ADD ? QUICK_ADD : instr->op == TAC_SUB ? QUICK_SUB :
+                           instr->op == TAC_MUL ? QUICK_MUL : QUICK_DIV;
+            break;
+        case TAC_LOAD_INT:
+        case TAC_COPY:
+            instr->quick = QUICK_MOVE;
+            break;
+        case TAC_CONCAT: {
+            TACOperand op = instr->arg1;
+            Symbol *s = instr->quickSym[1];
+            if (op.type == OPERAND_STR) {
+                instr->quick = QUICK_PRINT_STR;
+            } else if (op.type == OPERAND_INT) {
+                instr->quick = op.isCharType ? QUICK_PRINT_CHR : QUICK_PRINT_NUM;
+            } else if (op.type == OPERAND_TEMP) {
+                instr->quick = tempIsChar[op.val.tempNum] ? QUICK_PRINT_CHR : QUICK_PRINT_NUM;
+            } else if (op.type == OPERAND_VAR) {
+                // A flex without a proven tag prints by its runtime tag on the generic path
+                if (s->type == TYPE_FLEX && op.flexType == FLEX_NONE) return;
+                int isChar = s->type == TYPE_CHR || op.flexType == FLEX_CHAR;
+                instr->quick = isChar ? QUICK_PRINT_CHR : QUICK_PRINT_NUM;
+            } else {
+                instr->quick = QUICK_SKIP;
+            }
+            break;
+        }
+        case TAC_PRINT:
+            instr->quick = instr->arg1.type == OPERAND_STR ? QUICK_PRINT_STR : QUICK_SKIP;
+            break;
+        default:
+            instr->quick = QUICK_SKIP;
+            break;
+    }
+}
+
+static void quicken_program(TACProgram *prog) {
+    /* A temp prints as char when the first instruction producing it says so */
+    unsigned char *tempIsChar = calloc(prog->tempCount > 0 ? prog->tempCount : 1, 1);
+    unsigned char *tempSeen = calloc(prog->tempCount > 0 ? prog->tempCount : 1, 1);
+    if (!tempIsChar || !tempSeen) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (TACInstr *instr = prog->head; instr; instr = instr->next) {
+        if (instr->result.type != OPERAND_TEMP) continue;
+        int t = instr->result.val.tempNum;
+        if (!tempSeen[t]) {
+            tempSeen[t] = 1;
+            tempIsChar[t] = (unsigned char)instr->resultIsChar;
+        }
+    }
+
+    for (TACInstr *instr = prog->head; instr; instr = instr->next) {
+        if (instr->quick == QUICK_NONE) quicken(prog, instr, tempIsChar);
+    }
+    prog->quickened = 1;
+    free(tempIsChar);
+    free(tempSeen);
+}
+
+/* Same value as get_operand_value, without the lookup */
+static int quick_read(const TACOperand *op, const Symbol *s, const int *tempValues) {
+    if (s) return VALUE_NUM(s->value);
+    switch (op->type) {
+        case OPERAND_TEMP: return tempValues[op->val.tempNum];
+        case OPERAND_INT:  return op->val.intVal;
+        default:           return 0;
+    }
+}
+
+/* Same effect as set_operand_value, without the lookup */
+static void quick_store(TACInstr *instr, int value, int isMove, int *tempValues) {
+    Symbol *s = instr->quickSym[0];
+    if (!s) {
+        if (instr->result.type == OPERAND_TEMP) tempValues[instr->result.val.tempNum] = value;
+        return;
+    }
+    // A move tags by destination only; arithmetic honours the result's char flag
+    if (s->type == TYPE_CHR || (!isMove && instr->result.isCharType)) {
+        set_char(s, (char)value);
+    } else {
+        set_number(s, value);
+    }
+}
+
+/* Run a quickened instruction. Returns 0 when done and 1 on a runtime
+   error, left to the caller to report. */
+static int run_quick(TACInstr *instr, int *tempValues) {
+    if (instr->quick == QUICK_PRINT_STR) {
+        output_str(instr->arg1.val.strVal);
+        return 0;
+    }
+    if (instr->quick == QUICK_SKIP) return 0;
+
+    Symbol **sym = instr->quickSym;
+    int left = quick_read(&instr->arg1, sym[1], tempValues);
+    switch (instr->quick) {
+        case QUICK_ADD: quick_store(instr, left + quick_read(&instr->arg2, sym[2], tempValues), 0, tempValues); break;
+        case QUICK_SUB: quick_store(instr, left - quick_read(&instr->arg2, sym[2], tempValues), 0, tempValues); break;
+        case QUICK_MUL: quick_store(instr, left * quick_read(&instr->arg2, sym[2], tempValues), 0, tempValues); break;
+        case QUICK_DIV: {
+            int right = quick_read(&instr->arg2, sym[2], tempValues);
+            if (right == 0) return 1;
+            quick_store(instr, left / right, 0, tempValues);
+            break;
+        }
+        case QUICK_MOVE:
+            quick_store(instr, left, 1, tempValues);
+            break;
+        case QUICK_PRINT_NUM:
+        case QUICK_PRINT_CHR:
+            if (instr->quick == QUICK_PRINT_CHR) {
+                output_chr(left);
+            } else {
+                output_num(left);
+            }
+            break;
+        default:
+            break;
+    }
+    return 0;
+}
+
+/* Division by zero is the only runtime error */
+static void runtime_error(TACProgram *prog, TACInstr *instr) {
+    prog->fault = instr;
+    if (prog->quiet) return;
+    output_flush();
+    fprintf(stderr, "Runtime error at line %d: Division by zero\n", instr->line);
+}
+
+int tac_evaluate(TACProgram *prog) {
+    prog->quiet = 1;
+    int status = tac_execute(prog);
+    prog->quiet = 0;
+    return status;
+}
+
 int tac_execute(TACProgram *prog) {
     if (!prog || !prog->head) return 1;
+    prog->fault = NULL;
     
     /* Allocate temporary storage for all temps */
     int *tempValues = calloc(prog->tempCount, sizeof(int));
@@ -1206,32 +1497,32 @@ int tac_execute(TACProgram *prog) {
     }
     
     /* Execute each instruction */
+    if (!prog->quickened) quicken_program(prog);
     for (TACInstr *instr = prog->head; instr; instr = instr->next) {
+        if (instr->quick != QUICK_NONE) {
+            if (run_quick(instr, tempValues) == 0) continue;
+            runtime_error(prog, instr);
+            free(tempValues);
+            return 1;
+        }
+
         switch (instr->op) {
             case TAC_LOAD_INT: {
-                int value = get_operand_value(instr->arg1, tempValues);
+                int value = get_operand_value(prog->symbols, instr->arg1, tempValues);
                 
                 //Handle type conversion on load
+                // A char loaded into nmbr or flex is stored as its ASCII number
                 if (instr->result.type == OPERAND_VAR) {
-                    Symbol *s = lookup(instr->result.val.varName);
+                    Symbol *s = lookup_atom(prog->symbols, instr->result.val.varName);
                     if (s) {
-                        // If loading char into nmbr, convert to ASCII
-                        if (s->type == TYPE_NMBR && (instr->resultIsChar || instr->arg1.isCharType)) {
-                            set_number(s, value);  // Store as ASCII number
-                        }
-                        // If destination is char type
-                        else if (s->type == TYPE_CHR && (instr->resultIsChar || instr->arg1.isCharType)) {
-                            set_char(s, (char)value);
-                        }
-                        // Default behavior
-                        else if (s->type == TYPE_CHR) {
+                        if (s->type == TYPE_CHR) {
                             set_char(s, (char)value);
                         } else {
                             set_number(s, value);
                         }
                     }
                 } else {
-                    set_operand_value(instr->result, value, tempValues);
+                    set_operand_value(prog->symbols, instr->result, value, tempValues);
                 }
                 break;
             }
@@ -1242,74 +1533,54 @@ int tac_execute(TACProgram *prog) {
             }
             
             case TAC_ADD: {
-                int left = get_operand_value(instr->arg1, tempValues);
-                int right = get_operand_value(instr->arg2, tempValues);
-                set_operand_value(instr->result, left + right, tempValues);
+                int left = get_operand_value(prog->symbols, instr->arg1, tempValues);
+                int right = get_operand_value(prog->symbols, instr->arg2, tempValues);
+                set_operand_value(prog->symbols, instr->result, left + right, tempValues);
                 break;
             }
             
             case TAC_SUB: {
-                int left = get_operand_value(instr->arg1, tempValues);
-                int right = get_operand_value(instr->arg2, tempValues);
-                set_operand_value(instr->result, left - right, tempValues);
+                int left = get_operand_value(prog->symbols, instr->arg1, tempValues);
+                int right = get_operand_value(prog->symbols, instr->arg2, tempValues);
+                set_operand_value(prog->symbols, instr->result, left - right, tempValues);
                 break;
             }
             
             case TAC_MUL: {
-                int left = get_operand_value(instr->arg1, tempValues);
-                int right = get_operand_value(instr->arg2, tempValues);
-                set_operand_value(instr->result, left * right, tempValues);
+                int left = get_operand_value(prog->symbols, instr->arg1, tempValues);
+                int right = get_operand_value(prog->symbols, instr->arg2, tempValues);
+                set_operand_value(prog->symbols, instr->result, left * right, tempValues);
                 break;
             }
             
             case TAC_DIV: {
-                int left = get_operand_value(instr->arg1, tempValues);
-                int right = get_operand_value(instr->arg2, tempValues);
+                int left = get_operand_value(prog->symbols, instr->arg1, tempValues);
+                int right = get_operand_value(prog->symbols, instr->arg2, tempValues);
                 if (right == 0) {
-                    fprintf(stderr, "Runtime error at line %d: Division by zero\n", instr->line);
+                    runtime_error(prog, instr);
                     free(tempValues);
                     return 1;
                 }
-                set_operand_value(instr->result, left / right, tempValues);
+                set_operand_value(prog->symbols, instr->result, left / right, tempValues);
                 break;
             }
             
             case TAC_COPY: {
-                int value = get_operand_value(instr->arg1, tempValues);
+                int value = get_operand_value(prog->symbols, instr->arg1, tempValues);
                 
-                //Handle chr to nmbr conversion
+                // Only the destination decides the setter: a char copied into
+                // nmbr or flex becomes its ASCII number
                 if (instr->result.type == OPERAND_VAR) {
-                    Symbol *destSym = lookup(instr->result.val.varName);
+                    Symbol *destSym = lookup_atom(prog->symbols, instr->result.val.varName);
                     if (destSym) {
-                        // Check if source is char type
-                        int sourceIsChar = 0;
-                        if (instr->arg1.type == OPERAND_VAR) {
-                            Symbol *srcSym = lookup(instr->arg1.val.varName);
-                            if (srcSym && (srcSym->type == TYPE_CHR || 
-                                (srcSym->type == TYPE_FLEX && srcSym->flexType == FLEX_CHAR))) {
-                                sourceIsChar = 1;
-                            }
-                        } else if (instr->arg1.isCharType) {
-                            sourceIsChar = 1;
-                        }
-                        
-                        // If destination is nmbr and source is char, convert to ASCII
-                        if (destSym->type == TYPE_NMBR && sourceIsChar) {
-                            set_number(destSym, value);  // Store ASCII value as number
-                        }
-                        // If destination is char and source provides char info
-                        else if (destSym->type == TYPE_CHR && sourceIsChar) {
-                            set_char(destSym, (char)value);
-                        }
-                        // Otherwise use appropriate setter
-                        else if (destSym->type == TYPE_CHR) {
+                        if (destSym->type == TYPE_CHR) {
                             set_char(destSym, (char)value);
                         } else {
                             set_number(destSym, value);
                         }
                     }
                 } else {
-                    set_operand_value(instr->result, value, tempValues);
+                    set_operand_value(prog->symbols, instr->result, value, tempValues);
                 }
                 break;
             }
@@ -1328,13 +1599,9 @@ int tac_execute(TACProgram *prog) {
                         }
                         check = check->next;
                     }
-                } else if (instr->arg1.type == OPERAND_VAR) {
-                    Symbol *s = lookup(instr->arg1.val.varName);
-                    if (s && (s->type == TYPE_CHR || (s->type == TYPE_FLEX && s->flexType == FLEX_CHAR))) {
-                        isCharContext = 1;
-                    }
                 } else {
-                    // Use the isCharType flag on the operand itself
+                    // Use the isCharType flag on the operand itself; variables
+                    // print by their type and proven flex tag
                     isCharContext = instr->arg1.isCharType;
                 }
                 
@@ -1345,7 +1612,7 @@ int tac_execute(TACProgram *prog) {
             case TAC_PRINT: {
                 // This is just for the final newline
                 if (instr->arg1.type == OPERAND_STR) {
-                    printf("%s", instr->arg1.val.strVal);
+                    output_str(instr->arg1.val.strVal);
                 }
                 break;
             }
@@ -1355,45 +1622,36 @@ int tac_execute(TACProgram *prog) {
         }
     }
     
+    output_flush();
     free(tempValues);
     return 0;
 }
 
 
-/* Get memory offset for variable/temp */
-static int get_memory_offset(TACOperand op) {
-    if (op.type == OPERAND_VAR) {
-        Symbol *s = lookup(op.val.varName);
-        if (s) {
-            return s->memOffset;
-        }
-    }
-    return -1;  /* Temps don't have memory */
-}
-
 /* Register mappings */
 static int get_register_number(const char *reg) {
     if (strcmp(reg, "$zero") == 0) return 0;
     if (strcmp(reg, "$at") == 0) return 1;
     
-    // r2-r11 mapping (registers 2-11)
-    if (reg[0] == '$' && reg[1] == 'r') {
-        int num = atoi(reg + 2);
+    // r2-r11 mapping (registers 2-11), with or without the '$' prefix
+    if (reg[0] == '$') reg++;
+    if (reg[0] == 'r') {
+        int num = atoi(reg + 1);
         if (num >= 2 && num <= 11) {
             return num;  // Direct mapping: r2=2, r3=3, ..., r11=11
         }
     }
     //old deprecated mappings
-    if (reg[0] == '$' && reg[1] == 't') {
-        int num = atoi(reg + 2);
+    if (reg[0] == 't') {
+        int num = atoi(reg + 1);
         if (num >= 0 && num <= 7) return 8 + num;   // $t0-$t7
         if (num >= 8 && num <= 9) return 24 + (num - 8); // $t8-$t9
     }
 
     //old deprecated mappings
     // $s0-$s7 (saved)
-    if (reg[0] == '$' && reg[1] == 's') {
-        int num = atoi(reg + 2);
+    if (reg[0] == 's') {
+        int num = atoi(reg + 1);
         if (num >= 0 && num <= 7) return 16 + num;
     }
     
@@ -1420,109 +1678,228 @@ static uint32_t encode_i_format(int opcode, int rs, int rt, int16_t immediate) {
     return instr;
 }
 
-/* Print 32-bit binary representation */
-static void print_binary(FILE *fp, uint32_t value) {
+/* Append the 32-bit binary representation */
+static void render_binary(TextBuf *out, uint32_t value) {
+    char bits[32];
     for (int i = 31; i >= 0; i--) {
-        fprintf(fp, "%d", (value >> i) & 1);
+        bits[31 - i] = (char)('0' + ((value >> i) & 1));
     }
+    textbuf_append(out, bits, sizeof(bits));
 }
 
-/* Print hexadecimal representation */
-static void print_hex(FILE *fp, uint32_t value) {
-    fprintf(fp, "0x%08X", value);
+/* Append the hexadecimal representation */
+static void render_hex(TextBuf *out, uint32_t value) {
+    textbuf_printf(out, "0x%08X", value);
 }
 
-/* Optimize consecutive LOAD_INT -> COPY sequences */
+/* Store a register into a variable using the type-appropriate width */
+static void emit_store_var(Lowering *lw, Symbol *s, int regIdx, int charStore) {
+    int mirrors = lw->target->store_var(lw->ctx, regIdx, s, charStore);
+    note_var_store(lw, s, regIdx, mirrors);
+}
 
-/* Generate EduMIPS64 assembly and binary code */
-/* Improved assembly generation with register allocation */
-void tac_generate_assembly(TACProgram *prog) {
-    char assembly_output[99999] = "";
-    char hex_output[99999] = "";
-    char binary_output[99999] = "";
+/* Load an immediate into the first work register and store it into a variable */
+static void emit_store_immediate(Lowering *lw, Symbol *s, int immediate) {
+    clobber_register(lw, 0);
+    lw->target->load_imm(lw->ctx, 0, immediate);
+    emit_store_var(lw, s, 0, 0);
+}
+
+/* EduMIPS64 target: encodes straight into a MIPSCode buffer. Arithmetic
+   uses the 32-bit forms (addu, mult), so every register holds a
+   sign-extended word, exactly what lw reads back after sw. */
+typedef struct {
+    MIPSCode *code;
+    int spillBase;          // first temp slot, past the last variable
+} MIPSContext;
+
+static int mips_reg(int regIdx) {
+    return get_register_number(get_reg_name(regIdx));
+}
+
+static void mips_load_var(void *ctx, int reg, Symbol *s) {
+    MIPSContext *m = ctx;
+    int load_op, store_op, imm_op;
+    get_load_store_opcodes(s->type, &load_op, &store_op, &imm_op);
+    mips_code_append(m->code, encode_i_format(load_op, 0, mips_reg(reg), (int16_t)s->memOffset));
+}
+
+static int mips_store_var(void *ctx, int reg, Symbol *s, int charStore) {
+    MIPSContext *m = ctx;
+    int load_op, store_op, imm_op;
+    (void)charStore;
+    get_load_store_opcodes(s->type, &load_op, &store_op, &imm_op);
+    mips_code_append(m->code, encode_i_format(store_op, 0, mips_reg(reg), (int16_t)s->memOffset));
+    // sb truncates: the register then no longer matches what lb reads back
+    return s->type != TYPE_CHR;
+}
+
+static void mips_load_imm(void *ctx, int reg, int imm) {
+    MIPSContext *m = ctx;
+    mips_code_append(m->code, encode_i_format(OPCODE_DADDIU, 0, mips_reg(reg), (int16_t)imm));
+}
+
+static void mips_move(void *ctx, int dst, int src) {
+    MIPSContext *m = ctx;
+    mips_code_append(m->code, encode_r_format(FUNCT_DADDU, mips_reg(src), 0, mips_reg(dst), 0));
+}
+
+static void mips_arith(void *ctx, TACOp op, int dst, int left, int right, int line) {
+    MIPSContext *m = ctx;
+    int funct;
+    int needsMflo = 0;
+    (void)line;
+    
+    switch (op) {
+        case TAC_ADD: funct = FUNCT_ADDU; break;
+        case TAC_SUB: funct = FUNCT_SUBU; break;
+        case TAC_MUL: funct = FUNCT_MULT; needsMflo = 1; break;
+        case TAC_DIV: funct = FUNCT_DIV; needsMflo = 1; break;
+        default: funct = FUNCT_ADDU;
+    }
     
-    strcat(assembly_output, ".data\n\n.code\n\n");
+    int rs = mips_reg(left);
+    int rt = mips_reg(right);
+    int rd = mips_reg(dst);
     
-    int tempStorageOffset = 1000;
+    if (needsMflo) {
+        mips_code_append(m->code, encode_r_format(funct, rs, rt, 0, 0));
+        mips_code_append(m->code, encode_r_format(FUNCT_MFLO, 0, 0, rd, 0));
+    } else {
+        mips_code_append(m->code, encode_r_format(funct, rs, rt, rd, 0));
+    }
+}
+
+/* Temps spill to a scratch area above the variables */
+static void mips_spill(void *ctx, int reg, int tempNum) {
+    MIPSContext *m = ctx;
+    int offset = m->spillBase + tempNum * 8;
+    mips_code_append(m->code, encode_i_format(OPCODE_SD, 0, mips_reg(reg), (int16_t)offset));
+}
+
+static void mips_reload(void *ctx, int reg, int tempNum) {
+    MIPSContext *m = ctx;
+    int offset = m->spillBase + tempNum * 8;
+    mips_code_append(m->code, encode_i_format(OPCODE_LD, 0, mips_reg(reg), (int16_t)offset));
+}
+
+static const TargetDesc mips_target = {
+    "EduMIPS64", 8,
+    mips_load_var, mips_store_var, mips_load_imm, mips_move, mips_arith, mips_spill, mips_reload,
+    NULL, NULL, NULL,
+};
+
+/* Mark a variable operand as already read or written */
+static void mark_var_seen(SymbolTable *st, TACOperand op, int *seen) {
+    if (op.type != OPERAND_VAR) return;
+    Symbol *s = lookup_atom(st, op.val.varName);
+    if (s) seen[s - st->entries] = 1;
+}
+
+/* Move constant initializers into .data. A write is folded when it is the
+   first thing that touches the variable and its source is a constant, so
+   the value can be present before the first instruction runs. */
+static void layout_initialized_data(TACProgram *prog) {
+    SymbolTable *st = prog->symbols;
+    int *seen = calloc(st->count > 0 ? st->count : 1, sizeof(int));
+    if (!seen) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    
+    for (int i = 0; i < st->count; i++) {
+        st->entries[i].hasInitValue = 0;
+        st->entries[i].initValue = 0;
+    }
+    
+    for (TACInstr *instr = prog->head; instr; instr = instr->next) {
+        instr->isStaticInit = 0;
+        mark_var_seen(st, instr->arg1, seen);
+        mark_var_seen(st, instr->arg2, seen);
+        
+        if (instr->result.type != OPERAND_VAR) continue;
+        Symbol *s = lookup_atom(st, instr->result.val.varName);
+        if (!s) continue;
+        
+        if (!seen[s - st->entries] &&
+            (instr->op == TAC_LOAD_INT || instr->op == TAC_COPY) &&
+            (instr->arg1.type == OPERAND_INT || instr->arg1.type == OPERAND_STR)) {
+            // A string source only appears as the flex default and reads as 0
+            int value = instr->arg1.type == OPERAND_INT ? instr->arg1.val.intVal : 0;
+            s->hasInitValue = 1;
+            s->initValue = s->type == TYPE_CHR ? (char)value : value;
+            instr->isStaticInit = 1;
+        }
+        seen[s - st->entries] = 1;
+    }
+    
+    free(seen);
+}
+
+/* Print one shw piece, deciding char vs number the way tac_execute does */
+static void lower_print(Lowering *lw, TACProgram *prog, TACInstr *instr) {
+    TACOperand op = instr->arg1;
+    switch (op.type) {
+        case OPERAND_INT:
+            lw->target->print_imm(lw->ctx, op.val.intVal, op.isCharType);
+            break;
+        case OPERAND_STR:
+            lw->target->print_str(lw->ctx, op.val.strVal);
+            break;
+        case OPERAND_TEMP: {
+            int isChar = 0;
+            for (TACInstr *p = prog->head; p; p = p->next) {
+                if (p->result.type == OPERAND_TEMP && p->result.val.tempNum == op.val.tempNum) {
+                    isChar = p->resultIsChar;
+                    break;
+                }
+            }
+            int reg = load_operand(lw, op, instr);
+            lw->target->print_reg(lw->ctx, reg, isChar ? PRINT_AS_CHAR : PRINT_AS_NUMBER);
+            break;
+        }
+        case OPERAND_VAR: {
+            Symbol *s = lookup_atom(lw->symbols, op.val.varName);
+            if (!s) break;
+            int reg = load_operand(lw, op, instr);
+            PrintKind kind = s->type == TYPE_CHR || op.flexType == FLEX_CHAR ? PRINT_AS_CHAR : PRINT_AS_NUMBER;
+            lw->target->print_reg(lw->ctx, reg, kind);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+/* Register allocation and instruction selection shared by all targets */
+void tac_lower(TACProgram *prog, const TargetDesc *desc, void *ctx) {
+    Lowering state = { .target = desc, .ctx = ctx, .symbols = prog->symbols };
+    Lowering *lw = &state;
     
-    init_register_state();
+    init_register_state(lw);
+    layout_initialized_data(prog);
     
     for (TACInstr *instr = prog->head; instr; instr = instr->next) {
-        if (instr->inShwContext) {
+        if (instr->isStaticInit || (instr->inShwContext && !lw->target->print_str)) {
             continue;
         }
         
-        char asm_line[256] = "";
-        
         switch (instr->op) {
             case TAC_LOAD_INT: {
                 if (instr->result.type == OPERAND_VAR) {
-                    Symbol *s = lookup(instr->result.val.varName);
+                    Symbol *s = lookup_atom(lw->symbols, instr->result.val.varName);
                     if (s) {
-                        int immediate = instr->arg1.val.intVal;
-                        
-                        // TYPE-AWARE immediate load
-                        int load_op, store_op, imm_op;
-                        get_load_store_opcodes(s->type, &load_op, &store_op, &imm_op);
-                        const char *imm_instr = get_imm_mnemonic(s->type);
-                        const char *store_instr = get_store_mnemonic(s->type);
-                        
-                        snprintf(asm_line, sizeof(asm_line), "%s r2, r0, %d\n", imm_instr, immediate);
-                        strcat(assembly_output, asm_line);
-                        
-                        uint32_t mc = encode_i_format(imm_op, 0, 2, (int16_t)immediate);
-                        char hex_str[32];
-                        sprintf(hex_str, "0x%08X\n", mc);
-                        strcat(hex_output, hex_str);
-                        
-                        char bin_str[40];
-                        for (int i = 31; i >= 0; i--) {
-                            sprintf(bin_str + (31 - i), "%d", (mc >> i) & 1);
-                        }
-                        strcat(binary_output, bin_str);
-                        strcat(binary_output, "\n");
-                        
-                        // TYPE-AWARE store
-                        snprintf(asm_line, sizeof(asm_line), "%s r2, %d(r0)\n", store_instr, s->memOffset);
-                        strcat(assembly_output, asm_line);
-                        
-                        mc = encode_i_format(store_op, 0, 2, (int16_t)s->memOffset);
-                        sprintf(hex_str, "0x%08X\n", mc);
-                        strcat(hex_output, hex_str);
-                        
-                        for (int i = 31; i >= 0; i--) {
-                            sprintf(bin_str + (31 - i), "%d", (mc >> i) & 1);
-                        }
-                        strcat(binary_output, bin_str);
-                        strcat(binary_output, "\n");
+                        // TYPE-AWARE immediate load and store
+                        emit_store_immediate(lw, s, instr->arg1.val.intVal);
                     }
                 } else if (instr->result.type == OPERAND_TEMP) {
                     // Temp storage - use word operations
-                    int regIdx = allocate_register_for_temp(instr, instr->result.val.tempNum, 
-                                                        assembly_output, hex_output, binary_output, 
-                                                        tempStorageOffset);
-                    const char *regName = get_reg_name(regIdx);
-                    
-                    int immediate = instr->arg1.val.intVal;
+                    int regIdx = allocate_register_for_temp(lw, instr, instr->result.val.tempNum);
                     
-                    snprintf(asm_line, sizeof(asm_line), "daddiu %s, r0, %d\n", regName, immediate);
-                    strcat(assembly_output, asm_line);
+                    clobber_register(lw, regIdx);
+                    lw->target->load_imm(lw->ctx, regIdx, instr->arg1.val.intVal);
                     
-                    int rt = get_register_number(regName);
-                    uint32_t mc = encode_i_format(OPCODE_ADDIU, 0, rt, (int16_t)immediate);
-                    
-                    char hex_str[32];
-                    sprintf(hex_str, "0x%08X\n", mc);
-                    strcat(hex_output, hex_str);
-                    
-                    char bin_str[40];
-                    for (int i = 31; i >= 0; i--) {
-                        sprintf(bin_str + (31 - i), "%d", (mc >> i) & 1);
-                    }
-                    strcat(binary_output, bin_str);
-                    strcat(binary_output, "\n");
-                    
-                    regState[regIdx].isDirty = 1;
+                    lw->regs[regIdx].isDirty = 1;
                 }
                 break;
             }
@@ -1532,51 +1909,28 @@ void tac_generate_assembly(TACProgram *prog) {
             case TAC_MUL:
             case TAC_DIV: {
                 // Load left operand into register
-                int leftReg = load_operand(instr->arg1, instr, assembly_output, hex_output, binary_output, tempStorageOffset);
-                
-                // Mark left register as "in use" temporarily to prevent it from being evicted
-                int savedLeftTemp = regState[leftReg].tempNum;
-                int savedLeftDirty = regState[leftReg].isDirty;
+                int leftReg = load_operand(lw, instr->arg1, instr);
                 
                 // Load right operand (this won't evict leftReg now)
-                int rightReg = load_operand_ex(instr->arg2, instr, assembly_output, hex_output, binary_output, tempStorageOffset, leftReg);
+                int rightReg = load_operand_ex(lw, instr->arg2, instr, leftReg);
                 
                 // If both operands ended up in the same register (shouldn't happen but just in case)
                 if (leftReg == rightReg && instr->arg1.type != instr->arg2.type) {
                     // Move one to a different register
-                    int newRightReg = find_register_to_evict(instr);
+                    int newRightReg = find_register_to_evict(lw, instr);
                     if (newRightReg == leftReg) {
                         // Find another register
-                        for (int i = 0; i < NUM_WORK_REGS; i++) {
+                        for (int i = 0; i < lw->target->numRegs; i++) {
                             if (i != leftReg) {
                                 newRightReg = i;
                                 break;
                             }
                         }
                     }
-                    spill_register(newRightReg, assembly_output, hex_output, binary_output, tempStorageOffset);
+                    evict_register(lw, newRightReg);
                     
-                    const char *srcRegName = get_reg_name(rightReg);
-                    const char *destRegName = get_reg_name(newRightReg);
-                    
-                    char move_line[256];
-                    snprintf(move_line, sizeof(move_line), "daddu %s, %s, r0  ; move to avoid conflict\n", destRegName, srcRegName);
-                    strcat(assembly_output, move_line);
-                    
-                    int rs = get_register_number(srcRegName);
-                    int rd = get_register_number(destRegName);
-                    uint32_t mc = encode_r_format(FUNCT_DADDU, rs, 0, rd, 0);
-                    
-                    char hex_str[32];
-                    sprintf(hex_str, "0x%08X\n", mc);
-                    strcat(hex_output, hex_str);
-                    
-                    char bin_str[40];
-                    for (int i = 31; i >= 0; i--) {
-                        sprintf(bin_str + (31 - i), "%d", (mc >> i) & 1);
-                    }
-                    strcat(binary_output, bin_str);
-                    strcat(binary_output, "\n");
+                    // move to avoid conflict
+                    lw->target->move(lw->ctx, newRightReg, rightReg);
                     
                     rightReg = newRightReg;
                 }
@@ -1590,128 +1944,48 @@ void tac_generate_assembly(TACProgram *prog) {
                     if (instr->arg1.type == OPERAND_TEMP && 
                         find_next_use_distance(instr, instr->arg1.val.tempNum) == 9999) {
                         destReg = leftReg;  // Reuse left register!
-                        regState[destReg].tempNum = instr->result.val.tempNum;
-                        regState[destReg].lastUseDistance = find_next_use_distance(instr, instr->result.val.tempNum);
+                        lw->regs[destReg].tempNum = instr->result.val.tempNum;
+                        lw->regs[destReg].lastUseDistance = find_next_use_distance(instr, instr->result.val.tempNum);
                     }
                     // Check if right operand is a temp that dies here
                     else if (instr->arg2.type == OPERAND_TEMP && 
                             find_next_use_distance(instr, instr->arg2.val.tempNum) == 9999) {
                         destReg = rightReg;  // Reuse right register!
-                        regState[destReg].tempNum = instr->result.val.tempNum;
-                        regState[destReg].lastUseDistance = find_next_use_distance(instr, instr->result.val.tempNum);
+                        lw->regs[destReg].tempNum = instr->result.val.tempNum;
+                        lw->regs[destReg].lastUseDistance = find_next_use_distance(instr, instr->result.val.tempNum);
                     }
                     else {
                         // Need a new register
-                        destReg = allocate_register_for_temp(instr, instr->result.val.tempNum,
-                                                            assembly_output, hex_output, binary_output,
-                                                            tempStorageOffset);
+                        destReg = allocate_register_for_temp(lw, instr, instr->result.val.tempNum);
                     }
                 } else {
                     // Result is a variable, use any register
-                    destReg = find_register_to_evict(instr);
+                    destReg = find_register_to_evict(lw, instr);
                     if (destReg == leftReg || destReg == rightReg) {
-                        for (int i = 0; i < NUM_WORK_REGS; i++) {
+                        for (int i = 0; i < lw->target->numRegs; i++) {
                             if (i != leftReg && i != rightReg) {
                                 destReg = i;
                                 break;
                             }
                         }
                     }
+                    evict_register(lw, destReg);
                 }
-                                
-                const char *leftRegName = get_reg_name(leftReg);
-                const char *rightRegName = get_reg_name(rightReg);
-                const char *destRegName = get_reg_name(destReg);
                 
                 // Perform operation
-                const char *opName;
-                int funct;
-                int needsMflo = 0;
-                
-                switch (instr->op) {
-                    case TAC_ADD: opName = "daddu"; funct = FUNCT_DADDU; break;
-                    case TAC_SUB: opName = "dsubu"; funct = FUNCT_DSUBU; break;
-                    case TAC_MUL: opName = "dmult"; funct = FUNCT_DMULT; needsMflo = 1; break;
-                    case TAC_DIV: opName = "ddiv"; funct = FUNCT_DDIV; needsMflo = 1; break;
-                    default: opName = "daddu"; funct = FUNCT_DADDU;
-                }
-                
-                if (needsMflo) {
-                    snprintf(asm_line, sizeof(asm_line), "%s %s, %s\n", opName, leftRegName, rightRegName);
-                } else {
-                    snprintf(asm_line, sizeof(asm_line), "%s %s, %s, %s\n", opName, destRegName, leftRegName, rightRegName);
-                }
-                strcat(assembly_output, asm_line);
-                
-                int rs = get_register_number(leftRegName);
-                int rt = get_register_number(rightRegName);
-                int rd = get_register_number(destRegName);
-                uint32_t mc;
-                
-                if (needsMflo) {
-                    mc = encode_r_format(funct, rs, rt, 0, 0);
-                } else {
-                    mc = encode_r_format(funct, rs, rt, rd, 0);
-                }
-                
-                char hex_str[32];
-                sprintf(hex_str, "0x%08X\n", mc);
-                strcat(hex_output, hex_str);
-                
-                char bin_str[40];
-                for (int i = 31; i >= 0; i--) {
-                    sprintf(bin_str + (31 - i), "%d", (mc >> i) & 1);
-                }
-                strcat(binary_output, bin_str);
-                strcat(binary_output, "\n");
-                
-                if (needsMflo) {
-                    snprintf(asm_line, sizeof(asm_line), "mflo %s\n", destRegName);
-                    strcat(assembly_output, asm_line);
-                    
-                    mc = encode_r_format(FUNCT_MFLO, 0, 0, rd, 0);
-                    sprintf(hex_str, "0x%08X\n", mc);
-                    strcat(hex_output, hex_str);
-                    
-                    for (int i = 31; i >= 0; i--) {
-                        sprintf(bin_str + (31 - i), "%d", (mc >> i) & 1);
-                    }
-                    strcat(binary_output, bin_str);
-                    strcat(binary_output, "\n");
-                }
+                clobber_register(lw, destReg);
+                lw->target->arith(lw->ctx, instr->op, destReg, leftReg, rightReg, instr->line);
                 
                 // Mark result as dirty
-                regState[destReg].isDirty = 1;
+                lw->regs[destReg].isDirty = 1;
                 
                 // ALWAYS store result if it's a variable 
                 if (instr->result.type == OPERAND_VAR) {
-                    Symbol *s = lookup(instr->result.val.varName);
+                    Symbol *s = lookup_atom(lw->symbols, instr->result.val.varName);
                     if (s) {
-                        const char *destRegName = get_reg_name(destReg);
-                        
                         // TYPE-AWARE store operation
-                        int load_op, store_op, imm_op;
-                        get_load_store_opcodes(s->type, &load_op, &store_op, &imm_op);
-                        const char *store_instr = get_store_mnemonic(s->type);
-                        
-                        snprintf(asm_line, sizeof(asm_line), "%s %s, %d(r0)\n", store_instr, destRegName, s->memOffset);
-                        strcat(assembly_output, asm_line);
-                        
-                        int rd = get_register_number(destRegName);
-                        uint32_t mc = encode_i_format(store_op, 0, rd, (int16_t)s->memOffset);
-                        
-                        char hex_str[32];
-                        sprintf(hex_str, "0x%08X\n", mc);
-                        strcat(hex_output, hex_str);
-                        
-                        char bin_str[40];
-                        for (int i = 31; i >= 0; i--) {
-                            sprintf(bin_str + (31 - i), "%d", (mc >> i) & 1);
-                        }
-                        strcat(binary_output, bin_str);
-                        strcat(binary_output, "\n");
-                        
-                        regState[destReg].isDirty = 0; // No longer dirty after storing
+                        emit_store_var(lw, s, destReg, instr->result.isCharType);
+                        lw->regs[destReg].isDirty = 0; // No longer dirty after storing
                     }
                 }
 
@@ -1723,138 +1997,144 @@ void tac_generate_assembly(TACProgram *prog) {
                 if (instr->arg1.type == OPERAND_INT) {
                     // Direct copy of immediate to variable
                     if (instr->result.type == OPERAND_VAR) {
-                        Symbol *s = lookup(instr->result.val.varName);
+                        Symbol *s = lookup_atom(lw->symbols, instr->result.val.varName);
                         if (s) {
-                            int immediate = instr->arg1.val.intVal;
-                            
                             // TYPE-AWARE immediate load and store
-                            int load_op, store_op, imm_op;
-                            get_load_store_opcodes(s->type, &load_op, &store_op, &imm_op);
-                            const char *imm_instr = get_imm_mnemonic(s->type);
-                            const char *store_instr = get_store_mnemonic(s->type);
-                            
-                            // Load immediate into r2
-                            snprintf(asm_line, sizeof(asm_line), "%s r2, r0, %d\n", imm_instr, immediate);
-                            strcat(assembly_output, asm_line);
-                            
-                            int rt = 2;
-                            uint32_t mc = encode_i_format(imm_op, 0, rt, (int16_t)immediate);
-                            
-                            char hex_str[32];
-                            sprintf(hex_str, "0x%08X\n", mc);
-                            strcat(hex_output, hex_str);
-                            
-                            char bin_str[40];
-                            for (int i = 31; i >= 0; i--) {
-                                sprintf(bin_str + (31 - i), "%d", (mc >> i) & 1);
-                            }
-                            strcat(binary_output, bin_str);
-                            strcat(binary_output, "\n");
-                            
-                            // TYPE-AWARE store to variable
-                            snprintf(asm_line, sizeof(asm_line), "%s r2, %d(r0)\n", store_instr, s->memOffset);
-                            strcat(assembly_output, asm_line);
-                            
-                            mc = encode_i_format(store_op, 0, rt, (int16_t)s->memOffset);
-                            sprintf(hex_str, "0x%08X\n", mc);
-                            strcat(hex_output, hex_str);
-                            
-                            for (int i = 31; i >= 0; i--) {
-                                sprintf(bin_str + (31 - i), "%d", (mc >> i) & 1);
-                            }
-                            strcat(binary_output, bin_str);
-                            strcat(binary_output, "\n");
+                            emit_store_immediate(lw, s, instr->arg1.val.intVal);
                         }
                     }
                     break; 
                 }
                 
                 // Original code for copying from temp/variable
-                int srcReg = load_operand(instr->arg1, instr, assembly_output, hex_output, binary_output, tempStorageOffset);
+                int srcReg = load_operand(lw, instr->arg1, instr);
                 
                 if (instr->result.type == OPERAND_VAR) {
-                    Symbol *s = lookup(instr->result.val.varName);
+                    Symbol *s = lookup_atom(lw->symbols, instr->result.val.varName);
                     if (s) {
-                        const char *regName = get_reg_name(srcReg);
-                        
                         // TYPE-AWARE store
-                        int load_op, store_op, imm_op;
-                        get_load_store_opcodes(s->type, &load_op, &store_op, &imm_op);
-                        const char *store_instr = get_store_mnemonic(s->type);
-                        
-                        snprintf(asm_line, sizeof(asm_line), "%s %s, %d(r0)\n", store_instr, regName, s->memOffset);
-                        strcat(assembly_output, asm_line);
-                        
-                        int rt = get_register_number(regName);
-                        uint32_t mc = encode_i_format(store_op, 0, rt, (int16_t)s->memOffset);
-                        
-                        char hex_str[32];
-                        sprintf(hex_str, "0x%08X\n", mc);
-                        strcat(hex_output, hex_str);
-                        
-                        char bin_str[40];
-                        for (int i = 31; i >= 0; i--) {
-                            sprintf(bin_str + (31 - i), "%d", (mc >> i) & 1);
-                        }
-                        strcat(binary_output, bin_str);
-                        strcat(binary_output, "\n");
+                        emit_store_var(lw, s, srcReg, 0);
                     }
                 } else if (instr->result.type == OPERAND_TEMP) {
-                    int destReg = allocate_register_for_temp(instr, instr->result.val.tempNum,
-                                                            assembly_output, hex_output, binary_output,
-                                                            tempStorageOffset);
+                    int destReg = allocate_register_for_temp(lw, instr, instr->result.val.tempNum);
                     
                     if (srcReg != destReg) {
-                        const char *srcRegName = get_reg_name(srcReg);
-                        const char *destRegName = get_reg_name(destReg);
-                        
-                        snprintf(asm_line, sizeof(asm_line), "daddu %s, %s, r0\n", destRegName, srcRegName);
-                        strcat(assembly_output, asm_line);
-                        
-                        int rs = get_register_number(srcRegName);
-                        int rd = get_register_number(destRegName);
-                        uint32_t mc = encode_r_format(FUNCT_DADDU, rs, 0, rd, 0);
-                        
-                        char hex_str[32];
-                        sprintf(hex_str, "0x%08X\n", mc);
-                        strcat(hex_output, hex_str);
-                        
-                        char bin_str[40];
-                        for (int i = 31; i >= 0; i--) {
-                            sprintf(bin_str + (31 - i), "%d", (mc >> i) & 1);
-                        }
-                        strcat(binary_output, bin_str);
-                        strcat(binary_output, "\n");
+                        clobber_register(lw, destReg);
+                        lw->target->move(lw->ctx, destReg, srcReg);
                     }
                     
-                    regState[destReg].isDirty = 1;
+                    lw->regs[destReg].isDirty = 1;
                 }
                 break;
             }
             
+            case TAC_CONCAT:
+                if (lw->target->print_str) lower_print(lw, prog, instr);
+                break;
+            
+            case TAC_PRINT:
+                if (lw->target->print_str && instr->arg1.type == OPERAND_STR) {
+                    lw->target->print_str(lw->ctx, instr->arg1.val.strVal);
+                }
+                break;
+            
             default:
                 break;
         }
     }
-    
+}
 
-    
-    printf("assembly:\n\"%s\",", assembly_output);
-    printf("\nbinary:\n\"%s\",", binary_output);
-    printf("\nhex:\n\"%s\"", hex_output);
+/* Generate EduMIPS64 machine code with register allocation */
+MIPSCode *tac_assemble(TACProgram *prog) {
+    MIPSContext m = { mips_code_create(), 0 };
+    m.code->symbols = prog->symbols;
+    for (int i = 0; i < prog->symbols->count; i++) {
+        Symbol *s = &prog->symbols->entries[i];
+        if (s->memOffset + s->size > m.spillBase) m.spillBase = s->memOffset + s->size;
+    }
+    m.spillBase = (m.spillBase + 7) & ~7;
+    tac_lower(prog, &mips_target, &m);
+    return m.code;
+}
+
+/* Append the .data directives for every variable slot */
+static void render_data_section(SymbolTable *st, TextBuf *out) {
+    for (int i = 0; i < st->count; i++) {
+        Symbol *s = &st->entries[i];
+        if (!s->hasInitValue) {
+            textbuf_printf(out, "%s: .space %d\n", s->name, s->size);
+        } else if (s->type == TYPE_CHR) {
+            textbuf_printf(out, "%s: .byte %d\n", s->name, s->initValue);
+            if (s->size > 1) textbuf_printf(out, ".space %d\n", s->size - 1);
+        } else {
+            // Variables are accessed with lw/sw, so the value is a 32-bit word
+            textbuf_printf(out, "%s: .word32 %d\n", s->name, s->initValue);
+            if (s->size > 4) textbuf_printf(out, ".space %d\n", s->size - 4);
+        }
+    }
+}
+
+void tac_render_text(MIPSCode *code, TextBuf *assembly, TextBuf *binary, TextBuf *hex) {
+    char line[64];
+
+    if (assembly) {
+        textbuf_puts(assembly, ".data\n");
+        render_data_section(code->symbols, assembly);
+        textbuf_puts(assembly, "\n.code\n\n");
+        for (int i = 0; i < code->count; i++) {
+            textbuf_puts(assembly, mips_disassemble(code->words[i], line, sizeof(line)));
+            textbuf_append(assembly, "\n", 1);
+        }
+    }
+    if (binary) {
+        for (int i = 0; i < code->count; i++) {
+            render_binary(binary, code->words[i]);
+            textbuf_append(binary, "\n", 1);
+        }
+    }
+    if (hex) {
+        for (int i = 0; i < code->count; i++) {
+            render_hex(hex, code->words[i]);
+            textbuf_append(hex, "\n", 1);
+        }
+    }
+}
+
+/* Print the assembly listing, binary and hex dumps of an encoded program */
+void tac_render_assembly(MIPSCode *code) {
+    TextBuf assembly, binary, hex;
+    textbuf_init(&assembly);
+    textbuf_init(&binary);
+    textbuf_init(&hex);
+    tac_render_text(code, &assembly, &binary, &hex);
+
+    printf("assembly:\n\"");
+    fwrite(assembly.data, 1, assembly.len, stdout);
+    printf("\",");
+    printf("\nbinary:\n\"");
+    fwrite(binary.data, 1, binary.len, stdout);
+    printf("\",");
+    printf("\nhex:\n\"");
+    fwrite(hex.data, 1, hex.len, stdout);
+    printf("\"");
+
+    textbuf_free(&assembly);
+    textbuf_free(&binary);
+    textbuf_free(&hex);
+}
+
+/* Generate EduMIPS64 assembly and binary code */
+void tac_generate_assembly(TACProgram *prog) {
+    MIPSCode *code = tac_assemble(prog);
+    tac_render_assembly(code);
+    mips_code_free(code);
 }
 //free function
 void tac_free(TACProgram *prog) {
     TACInstr *curr = prog->head;
     while (curr) {
         TACInstr *next = curr->next;
-        if (curr->result.type == OPERAND_VAR) free(curr->result.val.varName);
-        if (curr->result.type == OPERAND_STR) free(curr->result.val.strVal);
-        if (curr->arg1.type == OPERAND_VAR) free(curr->arg1.val.varName);
-        if (curr->arg1.type == OPERAND_STR) free(curr->arg1.val.strVal);
-        if (curr->arg2.type == OPERAND_VAR) free(curr->arg2.val.varName);
-        if (curr->arg2.type == OPERAND_STR) free(curr->arg2.val.strVal);
-        free(curr);
+        free_instr(curr);
         curr = next;
     }
     free(prog);
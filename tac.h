@@ -2,6 +2,8 @@
 #define TAC_H
 
 #include "ast.h"
+#include "mips.h"
+#include "textbuf.h"
 
 typedef enum {
     TAC_ADD,
@@ -27,14 +29,30 @@ typedef enum {
 typedef struct {
     OperandType type;
     int isCharType;
+    FlexType flexType;  /* flex VAR: tag proven before a read / after a write */
     union {
         int tempNum;
-        char *varName;
+        Atom varName;       /* interned, shared with the AST and symtab */
         int intVal;
         char *strVal;
     } val;
 } TACOperand;
 
+/* Specialized forms tac_execute rewrites the program's instructions into
+   before its first run. QUICK_NONE means the generic path. */
+typedef enum {
+    QUICK_NONE,
+    QUICK_ADD,
+    QUICK_SUB,
+    QUICK_MUL,
+    QUICK_DIV,
+    QUICK_MOVE,         // LOAD_INT / COPY
+    QUICK_PRINT_NUM,
+    QUICK_PRINT_CHR,
+    QUICK_PRINT_STR,
+    QUICK_SKIP,         // nothing to do at run time
+} TACQuick;
+
 typedef struct TACInstr {
     TACOp op;
     TACOperand result;
@@ -43,6 +61,9 @@ typedef struct TACInstr {
     int line;
     int inShwContext;
     int resultIsChar;
+    int isStaticInit;   /* folded into the .data section by the backend */
+    TACQuick quick;
+    Symbol *quickSym[3];    /* result, arg1, arg2 resolved by quickening */
     struct TACInstr *next;
 } TACInstr;
 
@@ -50,23 +71,35 @@ typedef struct {
     TACInstr *head;
     TACInstr *tail;
     int tempCount;
+    TACInstr *fault;    /* instruction that raised the last runtime error */
+    SymbolTable *symbols;   /* the compilation's variables, not owned */
+    int quiet;          /* runtime errors are left in fault, not reported */
+    int quickened;      /* every instruction has been through quicken */
 } TACProgram;
 
 /* Function declarations */
-TACProgram *tac_create_program(void);
+TACProgram *tac_create_program(SymbolTable *symbols);
 TACOperand tac_operand_none(void);
 TACOperand tac_operand_temp(int num);
-TACOperand tac_operand_var(const char *name);
+TACOperand tac_operand_var(Atom name);
 TACOperand tac_operand_int(int val);
 TACOperand tac_operand_str(const char *val);
 int tac_new_temp(TACProgram *prog);
 TACInstr *tac_emit(TACProgram *prog, TACOp op, TACOperand res, TACOperand a1, TACOperand a2, int line);
 TACOperand tac_gen_expr(TACProgram *prog, ASTNode *node);
 void tac_gen_stmt(TACProgram *prog, ASTNode *node);
-TACProgram *tac_generate(ASTNode *ast);
+TACProgram *tac_generate(ASTNode *ast, SymbolTable *symbols);
 void tac_print(TACProgram *prog);
 int tac_execute(TACProgram *prog);
+/* tac_execute without reporting runtime errors; prog->fault names the
+   failing instruction */
+int tac_evaluate(TACProgram *prog);
 void tac_generate_assembly(TACProgram *prog);
+MIPSCode *tac_assemble(TACProgram *prog);
+void tac_render_assembly(MIPSCode *code);
+/* The three listings tac_render_assembly prints, appended to the buffers
+   without the surrounding quotes; pass NULL for any that are not wanted */
+void tac_render_text(MIPSCode *code, TextBuf *assembly, TextBuf *binary, TextBuf *hex);
 void tac_free(TACProgram *prog);
 const char *tac_op_to_string(TACOp op);
 
@@ -0,0 +1,44 @@
+#ifndef TARGET_H
+#define TARGET_H
+
+#include "tac.h"
+#include "symbol_table.h"
+
+/* Machine description used by tac_lower. The allocator and liveness code
+   in tac.c hand out register indices 0..numRegs-1; the hooks turn each
+   operation into target code. */
+
+#define TARGET_MAX_REGS 8
+
+typedef enum {
+    PRINT_AS_NUMBER,
+    PRINT_AS_CHAR,
+} PrintKind;
+
+typedef struct {
+    const char *name;
+    int numRegs;
+
+    void (*load_var)(void *ctx, int reg, Symbol *s);
+    /* Store for a TAC result; charStore is the operand's isCharType flag.
+       Returns 1 when the register still equals what a load of s would give. */
+    int (*store_var)(void *ctx, int reg, Symbol *s, int charStore);
+    void (*load_imm)(void *ctx, int reg, int imm);
+    void (*move)(void *ctx, int dst, int src);
+    void (*arith)(void *ctx, TACOp op, int dst, int left, int right, int line);
+    /* Temps that lose their register are written to a per-temp slot and
+       read back from it when next used */
+    void (*spill)(void *ctx, int reg, int tempNum);
+    void (*reload)(void *ctx, int reg, int tempNum);
+
+    /* Console output; targets without it leave shw statements out */
+    void (*print_reg)(void *ctx, int reg, PrintKind kind);
+    void (*print_imm)(void *ctx, int imm, int isChar);
+    void (*print_str)(void *ctx, const char *str);
+} TargetDesc;
+
+/* Lower a program through a target. Constant first writes are folded into
+   the symbols' initial values (hasInitValue) and are not emitted. */
+void tac_lower(TACProgram *prog, const TargetDesc *target, void *ctx);
+
+#endif
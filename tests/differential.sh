@@ -0,0 +1,91 @@
+#!/bin/sh
+# Differential test: run every program in tests/programs through each
+# engine and compare it with tac_execute, the reference interpreter.
+#
+#   sh tests/differential.sh [path/to/scanner.exe]
+#
+# Prints a FAIL line per disagreement and exits non-zero if there was any.
+bin=${1:-./scanner.exe}
+if [ ! -x "$bin" ]; then
+    echo "usage: $0 [path/to/scanner.exe]" >&2
+    exit 2
+fi
+dir=$(dirname "$0")/programs
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+programs=0
+checks=0
+failures=0
+noCC=
+noAS=
+
+# Everything the compiler prints, without the run time, which varies
+run() {
+    "$bin" "$@" 2>&1 | grep -av "Execution Time"
+}
+
+fail() {
+    failures=$((failures + 1))
+    echo "FAIL $1 $2"
+}
+
+for f in "$dir"/*.cl; do
+    programs=$((programs + 1))
+    run < "$f" > "$tmp/ref"
+
+    # The VM and the JIT stand in for tac_execute on the console run, so
+    # the whole output has to be the same
+    for engine in --vm --jit; do
+        checks=$((checks + 1))
+        run $engine < "$f" > "$tmp/out"
+        cmp -s "$tmp/ref" "$tmp/out" || fail "$engine" "$f"
+    done
+
+    # The C backend builds the program and checks its output against
+    # tac_execute itself, complaining on stderr when they disagree
+    if [ -z "$noCC" ]; then
+        "$bin" --emit-c "$tmp/prog.c" < "$f" 2>&1 >/dev/null | grep -a -e "C backend:" -e "No C compiler" > "$tmp/err"
+        if grep -q "No C compiler" "$tmp/err"; then
+            noCC=1
+            echo "SKIP --emit-c: no C compiler (set \$CC)"
+        else
+            checks=$((checks + 1))
+            [ -s "$tmp/err" ] && fail --emit-c "$f"
+        fi
+    fi
+
+    # So does the x86-64 backend, which reports on stdout
+    if [ -z "$noAS" ]; then
+        "$bin" --x86 "$tmp/prog.x86.s" < "$f" 2>&1 | grep -a -e "^output:" -e "x86-64 backend:" -e "No assembler" > "$tmp/err"
+        if grep -q "No assembler" "$tmp/err"; then
+            noAS=1
+            echo "SKIP --x86: no assembler/linker driver (set \$CC)"
+        elif [ -s "$tmp/err" ]; then
+            checks=$((checks + 1))
+            grep -q -v "matches tac_execute" "$tmp/err" && fail --x86 "$f"
+        fi
+    fi
+
+    # The RV64 simulator runs the lowered program and compares the final
+    # variables with what tac_execute left; a program that stops at a
+    # runtime error is never lowered
+    "$bin" --rv64 "$tmp/prog.s" < "$f" 2>/dev/null | grep -a "^result:" > "$tmp/result"
+    if [ -s "$tmp/result" ]; then
+        checks=$((checks + 1))
+        grep -q -e "fault" -e "differ" "$tmp/result" && fail --rv64 "$f"
+    fi
+
+    # So does the MIPS64 simulator, with and without the passes that
+    # rewrite the encoded program
+    for passes in "" "--no-peephole --no-sched"; do
+        "$bin" --sim $passes < "$f" 2>/dev/null | grep -a "^result:" > "$tmp/result"
+        if [ -s "$tmp/result" ]; then
+            checks=$((checks + 1))
+            grep -q -e "fault" -e "differ" "$tmp/result" && fail "--sim $passes" "$f"
+        fi
+    done
+done
+
+echo "$programs programs, $checks checks, $failures failures"
+[ "$failures" -eq 0 ]
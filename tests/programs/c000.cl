@@ -0,0 +1,17 @@
+chr v0 : (35 * 52) * 116 / 64 - 60 + 32
+chr v1 : ('a' + v0 * 41)
+flex v2 : v1
+nmbr v3 : v1
+flex v4 : v1 / v2 * 18
+nmbr v5
+shw "s3".87.v3.v5.1
+v0 : (v5 - 65 * 36)
+v4 +: 10
+v2 : (v1 + 'a' / ('b' + v5))
+v4 +: v5 / 'a' - 20 - v4
+v5 : (v5 * v5) / v3 * v2 * (0 / v1 - v3)
+v3 +: (v5 + v3 / (v3 / v3) + 'c' + 'A')
+v0 : 30 + ((v3 - -15) * ('c' + 68))
+v1 : (97 / 75 + v2) * v2
+v4 : v1
+shw v4."s1".v1
@@ -0,0 +1,16 @@
+flex v0
+nmbr v1 : v0 + v0 / '9' / -18 + (88 / 115)
+nmbr v2 : (v1 + v1 + v0 / v1 / ((v0 / v1) + 113 + 'z'))
+flex v3
+v3 -: v0
+shw v2.v2.v0.v1
+v1 /: ((v2 / v0 - v0 * 'c') / 45)
+shw ((v1 * v1))
+shw v2.v0."s6"
+v1 : v1
+shw "s6"
+v1 : (v0 / v2 - (v1 * 'y')) / (13 / v0 * 'Z')
+shw "s1"."s6".v3."s6"
+v3 : 82
+shw "s5".v3
+v0 : (((v0 - v1) / (109 * 'z')) * 'Z')
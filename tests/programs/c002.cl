@@ -0,0 +1,14 @@
+nmbr v0 : -11 * '0' / '0' - 'z' + 61
+nmbr v1 : v0
+nmbr v2 : (70 * v1) / 43 / v1 - v1 / v0 / ('9' - v1)
+v2 /: v2
+v2 : (('b' - v2) * 14 + 'x' + 'a')
+v0 : v0 + 'c' - 113 + (43 + v0)
+shw v1.v2.v1
+shw v0."s5"
+shw v0.v1.v1."s5"
+v2 : (v0 * v1 - ('x' + -2) + (v2 * v1 - v2))
+v0 : v2
+v1 /: 'x'
+shw v2.v1.'Z'.v2
+shw v2.(5)."s3".v1."s7"
@@ -0,0 +1,11 @@
+flex v0 : 39 / 100 + 18 / 18 / 'a' + 48
+chr v1 : (('b' - v0) / 57 / v0 / '9' + 21 - v0)
+flex v2 : v1
+nmbr v3 : 'a'
+v3 : (51 * v0) + -12 + 66 - v1 * 'A' / 6
+v1 : (((60 + v1) * v2 / 51) / 74)
+v2 -: ((v0 * (v1 - 48)) * v2 + v1 - v1)
+v1 : '9'
+v2 : 'b'
+shw "s4".v2.v3."s9".v3
+v0 : ((v2 - '9' - 'b') / (-17 / v0) - 114)
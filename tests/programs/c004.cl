@@ -0,0 +1,15 @@
+chr v0 : (120 - (50 + -14 + 'y'))
+flex v1
+chr v2 : v1 - v1 / v0 * v1 / v1
+flex v3 : 'Z' - v2
+v2 : v1
+v1 : 'y'
+v0 *: ((v1 * ('9' / -1)) * 20 - v0)
+shw "s3".v1."s0"."s2".v1
+v3 -: v2
+shw v1.v3
+v3 : v2 / v1 / v2
+shw v0
+v1 : 60
+shw v3.('c' - ('Z' + 83 * v1))."s6"
+shw "s9".v3
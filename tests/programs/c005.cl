@@ -0,0 +1,19 @@
+chr v0 : (100 - 'A' - (84 + 79) + 12)
+nmbr v1 : 'c'
+chr v2 : 'x'
+nmbr v3
+flex v4 : v1 / (v0 * v2 * 'Z')
+nmbr v5 : (v3 + v4 * 30 - v1 + v4)
+chr v6 : ((v4 + 17) + v2 + v0 * v5)
+v3 +: 44
+v3 -: 'a'
+shw "s9".7
+v2 : 'y'
+v4 : (v1 * v6 * 'c' / v2 / -12 * 73 + v5 / 67)
+v2 *: (v5 / v6 * 'Z' - 'z')
+shw "s1".v5.v4.v4
+v3 *: 26 + -10 * v2 - (v0 / v2)
+v2 : v2
+shw v4
+v0 : v2 * (v6 - 117) * 102
+v2 +: '9' - ('Z' / v5) * v3 * v2 * v0
@@ -0,0 +1,11 @@
+nmbr v0 : 100
+flex v1 : ('0' / 29 - 2 * 'z') * 54 + v0 * 72
+nmbr v2 : (v0 * v0) - 77 * v0 + v1 + (v1 * v1)
+chr v3 : 112 / v1 / v2 + v1 + v1
+chr v4 : 48 / 102 * v3 / v1 * (v3 * 'y' - 95)
+flex v5 : ('c' + '9') / v1 / v2 * v0
+nmbr v6 : v5
+v5 -: 47 + 15 + 'x' / (v2 / v4)
+v0 : 'y'
+v3 : v6 * (66 + v0 - 67 - 'c')
+v3 +: v0
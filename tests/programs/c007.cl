@@ -0,0 +1,9 @@
+nmbr v0 : 'b'
+chr v1 : v0 - -5
+nmbr v2
+flex v3 : v2 / (26 + v2 * 32 + v2)
+chr v4 : v1
+v4 /: ('b' / ('A' - v0 - (v2 * 96)))
+shw v2
+v3 *: (v1 * (13 / v3 / v3))
+v4 : v2
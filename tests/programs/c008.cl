@@ -0,0 +1,15 @@
+chr v0
+nmbr v1 : v0
+chr v2 : v0 / 48 - (46 / v0) / v0
+chr v3
+shw "s0".v1."s9".v3."s5"
+shw "s9"."s5"
+shw v2."s8"."s1".'0'."s3"
+shw "s0".v3."s6"
+v3 : 'a'
+v1 : v3
+v1 : (84 - v0 + (v3 * -4))
+shw v2."s7"."s9"
+v1 : 'Z'
+v1 : (95 + 92 - '9') / v0 - -15
+v1 -: v1
@@ -0,0 +1,9 @@
+flex v0 : 'a'
+chr v1 : 'a' + (('A' / v0) - '9')
+flex v2
+chr v3 : 2
+chr v4
+chr v5 : 'Z' + v1 + ('a' + v4) - 'c'
+v4 /: (17 / -10) - ((v5 + v1) - '0' * 2)
+v1 : (v1 * 'y' * 6) + (-4 - v1) / ('0' * v5)
+v1 : v0
@@ -0,0 +1,18 @@
+nmbr v0 : 105 - 43 / 15 * 77 - 57
+nmbr v1 : ((v0 / '0') - (v0 / 63 * v0))
+chr v2
+flex v3 : 75 + (4 - ('A' - 'Z'))
+nmbr v4
+chr v5 : 24
+nmbr v6 : v0
+shw "s4".v4."s7"
+shw (v3 / ((v3 * 92) - ('Z' + v0))).v6.v4.(97).v5
+v4 -: ((v0 / 'A' - v0) * v3 * v4 + v4 * v1)
+shw v3.v4."s9".v5.v0
+v4 : (v0 - v3 * v1) / (v5 * v5) / 1 / 73
+shw "s4"."s5".v0.v4.v4
+v1 : -7
+v5 : v4
+v3 +: ('9' * v4) - 23 * 10 * (v3 * 69) + (95 / 24)
+shw v0.v1."s2".v1
+v6 *: ('a' - 72 + 'y') + 105 / v6
@@ -0,0 +1,15 @@
+flex v0
+chr v1 : v0 - v0
+flex v2 : ((v0 + '9') - 30 / v1 / ((60 + 111) * 82))
+nmbr v3
+flex v4 : 'Z'
+chr v5
+v4 : (v0 * -18 + 25)
+v5 -: (v1 / '9')
+shw v4.v0
+v1 : v4
+v2 : 42 + v4
+shw "s6"."s2".v1.(30).v3
+shw v0
+v4 : ('9' / 'b' - v3 - ('a' * v1))
+v4 : (-16 - v2 / (-1 + v5)) + v2
@@ -0,0 +1,9 @@
+chr v0 : (38 / 17 * ('a' * 31) - 2)
+nmbr v1
+flex v2 : 'Z'
+nmbr v3 : 109 + 'A' - v1 / v2 * ('A' * 9) * v2
+nmbr v4 : (((v0 + 36) - v3 + v0) + v3)
+nmbr v5 : -19 - 108 * 72
+shw v1.v4.v5
+v5 : '0' + (34 / 113) - v1 * v3 - 86 * v0
+v2 : ('a' - 'A' + 70 / v2 / (80 + (v2 + v2)))
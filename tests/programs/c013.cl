@@ -0,0 +1,9 @@
+chr v0 : (116 - 'y') - -17 - ('A' * 'y') + '0'
+chr v1
+flex v2 : 'y'
+flex v3 : v2 * v1 / '9' / v0 - 98 - 'a' / v1
+nmbr v4 : 'z' * ('9' - v3) * v1 * v0 + v0
+v1 *: v2
+v0 /: (v3 + v0 / (46 - v1))
+v2 : ((v0 + -19 * v4) * v1)
+v2 : 54 - v2
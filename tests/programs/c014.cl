@@ -0,0 +1,15 @@
+flex v0 : -2 - ((10 / 60) * '0')
+flex v1 : v0
+nmbr v2 : 'A'
+shw "s1".v2.v0.v2."s7"
+v1 *: 'y' + v2
+shw v2
+v1 : (v1 + v2 / v2) / (v2 / 100) / v2
+v0 : v0
+v1 *: (v0 + v2)
+v2 : 74 * 'c'
+shw v1.v1.v2."s6"
+v1 +: v0
+v0 : v0
+v1 +: (v0 / 'c') / 'z' - '9' * v1
+v0 : (v0 + 'c') + (v1 * 'c') + (v1 + v2 / -19 - 'b')
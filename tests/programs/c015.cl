@@ -0,0 +1,15 @@
+nmbr v0 : 'x'
+nmbr v1 : (v0 * v0 - v0)
+flex v2 : v1
+chr v3 : ((v0 / v0) * v1 + v0) * 55
+v2 : v1
+shw ((79 + v2 * (v3 * 'y') + v0 / v3 / 45)).v3.v0.v2
+v2 +: (69 / v2 + v2)
+v1 : v1
+v0 /: 'c'
+v2 : 120
+v0 /: 'Z' + (v1 * '0' - (66 / v3))
+v1 : '9'
+shw v1
+shw v1.v0.v1.v1
+v1 : v3 - v3 / 'a' / (-20 - v2 / v3)
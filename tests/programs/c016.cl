@@ -0,0 +1,14 @@
+chr v0 : ('y' / 55)
+chr v1 : v0 * v0
+flex v2 : v1
+chr v3 : ((52 * 'a' - v1) * v1 + v1 - 'b')
+nmbr v4 : (v3 * (v0 + 118) / 9)
+v2 : 41
+v0 +: ((v0 / v1 + 'A') * v0)
+v1 /: 'A'
+v1 : (-15 - v4) - v2 * 33
+v3 +: (v3 * v4 + v2) + v0
+v3 : 'a' - 'x' + 118
+shw "s9".v4.((v2 - v1 + 'b' - 3))."s1".v1
+shw v0
+shw "s9".v1.v3.v0
@@ -0,0 +1,15 @@
+chr v0
+chr v1 : v0 * v0 / (v0 / v0)
+flex v2 : v1 + ('z' / v1 - v1 * v0)
+nmbr v3 : (v2 * v1 - v2)
+nmbr v4 : ((59 + v3) * v3 - v2 + ('z' * 'a') + 'A' * v0)
+chr v5 : ((v3 / v3) / v2 - 'z' + '9' / 'x')
+nmbr v6 : ((25 + 'c' / v3) + v3)
+v2 : -17
+v3 : v6 + 36 + v0 * v1
+v2 : v6
+shw 'b'.v6.v5.v2
+v0 : v1
+shw v2."s6".v1
+v1 -: (((19 / 16) + (v6 * 'A')) - v4 / 108 - v2)
+v2 /: v4
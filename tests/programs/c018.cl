@@ -0,0 +1,12 @@
+nmbr v0 : 105
+flex v1 : (63 - 'x' - v0 / 106)
+chr v2 : v1
+flex v3 : v2 * v2 * v2 - 'c' * 46
+shw v3
+v0 : v2
+v3 : (v3 + v3) - v2 * 57 + (v1 / 89) + v0 / 45
+v3 -: 'c'
+shw "s1".114."s3"."s1"
+v1 : v2
+v2 : v2
+shw (v0 + v1 / v2 / 'y').v1.v3.v0
@@ -0,0 +1,10 @@
+flex v0 : 115
+chr v1 : v0 + ((31 + 'x') * 'A' + v0)
+chr v2 : v0 / v0 / 6 - 'Z' / v0 / v1
+shw v1.v1.v1
+shw "s6"
+v0 : -1 + v1 / v2 + v1 - -10
+shw v0."s4".v0
+v1 : (115 * v2 * 'x' + v1) - (v1 + v1 * 'z')
+v1 +: v2 + v0 + v2 - 7
+v0 -: ((v1 + 'c') - ((6 * 46) / (57 - v1)))
@@ -0,0 +1,8 @@
+chr v0 : (-1 - 95 + 65)
+nmbr v1 : (((v0 + v0) - -15) / '9')
+nmbr v2 : 94 * v1 / 'b' * v0 / 'a'
+nmbr v3 : (('0' / -7 * '0') + 3)
+shw v1
+v0 : '0'
+shw v0.v1
+v1 : v3
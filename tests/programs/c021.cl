@@ -0,0 +1,7 @@
+chr v0 : ((40 - -17) / 39 + 'a' / '0' + 9 / 2 + -15)
+chr v1 : (v0 - v0) / '0' / v0 / 'c'
+chr v2 : ((v0 + 65) * v0 * v0) - '9' - v1 - 'x' - v0
+nmbr v3
+shw v1
+v2 : v3 / v2 - (v2 / v0) / 47
+shw v1."s1".v1
@@ -0,0 +1,10 @@
+nmbr v0 : (-8 + 25 * -8 / -15) - '9'
+flex v1 : ('y' * v0 - 27) + ((v0 * v0) / v0 + 115)
+nmbr v2 : (v0 / v1) - (v0 + 5) - 'Z' - v0
+flex v3 : ((('9' + v0) * v0 + 91) + v2)
+v3 +: v0
+v1 /: 114
+shw v0."s7"
+v0 /: (v1 + 'z') - v0 * 35
+shw v1.v2.v3.v0
+v2 : 'y'
@@ -0,0 +1,11 @@
+nmbr v0 : 71
+nmbr v1 : v0
+nmbr v2 : (v0 + 24 / 74 * 'y') / v1
+chr v3 : 116
+chr v4 : v2 + v2 * v3 * v0
+v1 : (v3 + v1 - 'a' - v3) + v3 + v3 / v4
+v1 *: v0
+v2 : ('x' / v4 / -7) / (v0 / v4) * (49 / v3)
+v0 : v3
+shw v4.v1.v2
+v0 : v3
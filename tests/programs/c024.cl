@@ -0,0 +1,16 @@
+flex v0 : 18 - (9 + 23 * 107 / 'b')
+flex v1 : v0
+flex v2
+nmbr v3 : v2 + (50 * 'b' / v0 - 13)
+nmbr v4 : 46
+chr v5 : (v0 / v4 * ('x' * 'a'))
+shw "s5"
+shw v4.v3.('9' - (87 + v3 + v2)).v0.v0
+v1 : (v0 - '0' - v1 * v4 - v2 / v5)
+shw v1.v1
+v2 : 'x'
+v1 -: '9'
+v1 *: ('9' - ((19 / 'c') * 'a'))
+shw "s5"."s4".'x'.v4.v1
+v1 : v3 / (v3 / v0) / 57
+v5 : ((113 + '0') - v4 * 'y') - ('b' + v0) - v4 / 69
@@ -0,0 +1,13 @@
+nmbr v0 : 'y' / 4
+nmbr v1 : v0 - v0 * (v0 * -2) - v0 + 'x' - v0 / 103
+nmbr v2 : ('A' / 'c' * v0 / (v1 * v1 - v1 / v0))
+nmbr v3 : (v2 * '9' - 'a') - (v2 * v0 - v0)
+flex v4 : (-16 - v1)
+flex v5 : v4
+shw "s0".(v5 * (v0 - v4)).v1
+v0 : 13
+shw "s2".v5.v4.v2.(107 + 'b')
+v0 : (v2 - -5 * '0' - v3)
+v4 : (v3 * 31) - (v2 / v1) - 39
+v3 : (v0 - (v3 + v4) / v3)
+v0 : v3
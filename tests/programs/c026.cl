@@ -0,0 +1,13 @@
+flex v0 : ('Z' + 108)
+chr v1
+flex v2 : (v1 - v0 / v1 + (('A' * v0) + 'A' - '9'))
+flex v3 : 'z' + v0 * v0 + 0 + '9'
+v3 : (('9' + 'Z') - -16 + 'c')
+v0 : 'a'
+shw "s4".v2.v3."s1".(v3)
+v2 : v2 + v3 + ('b' - v0)
+v1 : v0 + v0 - v3
+v2 : 47 / v0 * v2 * v1 * 99 * v0 + ('9' + -2)
+v2 : v1
+shw "s1".v3.v2.(v1).v1
+shw v3."s7"."s7".v3."s1"
@@ -0,0 +1,17 @@
+flex v0 : 45
+flex v1 : ('Z' / (-7 / 69) + v0 / 38)
+chr v2 : 47 + (v0 + v0) + ((v1 / v1) * v0 + v1)
+chr v3 : v2
+flex v4 : v0
+flex v5 : 'Z'
+v5 +: v1
+v4 : (v2 + 28) / 'z' + ('c' + v1)
+shw v2."s7"
+v4 : (65 - 'a' - 0) / v0
+v1 : v5
+shw v3.v1."s8"."s8"
+v3 *: v3
+shw v4
+v2 : ((v5 + (v4 - '0')) / ('z' / 118) * 'b')
+v2 /: 36
+shw v1."s5"."s4".v3.v3
@@ -0,0 +1,8 @@
+flex v0 : 86 - 21
+nmbr v1 : v0
+nmbr v2 : '0' - v0 / 'y' * v1
+v0 : 104
+v1 : (v2 - 87 / v1)
+shw v0
+shw v1.v0
+shw ('a').v2.v1."s8"
@@ -0,0 +1,16 @@
+nmbr v0 : 'A' * 37 + 'z' + '0'
+nmbr v1 : v0 / (v0 / 100) - 'y' * v0 + (v0 - v0)
+flex v2 : v1 + 'c' + v0 - ('0' * (v0 + v1))
+chr v3 : v0
+nmbr v4 : 116 - v0
+flex v5 : -6
+chr v6 : 91 - v0
+v1 : v5
+v0 *: v0
+v1 : 66 / v5
+v5 /: v2 + v6
+shw v2."s5"."s3"
+v5 : v2
+v2 : v1
+shw v0
+shw v1
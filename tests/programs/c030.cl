@@ -0,0 +1,16 @@
+chr v0 : ('Z' - 113 + 20 - -3 * 43 / 51 / 8)
+chr v1
+chr v2 : 10
+nmbr v3 : (100 * v0 * v2 / v1 / v1)
+nmbr v4
+flex v5 : (v3 * 77) / v4 / v1 - 10
+flex v6 : ((v4 + v2) + v3 - v5 * 101)
+shw "s4".v6.(v6).v0
+v6 : (v3 - v5)
+v1 : v0
+shw "s5".v2."s5"."s3"."s9"
+v1 -: (v1 - v2)
+shw "s6".v2.((95 + 14 - v4) + (v5 * (84 / v5)))
+v2 : v2 * v4 / 'b'
+v0 : 88 * v4 / 'c' * 80 / 112
+v1 : v5
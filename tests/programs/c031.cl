@@ -0,0 +1,9 @@
+chr v0 : (39 + -5 - 94)
+flex v1 : 'A'
+chr v2 : v0
+shw v0.v0."s6"."s8".v1
+shw v0.v1.v1
+v1 *: ((v0 * v2) * (v1 / 30)) + v0
+v0 : 18 - 111 / v1 + ('a' / v1) + v1
+v2 : 96 * 111 - (v0 / 98) + v2
+shw v0."s1".v0."s6"
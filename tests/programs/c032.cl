@@ -0,0 +1,10 @@
+nmbr v0 : -6 + -20 / 12 - (65 - 114) - -8
+nmbr v1 : 'c'
+flex v2
+v2 +: v0 * ((-18 + 'Z') * (v1 + v1))
+v2 *: (v1 - 74) - 69 - 15 / 60 - 86 + ('A' + v1)
+shw "s5".v0.v0.(((v0 + 'c') * (-14 / v1)) - 10).-1
+v0 : 'a' + 109 * v2 - (v2 * v0)
+v2 : ((v1 * -11) - 34 * v2) - ('y' / 'x')
+v0 : (v0 + v2 + 106 + 'y' + v1 * 4 - -13)
+v1 *: 94
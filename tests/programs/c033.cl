@@ -0,0 +1,15 @@
+nmbr v0 : ('0' * 52 - 112 * -7 * (-6 - 52 * 11 + 42))
+flex v1 : (v0 + v0) + v0 * 79 - v0 * v0 / v0 - 21
+flex v2 : (((v1 / v1) / v0 - 'z') * 'z' / 'z' * 'a' + v0)
+nmbr v3 : 'b'
+nmbr v4
+nmbr v5 : 'A' * v1
+nmbr v6 : 8
+v6 : (('Z' + '9') + (v3 * v3) / v4 - '0')
+shw "s2"
+v2 : 'a' - v0 * v3 / v1
+v6 : ((-1 / 'Z') - 'A' - 40 * 76 * ('z' / 20))
+v2 : ((113 + v1 - 81 + '9') - v4 * v4 / v0 - v6)
+v2 : v1 - v4
+v0 : v1
+v2 *: (32 - v5) * v0 * v4 * ((2 / v2) + (79 * 'y'))
@@ -0,0 +1,17 @@
+chr v0 : 58 + 110 * -20 + (-5 * 'c' + (34 * 117))
+flex v1 : '9'
+flex v2 : (83 - 67 * (v1 / v1)) * v1
+flex v3 : (('9' * 'Z') * (v0 * 86)) - '9'
+flex v4 : v2
+nmbr v5
+flex v6 : 19
+shw v3.((119 / 'a' * 23 / v3 - v3 / 'y' - 10)).v2
+shw v6
+v1 *: (56 * (v1 + v3) * v6)
+v4 : '9'
+v6 : (((v4 + 'A') * 'Z') + 36 - 'y')
+v2 /: v1 * v5 * v6 * ('y' - -4 - '9')
+v2 : (82 + 8 / 'b') * -13 + v6 * v1
+v4 -: v5 * 56
+shw (v3 + -16 / v3 + '9' - (106 + 39 * 'b'))."s8".v3.v1."s8"
+shw "s3".v1.v3.v0.v0
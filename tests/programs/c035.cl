@@ -0,0 +1,11 @@
+chr v0 : '9' - 50
+flex v1
+nmbr v2 : (v0 + v0)
+chr v3 : 102
+chr v4 : v1
+flex v5 : -11 / 96
+nmbr v6
+shw "s6".v1.v5."s9"
+shw (-14 + '9').v4.(('9' / v4) / v5 * v6 * (v4 / 6) / (117 * v3))."s6".('b' + (119 - 'x' + v5))
+v3 /: (-20 - 'z' + (v6 * v2)) - (v6 * ('A' + v2))
+shw v2
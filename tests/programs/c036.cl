@@ -0,0 +1,12 @@
+nmbr v0
+chr v1
+nmbr v2 : v1
+chr v3 : 'x' / (v2 + 114) / 'Z' - 'A'
+chr v4
+v1 /: (v1 * v1 + 69 + v4 * 33)
+shw (((v2 * -5) * (v0 + v3)) / v0 - ('c' - v2)).v0
+v3 : v2
+v2 : v3
+v3 : v4 + (-1 - 112) * 17
+v3 : (-4 + (v3 / 40) - v3)
+v0 : (v0 - 62) + ('Z' - 'A') / v1
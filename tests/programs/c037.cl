@@ -0,0 +1,10 @@
+nmbr v0
+flex v1
+flex v2 : 52 / 'A' + v0 + v1 * (('9' + v1) * v1)
+nmbr v3 : (110 * 57 - 103) + 92
+flex v4 : v3
+flex v5 : ('y' - v4) + v1 - v4 + (v1 + v2) + v1
+flex v6 : v4
+shw v6."s0"
+shw ((71 - v0 * '9' * v2 + v1)).v4."s2"."s5".v1
+v1 : 'b' + v0
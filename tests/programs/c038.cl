@@ -0,0 +1,11 @@
+chr v0 : 98
+chr v1 : (58 * (115 / (v0 / v0)))
+nmbr v2
+nmbr v3 : (v1 * 21 / v2) - 'x' + v2 + '9'
+nmbr v4 : v0
+nmbr v5 : v0
+v4 : (v2 * (33 / v1 + v1))
+v0 /: ('Z' * v1) + (62 + 23) * '9' + v0 - v3
+v4 : '9' + -9 + v5 * v2
+v3 : 72 / 47 / v1 - 'Z' + 'y'
+v0 : v5
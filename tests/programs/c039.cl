@@ -0,0 +1,15 @@
+chr v0 : -19
+flex v1 : 'b' + v0 + 4 - 97
+flex v2 : -9
+flex v3 : (v1 * v2 / 'y') / ('0' / v0) + v2 / 76
+v0 /: (v3 - '0') - ('9' - v1) - v1
+v0 : (('y' / 12) / v0 + v1)
+v3 : 'x'
+v1 : 94
+v0 : v3 / v0 + 'z' * v0
+v0 *: (v2 + 43) + v2 + v0
+v1 : v0 - (v1 / v1) * v0
+v0 : (('x' / v2 / v0) / v0 * v1 / v3)
+v0 +: v2
+v3 +: ('A' - v2 + v1 - v1 / 117 * v0 + v3)
+shw v3."s0".(-18)."s8".v2
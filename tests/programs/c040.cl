@@ -0,0 +1,10 @@
+flex v0
+nmbr v1 : v0 - v0 - (v0 + v0)
+nmbr v2 : 'z'
+nmbr v3 : v2
+chr v4 : (v0 + 8) - v3
+chr v5 : (v1 - (v3 / v0 - ('Z' - 29)))
+v2 : v1
+v4 : v3
+shw v0.'a'.v0
+v3 : (116 / 118 * v1 * v5)
@@ -0,0 +1,18 @@
+chr v0 : '9'
+flex v1 : '9'
+nmbr v2 : v0 * v0 - -2 + (v0 + 25) - 26
+nmbr v3 : 84
+nmbr v4 : v0 / (v0 * 62) / 7 + 'c'
+nmbr v5 : v3 - 1 / 'y' + v2
+v2 : (v0 + v1)
+v4 : (v5 / 107 - v2 / v5 + 'c')
+shw v4
+shw v1."s6".v0.(((v3 - 39 / v3 * v4) * v3 - v2 + (v4 + v1)))
+v2 : ((v4 - (v4 / 28)) - 92)
+v2 : (((v1 * v2) * v2) + 'z')
+shw "s6"
+shw 'y'
+v2 *: (116 * 21 / 'y' / 52)
+shw "s1".v3.75
+v1 *: (v1 - v4) / v0 / 'b' + 97 / 'a' + v5
+v0 : 2
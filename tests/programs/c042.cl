@@ -0,0 +1,9 @@
+nmbr v0 : 6
+flex v1 : v0 / (v0 / 'a' + v0)
+chr v2 : (v1 / v1 * -3 * v0 * (73 / v1) + 'b')
+v1 : '0'
+v1 : (v1 + 'z' + v2)
+v2 : (((v0 - 8) / -4) / 9 + 117 / v1 * v0)
+v0 +: 118 - 105 + v1 * v2
+v1 : v2 - v2
+v2 : ((v2 * v0) / 38 - -5)
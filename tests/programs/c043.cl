@@ -0,0 +1,6 @@
+chr v0 : 4
+chr v1 : ((('b' + v0) / (109 - v0)) / 'c')
+nmbr v2 : '9'
+v2 : (92 * 'z')
+v1 -: ('z' + (v1 + 1) + ((v2 * v2) - 'b'))
+shw v1
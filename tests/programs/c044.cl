@@ -0,0 +1,16 @@
+flex v0 : -18 * 57 - ((66 * '9') / (60 + 54))
+nmbr v1 : v0
+nmbr v2 : (118 / v1 * (-9 * v0)) / (83 * v1) * 90
+chr v3 : -19
+flex v4 : v2 + v1
+nmbr v5 : ((v3 / v3) * v2 / v1) * v4 + 51 * v1 * -2
+v1 : ((v0 / v3 * v5 / 109) * v5 + v1)
+v4 : (-3 - v4 * (v1 * v0)) * 'c'
+shw (v2).v1.v1.v2
+v3 /: v4
+shw v0.('Z').v2."s6"
+v2 : (v4 / v5)
+shw v0.v0."s3"
+shw (59 / '0' + v0 - v5)
+v4 *: (v0 / 36 + -7 / v4)
+v3 : v1
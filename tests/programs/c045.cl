@@ -0,0 +1,8 @@
+chr v0 : -2
+chr v1 : v0
+flex v2 : (19 + 'A')
+chr v3 : v1
+chr v4 : v2 * v2
+v2 -: (88 + v3)
+v0 /: v0
+v4 *: v0
@@ -0,0 +1,6 @@
+chr v0 : (61 + -7 - '0') - 100 / -1 + (66 + 50)
+flex v1 : (('9' - v0) * v0) - (v0 - 66) - 27
+flex v2
+v2 +: v0
+v1 : (v0 / 59) * (v0 + v1) - v1 * (41 * v2)
+shw v2
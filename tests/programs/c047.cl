@@ -0,0 +1,17 @@
+nmbr v0 : (-10 * (103 + -18 + 113 / 93))
+flex v1 : 30
+nmbr v2 : v1 + ('x' * v0 * 70)
+nmbr v3
+chr v4 : 46 / ((v2 - '0') - v0)
+v3 *: '9' * v2 / v1 - v1 + (v0 + v0 * v4)
+v3 +: (('x' + 76) * v4) - (0 * 67 - v2 / 105)
+shw v4
+v0 *: (v0 * 97 - ('x' + 'y')) / ('9' + 117 + v1 * 3)
+v2 : v2 / -6 + v2 * v2 * 19
+v3 : v1 * (v1 / v4) / (25 / 76 / '9')
+v1 : (v0 / (11 / v0) + 'c' + 'Z')
+v2 /: ('c' - 44 / v0 + v0)
+v2 : (v1 + v3 / 75) + 41
+v1 : (v3 - (v1 * 68 + v4 + v2))
+shw v2.v4.v3.v3.v0
+v2 : 'b'
@@ -0,0 +1,15 @@
+chr v0 : (7 / 36) - (-13 - -4) * ('z' * 41) + (70 * 24)
+flex v1 : v0 + v0 / v0 * (v0 / v0) + ('9' - v0)
+flex v2 : (v0 * v0 + '9' / v0 / 'b' - '9')
+chr v3
+chr v4 : (98 + v0 / 'x' * v2)
+nmbr v5 : (2 + ('b' - v0) + 64 / v2)
+nmbr v6 : v3 * (v4 / 22) * (v4 - v0)
+shw "s0".v1
+v0 : v6 * v1 + 45 * v1 - ('x' * 'c' * '9' - v5)
+v6 : 'Z'
+v5 : 50 / 'z' * 'z'
+shw v3.(v0)
+v6 : 'c'
+v2 : v5
+shw v3."s3".v0
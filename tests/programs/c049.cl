@@ -0,0 +1,13 @@
+chr v0 : 110
+nmbr v1 : (119 * (v0 / v0) * '9' / 85)
+nmbr v2 : 'z' * v1
+shw "s2"."s1".v0.v1.v0
+v1 : v2 / v1 + v1 * 39 + v1
+v0 : v2 + '0' + (98 / '9')
+v0 : 88
+shw v2.v0."s0".v1.v2
+v1 : ('Z' / (v0 - v2)) * 'z'
+v1 : v0
+v0 *: 'y' * ('z' - v0) - 86
+v0 : (66 * ('b' + v1)) - v1
+v0 : v0
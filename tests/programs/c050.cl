@@ -0,0 +1,12 @@
+chr v0 : (1 * ('z' * 28) / (65 + 90) / 91)
+chr v1 : 116 / ('0' + v0 / (v0 * 18))
+chr v2 : (15 - 'z')
+flex v3 : ((80 / v1) * -3 - ('0' + v0 / v0))
+nmbr v4 : (v1 * (v3 + v1) * 65)
+nmbr v5 : 'z' / v0 + v2 * v4 * v2
+v1 : 27
+v5 : v0
+shw 'Z'
+v4 : (109 - v3) * v0 + (v0 + 92)
+v3 : ((v3 + 88 * v5 / '0') + ((v2 + v4) - (v4 / v4)))
+v2 : 'c'
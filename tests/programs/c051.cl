@@ -0,0 +1,9 @@
+flex v0 : '0'
+chr v1
+chr v2 : (v0 * 'a' * 25) * v0
+nmbr v3 : v0 / 'Z' + ('x' / 'z')
+v3 /: -18
+shw v2.'a'.v0.v2
+v3 : v3 + 'y' * v1 - v0 - -1 - 108
+v3 /: 82 * v3 / 64 + v1 + v1 * v2
+v2 : v3 + 'b' - v3 + v0
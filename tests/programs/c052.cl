@@ -0,0 +1,11 @@
+nmbr v0
+flex v1 : v0 / (v0 + v0) * v0
+nmbr v2
+flex v3
+nmbr v4 : (v2 - v3 - 31 / v3) * v1
+v4 : ('x' - 19 / 'x' + v1 - v4 / (v1 + v1))
+shw v0."s2"
+shw v1
+v1 : ((v0 * 'x') + v2) - v0
+shw v2."s6".v4
+v0 /: 109
@@ -0,0 +1,10 @@
+nmbr v0 : 'z' + 46 + 38 * 109
+chr v1 : (v0 + (94 - 102) - 'x')
+flex v2 : v1 * 'x' / v0
+flex v3 : v2 / v2 + v1 + (v2 - v1)
+nmbr v4 : v3
+nmbr v5
+nmbr v6 : (101 * 'z' - 'z') / (90 + 'Z' / (35 / 74))
+v2 +: v3
+shw v0
+shw v6.v0.v3.v1
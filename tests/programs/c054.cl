@@ -0,0 +1,11 @@
+chr v0 : (33 / 120 + 3 / ('y' + 'Z' * 72))
+nmbr v1 : (v0 / 'x') + 67 / 'A' - 'Z' / v0 + '0'
+nmbr v2
+chr v3 : -9 * v1 / v1 * v2 + v1
+shw v2.v0.v0.v1.v1
+v2 : v3
+v0 : 27 + v2
+shw ((v0 - v1 - (v3 / v0)))
+v0 : (('a' * v0 + v2 - v0) - ('c' / '9' - 6 - v3))
+shw v0.v2.v2.'z'.v2
+shw (14)."s1"."s9".v3.(('x' + 91 + ('9' + 41) + -11))
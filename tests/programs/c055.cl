@@ -0,0 +1,6 @@
+nmbr v0 : 'Z' * 61 / 89 + 39
+nmbr v1 : ((v0 / v0) + 'A') + (v0 - 92)
+flex v2 : ('y' + v0 + ((v1 / v0) / -6 - 'z'))
+v2 : v2 / ('x' / v2)
+v2 +: v2 * 'x' * -13 + 'Z'
+shw v0.v1.v1
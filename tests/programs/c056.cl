@@ -0,0 +1,11 @@
+nmbr v0 : ((45 + 'x') + '0' + -13) / 30
+chr v1 : (v0 - v0 * -20 + (101 / 29 + (34 + v0)))
+chr v2 : 3 - v1 * v1 + -6 + v0
+flex v3 : 104
+chr v4 : v1
+flex v5
+flex v6
+shw "s1".v1
+v5 +: 53 - v4 / v5 - '0' / ((110 - v6) / 58)
+v6 : v6 / (v2 / ('A' - 'x'))
+v5 : 36 * (4 / 'c') + v1
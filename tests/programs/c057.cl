@@ -0,0 +1,6 @@
+chr v0 : 102
+chr v1
+chr v2 : v0 * 104 - 15 - v0 + (111 * v1) - v1
+v1 +: ('z' + 15 * 51)
+shw v0.v0
+v0 : v0 - 94 + v0 - v1 / v0 - 'a'
@@ -0,0 +1,18 @@
+nmbr v0 : (70 - 6 / 34 * 76)
+flex v1 : v0
+chr v2 : (v0 + 'a') - 102
+flex v3 : ((v0 - 3 / v0) * v2 / (v0 - v0))
+nmbr v4 : (v2 * v1 - 75 * 35 / (v0 + v3))
+flex v5 : v4
+flex v6 : (v5 / ('b' / (-11 / 'x')))
+v0 /: v2 + 'Z'
+shw v6."s5"
+v1 : v2
+v2 : 32
+v2 : v4 * ('c' * v4 * v1)
+v3 : v6 / (-3 * 'c') / v5 / 8 * (v0 + 'b')
+v3 : '0'
+v2 : (v4 - v1)
+v6 +: v4
+v2 : ((v5 + v2) + 24) * v5
+v3 : (('a' - v6 + v2) * v1)
@@ -0,0 +1,12 @@
+nmbr v0
+chr v1 : (v0 / 66 + '0' + 60)
+nmbr v2 : 2
+chr v3 : (95 + v2) - 13 / 'a' + (v2 * v2) / v1 - v2
+shw v0."s7".(116 / 5 + v0)
+v1 : 7
+shw v2."s1".((87 + v1))."s4"
+v1 : 'b'
+v2 +: v0 - (-18 - v1 - 26)
+shw 113.v0.v2
+shw "s5".v1.v1
+v0 : 100 / (v2 + 92 + v2)
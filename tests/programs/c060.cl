@@ -0,0 +1,11 @@
+chr v0 : 'Z'
+chr v1
+nmbr v2 : (v0 - 18 - (7 + 'c'))
+nmbr v3 : v2
+chr v4
+shw v0.v3.v0.v4.v0
+v3 : v2 - 'b' / (v2 / 'c') / (v0 + v0 + 'c' - v3)
+v0 : (101 - (v4 * v1 + 'a'))
+shw (43)."s8".v0
+v1 -: ((v2 * v3 / v4) / (v0 / v4 - 102))
+shw "s2".v1."s7"
@@ -0,0 +1,15 @@
+nmbr v0 : 'a' * 22 * 108
+chr v1 : v0 * 25 * v0 / v0 - v0
+nmbr v2 : 63 / v1
+nmbr v3 : ((v1 / 75 * 'b' / 'x') + v2 / (v1 * 'c'))
+nmbr v4 : 19
+nmbr v5 : v0
+v1 : (('z' - 104) + -10) / v2
+shw (v2).v4.v1
+v2 -: 9 - 'c'
+v3 : 72
+v3 : v5 * ((v1 + 112) * (v2 + v2))
+v2 -: ((v2 * 93 + (v1 - v0)) * '9')
+shw v3."s1"
+v2 : v0
+v0 : (v5 - 96 - '9' - 'a')
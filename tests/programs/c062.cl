@@ -0,0 +1,15 @@
+nmbr v0 : 23 / 23 - 112 + 67
+flex v1 : ((v0 * v0 * 29) + v0 - 'y' / 'z')
+nmbr v2 : ((v0 + 96) + 65 - v0) * v1
+chr v3
+flex v4 : 'Z'
+flex v5 : ('a' - (104 * v0) - v4)
+nmbr v6 : (v4 * v1 / v3 / v3)
+v1 : ((v3 * v4) / '0' + 73 * v0 + ('x' - v3))
+shw "s8"
+shw v0.v1."s1".v2.v3
+shw 'y'.v5
+shw v2
+v4 : v3 - v2
+v1 : 31
+v1 : v6
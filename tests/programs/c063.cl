@@ -0,0 +1,11 @@
+chr v0 : (54 + 58 / 12 - 50) / '9'
+nmbr v1 : ((('a' + '9') / v0 + 80) / v0)
+flex v2 : v1 + ('a' / (v1 - 19))
+chr v3 : v0 - 81
+flex v4 : 102
+nmbr v5 : (('9' + 101) / 103 - v2 + 'A')
+v0 : ((v3 * 'Z') / v4) * v4
+v5 : v3
+v2 : v4 + v2 + v5 / v3
+shw v4.v1.v4.v4
+shw v0.v2.v0
@@ -0,0 +1,13 @@
+nmbr v0 : 31 + (30 - (-19 + 'c'))
+nmbr v1 : v0
+chr v2
+chr v3 : ((v0 - v0) * -13 - 57) * v2
+flex v4 : (v2 / v0) * 'a'
+chr v5
+shw v2
+shw "s8"
+v1 : 'A' - v2 * 23 * v1 + (v0 / 6 * 100)
+v4 : 108 + ((v5 / v2) / 65 - v1)
+v1 +: v1
+v2 *: (v2 * 24 / 22 + 'y')
+shw (v3 * 'c')
@@ -0,0 +1,16 @@
+chr v0 : ('A' * 'b' / -9 - 20 / 73 + 101 - 19)
+chr v1 : v0
+nmbr v2 : ('9' + (62 / v1 / -19))
+chr v3 : v2 - ('9' + 18) / 'y' / v2
+flex v4 : ((v0 * 'y' - (v2 - v3)) + ('x' / v3 * v2))
+nmbr v5 : ('9' + v4 - v2 + v3)
+v5 : v1 - 'c' * '0' * v1
+v5 : 'a' + (v1 * -1 * 'a' + 64)
+v1 : (89 - v0 * v5) - 57 / -20 * v4
+shw "s8"."s8"."s4".v3
+v2 : v5
+v1 -: v1
+v4 : -10
+shw "s3".('Z' + v0 + v1 * 36).v0."s6"
+v2 -: 41 * v4
+v2 : v4 / v1 - v4 * v2 / v2
@@ -0,0 +1,12 @@
+chr v0 : 45
+flex v1 : v0 / -13 / v0 - 99 + 'x'
+nmbr v2 : 'z'
+v0 : (v1 / 5 * (v1 * 35) + ('9' + (v2 * 53)))
+shw v0
+shw v0.v0
+v1 /: (-5 - 75 + v1)
+v1 : ('a' - '9') - 21 + 48 - (v1 + 51 - (113 / 4))
+v2 : 43
+shw v0.v1
+shw "s2".'c'
+shw v1.v2.v1
@@ -0,0 +1,14 @@
+nmbr v0 : (104 / 20 - 11 - -17 - 114)
+nmbr v1
+flex v2 : (v0 * 93) / 22 - 'y' / v0 / v0
+v1 : 'A'
+shw (v1 / v1)
+shw v1
+v2 : v2
+v1 : ((v2 * 'y') + v1 - 97) + ('z' + -5) * 'b' - v0
+v1 *: 11
+v2 *: 40 / (-20 * 114) - '9'
+v0 /: (v2 / v1) / (66 * 5) + ('c' - v2 - v1)
+v1 *: v1 - (v2 + v1) + v1
+shw v2.v2."s8"
+shw "s3"
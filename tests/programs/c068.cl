@@ -0,0 +1,12 @@
+flex v0 : (64 * 72) - (103 + 67) + -19
+chr v1 : (68 - v0) + 53 / v0 - v0 + v0 * 70
+chr v2
+flex v3 : 'a' * 5 / '9' / v1
+nmbr v4 : 68
+nmbr v5 : (87 + v1) * 'x' * 87 / (('y' + 'Z') * v2)
+v5 : ('y' - v2 + v2 / v4 + 'y')
+v2 /: v0
+v2 : 'y' * v0 - v4 * 'x'
+shw "s0"
+v4 +: 80 * ((v1 / v5) + 55)
+v2 -: 'A'
@@ -0,0 +1,7 @@
+nmbr v0
+nmbr v1 : '0'
+chr v2 : ((v1 / v1) * v0) / 75 + (v0 + v0)
+shw v0.v1.v2
+shw v2.v1
+v2 : 'A'
+v1 : (116 / 91 / 106)
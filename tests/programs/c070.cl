@@ -0,0 +1,7 @@
+chr v0 : (((85 - 'x') - 50) * 52 + (10 + -4))
+nmbr v1 : ('z' * '9' - 'b') + 'y'
+flex v2 : v1
+shw "s7"
+shw v0
+v0 : -7
+shw "s7"."s1"
@@ -0,0 +1,11 @@
+flex v0 : 'x'
+chr v1 : (69 / -11) * 28 - 'Z'
+flex v2 : 111 - (v0 + v1)
+flex v3 : 21 + v2 * 46 / 'x' + v2
+nmbr v4 : v3
+v4 : 'Z'
+v3 : v2 * ('x' / (-8 * v0))
+v3 : v4 + v4 * v2 * 44 / 100 + v2
+shw "s7".v4.('Z')."s2"
+v3 : v1 * -18
+v0 +: 'b'
@@ -0,0 +1,9 @@
+flex v0 : 75
+chr v1 : ((v0 * (v0 - v0)) - v0)
+chr v2 : (v0 - v1)
+v1 : 'y' / v0
+v2 /: 107
+v2 +: v1
+v1 : '0' * 'c'
+v2 : 32
+shw "s3"."s7"."s9"
@@ -0,0 +1,17 @@
+nmbr v0 : (83 / -14 + 88 - 'y' - 31)
+flex v1 : v0 - v0 - v0 + 92
+chr v2
+flex v3 : v1 - (v0 + v1) + v2
+chr v4 : 6 / (62 + v0) * 'c'
+shw v1."s3".v4."s6"."s6"
+shw v2
+v2 -: v1
+v3 : v0 + v4 * v2 * 'A' - 11 + v2
+v0 : 'z' + '0' / 94 * (v0 / 116 * v0)
+shw v4.v0
+v1 /: ((v4 * 8) / 62) - v3
+v4 : v1 * 'c' * v0 - v3
+v4 : v0
+shw "s4"."s4".v2
+v3 : 55
+v0 *: '0'
@@ -0,0 +1,19 @@
+flex v0
+chr v1 : 'x'
+chr v2 : 111 * 'x' * v1 / 'c'
+flex v3
+nmbr v4 : (24 - 90 / (v0 + v3)) + (58 + v2 * 'x')
+chr v5
+nmbr v6 : 'b'
+v1 *: v5
+shw v5.v2.v3.28."s6"
+v4 -: ((v4 / 'x' * (78 - 57)) - ((v5 - 'c') - v1))
+shw "s3"."s6"
+v4 : (28 * v2 * 'Z' - v1 * v2 + v3 / 'A' + 4)
+shw v5."s2".v4
+shw "s5".v0."s3".v6.v6
+shw v5.v6.v4
+shw "s3".v6."s4".v1."s1"
+shw "s3"."s6".v5.v3.v1
+v3 : v0
+shw v5."s2"."s4".v2.v1
@@ -0,0 +1,14 @@
+flex v0 : 101
+flex v1 : (1 * (104 * v0) * ('x' / v0))
+chr v2 : v0 + 'b'
+chr v3 : 'y'
+chr v4 : v0
+nmbr v5
+v0 : v5 / v3
+v0 /: '0'
+v2 +: v0
+v3 *: 'a' - v4 + v1 * v5 * ('A' - 1) * v3
+shw v0.v1
+shw "s8".v5.v1.v5.v0
+shw "s0"."s6".(-15)."s7"
+v2 -: v0
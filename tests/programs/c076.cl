@@ -0,0 +1,17 @@
+chr v0
+nmbr v1
+nmbr v2 : v1
+chr v3 : v1
+flex v4 : v3 + v1 * 56 + 6 / v3
+v3 /: ((72 - v1 / -15) - 19)
+v3 /: (-7 - (58 - 'b' + 'z'))
+v0 : v3
+v2 *: 117 + v1
+v4 : v1 / v4 * v1 / v2 - (v1 + (v3 / 114))
+v3 : (('b' - (v2 + 83)) * (v0 * '9'))
+v0 : (v2 * (54 - v4) - 'Z' - 'a')
+shw v1.v2."s6".v2.v2
+v2 : ((v0 * v4 - 'b') / v1 - v4 / 'Z')
+shw v2
+shw v2
+shw v4.13
@@ -0,0 +1,9 @@
+chr v0 : 'y'
+chr v1
+flex v2 : (v0 / v1) + v1 + v0
+flex v3 : 'x' + v0 + (v2 + 11)
+chr v4 : v1 - 'a' / (90 + v3)
+v4 : 'z'
+shw "s7"."s0".v1."s7"."s6"
+shw "s3".v0
+v1 : 'x'
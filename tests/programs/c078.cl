@@ -0,0 +1,12 @@
+nmbr v0 : (((28 / 'Z') + 68 - 84) * (29 - 54) * 22 * 79)
+flex v1 : (85 * (60 - v0 * v0))
+flex v2 : v1
+flex v3 : (v0 / (v0 / v1))
+shw v0
+v0 /: v3 - v1 * (v2 + v3) + (v0 + v2 / v2 - -3)
+v3 : 35 / v2 / 'c' * v2 * ((v1 / v0) / 32 * v3)
+shw "s3".v3.v1.v0."s5"
+v0 : 70 * 'Z' - v1 + v2 * 'Z'
+v2 : ('0' / 118) / 'b' - '9' * 54
+v3 : 112
+v2 : v3
@@ -0,0 +1,10 @@
+chr v0 : 106
+nmbr v1 : v0
+flex v2 : 104 * v1 + ('Z' + v0) * 'z'
+nmbr v3 : 'y' - -15 * 120 + 'a' - v0 / v2
+v1 : (('0' + v0) - 11 / 'y' - v1 * v2 - (59 + 71))
+v2 : v2
+shw v1.v3
+shw 'Z'.v0.v3."s7".v3
+v0 -: v1 / 'Z'
+v3 : v3
@@ -0,0 +1,8 @@
+chr v0 : (('9' / 41) / (13 + 'x') / ('z' - -19))
+chr v1 : v0
+nmbr v2 : (v1 * v0 + v0) + v1
+flex v3
+chr v4 : ((v3 / v1 + 'y') - ('c' / 90 * 10))
+v0 : 47
+v2 : ('c' - 8 - 'a' - 'b' / -8)
+shw v1
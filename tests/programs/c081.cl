@@ -0,0 +1,15 @@
+chr v0 : ((-20 - 36 * 13) / (39 * 94) - 69 / 50)
+nmbr v1
+flex v2 : 'x'
+chr v3 : v2
+chr v4 : 'A' - -17 + 74 + 'a'
+nmbr v5 : (v4 + '0' * 'A' * 'A' / (42 - 'y') + (v3 - v0))
+flex v6 : 39
+shw "s6".v2.v3."s2".v1
+shw v1.v1.v5.v3."s7"
+v5 : 28
+v6 : 'Z' - (v2 / 'z') / v0 - 'x'
+v4 +: (v2 - v2 * (54 + v4))
+shw "s4".v4."s0".('c')."s8"
+v5 : v4 / v6
+v3 : (88 + v1 * -12) * v1 / v0 * -11 - v3
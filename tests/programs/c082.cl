@@ -0,0 +1,13 @@
+chr v0
+chr v1
+nmbr v2 : (v0 + v0 + (v0 / 'x')) - ((44 * v1) / (v0 - 'z'))
+chr v3
+shw v1
+shw v0."s6".v3."s5"
+v3 : ((v1 / 1) + (v3 * 108) / v1 - 'A' * 65)
+v2 : 'Z'
+v3 : (32 - (27 + 'c') * 'y')
+v3 : v0
+shw "s4".v0
+shw ('A').v0.v0
+v1 +: (54 + (v0 / 'x')) / 'x'
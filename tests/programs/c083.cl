@@ -0,0 +1,13 @@
+chr v0 : (-7 - 31 * 38 + 99)
+flex v1 : ('A' - 27 * v0 * (v0 / v0) + v0)
+chr v2
+chr v3 : v2 - v0 * (6 / 'Z') / v1
+flex v4 : v2 * v1 / v0 / v0 + -5 + 86
+nmbr v5 : (v3 - v1 + 'Z' * ('Z' * v2 + 17))
+shw v3.v5.v1.v2
+shw "s9"."s3"."s1".v3.(((v2 + 'b') - 'z') + 107 / ('0' * 'c'))
+shw (v1 + 44 * 'a' + v0 * v5 - v5 - 27)."s1".v1.v4
+v4 +: ((86 * v2) * (v1 * v3)) * (v4 / (v0 / v0))
+v1 /: (v1 + v2) - 105 + v3
+shw v5.v1."s8"
+v0 : 103
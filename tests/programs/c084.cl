@@ -0,0 +1,9 @@
+nmbr v0 : 119 * 'y' / (12 * 101) * 54
+nmbr v1 : v0 - ((17 / 103) + ('9' - 28))
+flex v2 : (v0 + 2 + v1) / ('b' * v1 * 36 * 'A')
+flex v3 : v1
+nmbr v4
+v2 : ((v0 * '0') - v2 * -13 - (v0 - 'Z' / 'z'))
+v2 *: (v2 * v2) + v1 + (v2 * 74 + 55 / v0)
+v4 *: v4
+v2 /: (56 * v2 / 'z' / (79 * v4) * 'c' + v1)
@@ -0,0 +1,12 @@
+flex v0 : 'x'
+nmbr v1 : ((99 - 10) / v0 / 103 * v0)
+nmbr v2 : 'z' - v0 - (v0 * 'x')
+chr v3 : v0 - '0' + 'c'
+v2 : -2
+shw v2."s6".v2.v1."s6"
+v3 *: v2
+shw v2.v1
+v2 : v1
+v2 +: 'a'
+shw "s2"
+v3 : v0
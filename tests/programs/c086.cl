@@ -0,0 +1,9 @@
+flex v0
+chr v1 : 'b' / v0 / v0 * ((v0 + v0) + 32 / -10)
+flex v2 : (v1 * 95 / 'b' + 104 / (-11 + v0 + v0))
+v2 /: ((3 * v0) + v2 - v1 - v0)
+shw v1.v1.v1
+shw (81 / v1).v1
+v2 : v1
+shw v1."s2"."s3"
+v1 : 17 + v1
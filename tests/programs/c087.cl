@@ -0,0 +1,10 @@
+flex v0 : 119 + 2 + '0' + (27 - 0)
+flex v1 : v0 / ('9' / v0) * v0 * v0 + ('x' * 51)
+nmbr v2 : '9'
+nmbr v3
+shw "s4"
+shw "s6".v1
+v1 : (v0 - v0) - 37 * (v2 * 86) + ('Z' * v1)
+v3 *: v3 - 90
+shw v3
+v0 : 'x' - -16
@@ -0,0 +1,9 @@
+nmbr v0 : -18
+chr v1 : 'b'
+flex v2 : v1
+nmbr v3 : 'z'
+nmbr v4 : (v1 - -14 / 'A' / v0)
+chr v5
+shw v3."s3".(v2).v4.v3
+v2 : (((85 / 'a') + 52 / v0) * 91 - 'c' - '0')
+shw v4."s4".v4
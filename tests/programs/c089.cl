@@ -0,0 +1,10 @@
+flex v0 : -4
+nmbr v1
+chr v2
+shw v0
+v0 -: v0
+v2 +: v1
+shw (v2 + 59 - (v2 / 'y' / '0')).v0.v2
+shw "s8".v0.v2."s2"
+shw v1."s6".('y' - 98 + (v1 + 'z') / (('0' + v0) + '9'))."s3"."s9"
+shw v1
@@ -0,0 +1,12 @@
+flex v0 : (49 * 119 * 77) * (-1 - 109) - (88 + -20)
+nmbr v1
+chr v2 : 59 - v1 * v0 / v1 + (v1 * 12 + 37)
+flex v3 : v0
+v3 : v0 / v3 / (v3 + 'b') + v0 - (23 / 'A')
+shw v3."s1"."s7"."s3"
+v3 /: 5
+v2 /: ('z' * ((112 * v1) - 'b' - v1))
+v3 : 2 - (114 * v3) * v2 / 'Z'
+shw v2
+v3 : ((v1 + 33) * 'A') / ((v1 * 117) - v2)
+shw "s4"
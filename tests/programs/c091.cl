@@ -0,0 +1,9 @@
+flex v0 : 45 / 74 / 78 - (57 / 69) + 25 / 75
+chr v1 : ((v0 / v0 * 93) + -5 / 25 - (v0 * 84))
+flex v2 : 56 / v1
+v2 : v0 * v0 * 'b' / v1 - (v1 / (-7 - 80))
+v1 *: v0 + v0 + v2 * '9'
+v1 : 99
+shw v1."s3"."s8"
+shw "s2"
+v0 : (v1 + 110) - (v0 - v0) / ('9' - 95 / v1)
@@ -0,0 +1,17 @@
+flex v0 : ((-1 / 66) + 'c' - 20 * (-3 - 85) - (25 - '9'))
+chr v1 : v0 + v0 + v0
+nmbr v2 : v0 + 70 - ('0' + v0) / (v1 - 59) - 84
+chr v3 : v2
+flex v4 : v3
+nmbr v5 : ('x' / v0 - (v2 - 78))
+v3 : (v5 - v2 * v1 * v5) + 45 / v5 - v3
+shw (56)."s4"
+v3 : 39
+v3 : ('x' - (v4 + -11))
+v0 +: (-15 / v3 + 101) - ((94 - 'A') / -11 * 111)
+v3 : v3
+shw "s6".v4.v1.v1
+v4 : (('9' + 16) - 'b' * '9' * v3 - v4 - v2)
+v4 : ((v3 / v5 + v5) + (v4 * (v0 * 'y')))
+v3 +: 80
+shw v2."s6".42
@@ -0,0 +1,18 @@
+flex v0 : ((10 - 74) - 32 + 54 / 'Z')
+nmbr v1 : (-17 + 78)
+chr v2
+flex v3
+chr v4 : 16
+flex v5 : 69
+v0 : 'A'
+v0 /: v1
+v5 -: v2
+v5 : v2 * ((83 * v0) - (v0 / v4))
+v0 +: 'a' + v0 + ('A' / v4)
+shw v3.v3
+v3 /: 'a' / (('b' * v4) - 30)
+v5 : (v0 * 'x' + v2 / (46 - 95 * -16))
+v2 +: ('c' - 'x') - v3 - v2 * (v3 - 'A' + 'c')
+v4 : 17 / 45 + (v2 - v3 - v2)
+v2 : v0
+v3 +: (v4 + 'a' * v3 - v3 + 96)
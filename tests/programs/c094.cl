@@ -0,0 +1,15 @@
+nmbr v0 : -16
+flex v1 : ((v0 + v0) * 85 / v0 - ('z' * v0))
+flex v2
+nmbr v3
+chr v4 : 'c'
+flex v5 : ((108 - v4 + (v4 + 13)) - 103 - 20 - v3 * v4)
+flex v6 : '0'
+shw "s5".v4.v4."s2"."s9"
+v2 : (v1 / '9') / v0 - 48 + v4 / v0 * v4
+shw "s8"."s1".v2
+v3 /: (v0 * 44 + 23 * 65 / v2 - 100)
+v2 -: 'y' - ('b' - v4 + v6)
+v3 /: 'b'
+v0 /: v3 - v6 / 'b' / v3
+shw "s9".((v6 / v6 - v1 * 'y'))."s5"
@@ -0,0 +1,16 @@
+flex v0
+flex v1 : v0 + (v0 - 7) - v0 - 110 / 8
+chr v2 : 115
+flex v3 : (v0 / 'A' + v1 - 92)
+flex v4
+chr v5 : v1 - 24 * 'x' - ('c' * 83) + 119 * v2
+nmbr v6 : ((v2 * v0) / v0)
+v3 -: v2 * 116 / v3 * v6
+v2 *: -7
+shw "s8"
+v5 : 'x'
+v0 : (v3 * v6 * v3 / 31 / 8 + v1 + 'A')
+v0 -: v5
+v3 : v5 - v0 - 38
+v4 : v1
+v0 : v5
@@ -0,0 +1,17 @@
+chr v0
+chr v1
+nmbr v2
+nmbr v3 : v1
+nmbr v4 : v0
+v4 /: v0 * v4 * 9 - 'y' - 29
+v4 : 'z'
+shw ((58 * 55 - (v3 + v0 - (v0 + v1))))."s1".v2."s1"
+v4 : 'c'
+shw "s7"
+v1 : v3
+shw v0.v0.v4."s8".(v4)
+shw v1."s8"."s5".(v0)
+v1 : v3
+shw "s9".v3
+v1 +: 'y'
+shw v1."s4"
@@ -0,0 +1,7 @@
+chr v0
+chr v1
+nmbr v2 : (49 + (60 / v1) + (v0 - v0))
+nmbr v3 : 'b'
+v1 -: 109
+shw v1
+v0 : (92 / v0 + 'a' - (v1 / v2 - 'x'))
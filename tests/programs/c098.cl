@@ -0,0 +1,14 @@
+flex v0
+chr v1 : (v0 - v0 + v0 * v0 * (v0 - 85 * 'c' - 'z'))
+nmbr v2
+nmbr v3
+chr v4 : (((v1 - -10) + 'Z' / 71) * v0 * 61)
+shw "s1".v3."s7".v3
+shw v3.v3.v3.v0
+v4 : 71
+shw "s4".v4.'z'."s5".v4
+v0 : v4
+v0 : v4
+v0 : v4
+v3 : 29
+v0 +: (v0 + '0' / v3 + v0 - ((v1 + v3) / v3))
@@ -0,0 +1,16 @@
+chr v0 : 2
+chr v1 : (35 / 'x' * v0) + (v0 / v0 + (v0 / -7))
+nmbr v2 : (v1 - (v1 / 16)) - v0
+nmbr v3 : ('c' / 18 - v1 + v0 / ('b' - 'z') * v2)
+chr v4 : ('z' - 82 * 'x' / 'z')
+flex v5 : v0
+v2 : v5
+shw "s4".v2.v5.(v1 / 55)."s2"
+shw v5."s5".v0."s8"
+v4 : 22
+v3 -: 'A'
+v4 *: v0
+shw "s0".v2.55."s1".v1
+v2 : v3
+shw v5."s4"."s7".v5
+v3 : ((v0 / v3) + 116 + v0 / -8)
@@ -0,0 +1,7 @@
+chr v0 : ((0 + 47) / 59 - 'x') / (98 - 76) * (81 + 21)
+nmbr v1
+flex v2
+chr v3 : (v1 * v1 * ('y' + 44) + 'y' / v2 / v1)
+shw v1.v2.v0
+shw (102 - 'a' + -8 + (v0 - v3)).v3
+v2 /: v3
@@ -0,0 +1,14 @@
+nmbr v0
+flex v1
+chr v2 : (((v1 - v0) / v1 * v1) - 'z' - v1 * v0)
+chr v3 : 74
+flex v4 : 'a'
+chr v5 : v2
+flex v6 : '0'
+shw v0.((15 / 31 + 'c' / v1) / v5).v1."s5"."s2"
+v1 : v1 * 97
+v2 : v5
+v4 : v2 * 112 + v1 / v0
+shw v5.v1.v4
+v5 : v3
+v2 : 'Z' - -12 + ('9' / 'a')
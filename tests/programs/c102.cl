@@ -0,0 +1,14 @@
+flex v0 : 26
+chr v1 : (v0 / v0 - ('x' / 114) + (v0 + v0 - 'c'))
+flex v2 : v1
+flex v3 : v2
+v3 -: v3 * v3 - v3 - v1 - v1
+v1 : -19 - v1 * 'x' * v1
+shw "s2".100."s4"
+v1 : v1
+shw v1
+v1 : (83 - 'z' + v3 + v0)
+shw (31).((27 * 6 + v1 - 'c' / (v2 / 'x')))."s5".v0
+v3 -: v0
+shw v0."s7".v1.v3.45
+v2 : ((v2 - v1) - v1)
@@ -0,0 +1,17 @@
+flex v0 : ('b' / 13) + (7 + 113) + 43 / 35
+chr v1
+flex v2 : 'Z'
+flex v3 : v0 - (v2 * 3) + 'b'
+chr v4 : ('c' / (v2 + '0')) / 'c'
+flex v5 : v0
+v0 : 39
+v3 *: (v4 - 104)
+v5 : v2 - 53 / v2 * v3 + v3 / (v0 + 'c')
+shw v4
+shw "s0"."s2".v0.v4."s3"
+v0 : v5 / (39 / 'b') / v3 * 104 + v1
+v2 : v5 * (v2 * 'y') / v2 + v5
+shw v0.v3.v3."s4".v5
+shw (v2).v4.v0
+shw "s4"."s4"."s5".v4."s2"
+v2 : v1 - (v1 / v4)
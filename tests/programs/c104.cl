@@ -0,0 +1,7 @@
+nmbr v0 : 12
+nmbr v1
+nmbr v2
+v1 : (('c' * 84) * (v0 - 'a') + v0 - 'x')
+shw v0.v2."s8".v0.v0
+v0 +: v2
+v0 : v2 / v2 / (-13 + v0) / v0 + v0 * -18
@@ -0,0 +1,18 @@
+chr v0 : 114
+flex v1 : v0
+nmbr v2 : ('x' / 26 / v1 * '9') - ('0' / 105 - '0' * 11)
+flex v3 : v1
+chr v4
+flex v5 : ('z' - ((-1 - -1) / 73 * v0))
+nmbr v6 : (v1 + v2)
+v4 : (22 / 'c' / 92 + 'z' * v1)
+v5 : 'y' - 34
+v5 : v5
+shw v5.v3.v1
+v0 -: v1
+v1 : v1
+v4 : (v5 / (v5 / 70 / 116 / 4))
+shw v5."s7".v2."s7".v3
+v5 *: v3 * 81 / 'a' + v2 * v6 / v2
+shw "s7"
+v3 : 'Z' / (v4 * v2)
@@ -0,0 +1,9 @@
+nmbr v0 : 'b' / 'z'
+flex v1 : (v0 / v0)
+chr v2 : (v0 + v1 * 107) - v1 / 'z' - v0
+flex v3
+flex v4
+flex v5 : ('c' / v0 * 117 + 102 - ('A' + v2))
+v5 : (((v4 + v2) * 'Z') * (v5 + 115) + v0 * '0')
+shw v3.v2.v1
+shw v2.v3
@@ -0,0 +1,10 @@
+flex v0 : 'b' / -12 * 'x' * 29 / -1
+nmbr v1 : v0
+chr v2 : v1 - (v0 * 92 + (102 - v1))
+flex v3 : (v2 + 52) * '9' * 'x' + 85 / 54 / v0
+v1 : 'z' * 'Z' + -5
+v2 : ((-17 / 25) / v2 * v3) - v3
+v1 +: (v1 * v3) / v0 / 35
+shw v2."s7"
+v0 : (v2 - 99) / v3
+v3 : ((v2 - v0) / 'a' + 'b' / v2)
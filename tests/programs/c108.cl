@@ -0,0 +1,7 @@
+flex v0
+flex v1 : v0
+chr v2 : 'x'
+nmbr v3 : v1 / '9'
+shw v2
+shw v3."s0"
+shw "s6"."s5"."s7".v0.v1
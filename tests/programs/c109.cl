@@ -0,0 +1,17 @@
+nmbr v0 : 56 + (89 / 'c' + 112)
+flex v1 : 83 - v0 / 'A'
+nmbr v2
+chr v3 : (v2 + 87 + v1 + v0 / v0 / v2)
+nmbr v4 : 'z'
+v2 : (v4 / v1 * v3 * v0)
+v3 : (((18 - 'c') + v4 + v2) + v0)
+v3 : 117
+v1 : v2
+v0 : 'b' - v1 + v0 + v2
+v4 -: 62 / v2 + 118 * 'y'
+shw "s9".v2
+v4 : (v0 + 'x' / 'y' * v3 + v2)
+v1 : (57 / 90 + v4 / 34 / v3)
+shw (88 * 'y' * v2 * 'A' + 51)."s9"
+v0 : v3
+v1 : v4
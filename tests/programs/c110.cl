@@ -0,0 +1,9 @@
+flex v0 : (((9 * 'b') + ('x' / 72)) * ('c' / 38))
+nmbr v1 : v0
+nmbr v2
+chr v3
+nmbr v4 : (v2 - (v3 * v0)) + ('b' - v0) / v0
+flex v5
+v1 +: -18
+shw v0.v0
+shw "s5"."s7".v5."s7"
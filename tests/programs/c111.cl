@@ -0,0 +1,10 @@
+chr v0 : ((86 - 'y') / -12 * 41 - 110)
+nmbr v1 : ('a' * (103 * '0') / 'a' - v0)
+flex v2 : ((v0 / v0 / v0 * 'b') - (v1 / v0) - 'c' / v0)
+nmbr v3
+v0 : v2
+v1 : v2 * 'A' * v1 - -18 + 114
+shw v1.'a'.v2
+v0 /: v3
+v2 : ((v2 + v0 - 108) + v2 * v3 - (v3 / 'x'))
+v1 : v2
@@ -0,0 +1,14 @@
+flex v0 : 87
+flex v1 : v0
+flex v2
+flex v3 : v2
+flex v4 : (v0 * 58) / (-17 + v1) / (('c' / v3) * v2 + v1)
+flex v5 : (v3 * v0 - v0 + (1 - v4) / v0 / v3)
+v1 : 'z'
+shw v2.v0.v3.v2.v2
+shw 92.v3.v3
+shw v3."s4"
+v2 : (v4 / (v0 / 50)) - 'c' * 76 - (86 / v3)
+v5 +: v5
+v4 : v2
+v1 : v1 * 'z' + (v1 + v5)
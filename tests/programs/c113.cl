@@ -0,0 +1,15 @@
+flex v0
+flex v1 : 'b' * 106
+chr v2 : ((v0 + 'x' * (v1 / 29)) / v0 * v0 + (v0 + v1))
+shw v0.v0
+shw v0.v0.v1
+v2 : v0
+shw "s6".v0.v1."s6"
+v2 *: 'x' / v1
+v1 /: (v0 * 68 / 'y' / -11 - v0 * (-9 * v1))
+v1 -: (v1 + 'x' * v0 * (v0 * v0))
+v2 : v1
+shw v0.v0.v1.v0
+v2 : (v0 + v2 + (v2 * v2) + 1 * -10 - v1)
+v1 *: (35 + 'Z' * 8) * 8
+shw v2."s8"."s5"
@@ -0,0 +1,13 @@
+flex v0 : (('0' + 75) - 'Z')
+flex v1 : v0 - 'z' / ('c' + 44) * (v0 + v0) - (v0 * v0)
+chr v2 : 14
+nmbr v3 : (v2 + v1 / v1) + 19
+shw "s7".v3.v1.v1."s9"
+v0 : ((63 / v2) / v3 / 'a')
+shw v2."s2".v1
+v3 -: v3 + v1 + 'A' / 0
+v1 : ((v3 + v3) / -9 * ('A' * v1 / '0'))
+shw v0.v3
+shw v3
+shw "s1"."s3".v1
+shw "s9".v0.v3
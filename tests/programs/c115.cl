@@ -0,0 +1,15 @@
+nmbr v0 : (103 * 16) * 'c' * '0' - 'c'
+flex v1 : v0 - '0' * v0 * '9' * (('z' - v0) - -14)
+nmbr v2
+flex v3 : 'z' / v0 - v0 - v2 * v1
+flex v4 : 'z'
+v0 -: ((105 - v1) + v1 / v0 + ((v2 - '9') + v0 + 'x'))
+v2 : (v3 + 28 - 114 + v2 - v2)
+v0 : v1
+v4 : 33 - 38 * v4 / v0 / -2 - '9'
+shw "s4".v2.v0.v3.v2
+shw v4
+v2 : (v1 * '0' - v2 * v1 / v3)
+shw "s9".v4.v4.v3.v0
+v4 : 'b'
+v4 : v4
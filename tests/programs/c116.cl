@@ -0,0 +1,12 @@
+flex v0 : 13
+chr v1
+nmbr v2 : ('0' * v0 + ('Z' + v1) / 'z' * 'a' - (39 / v0))
+chr v3 : 57
+flex v4 : ('a' / 'y')
+nmbr v5 : v4
+flex v6
+v4 /: (6 * v4) / v2
+shw v0."s9"."s2".v6
+v5 -: 'c'
+shw "s8".v4.106.v3
+v2 : (v6 + v4 / (v6 / v3)) + (v0 - v6)
@@ -0,0 +1,7 @@
+nmbr v0 : -12 * 75 + 88 - 26
+flex v1
+nmbr v2 : (0 - (v1 + v1)) / v0
+nmbr v3 : v0 * -8 / v1 + ((v1 / v2) * v2)
+v2 /: 98
+v2 : v2 + v1
+v0 : 'Z'
@@ -0,0 +1,12 @@
+chr v0 : ('9' + '0' - 'x' * -4 / -5)
+chr v1 : (('Z' + v0) * v0 + v0)
+nmbr v2
+chr v3 : (119 - 'c') + v1 - (v0 - v2 - v2)
+v1 : (98 + v2) - (v1 / v2 / v2)
+v0 *: v3
+v0 : v3
+v0 *: 'x'
+v0 : v0
+v0 : (17 / (v3 / v2) / 45)
+shw v2."s8"
+v0 +: (12 + 23)
@@ -0,0 +1,9 @@
+nmbr v0 : 'x' / -16 * 45 * (66 + 98)
+chr v1
+nmbr v2 : v1
+flex v3
+flex v4 : v1
+shw v4.v4
+v1 /: -15 / (v4 / (v4 + v2))
+v3 : 27 * 'x' + 'x' - '9' + v1
+v3 *: (34 / 'a') - (v0 * 'z') + v2
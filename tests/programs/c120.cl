@@ -0,0 +1,19 @@
+nmbr v0 : 37 / ('z' - 52) * 110
+nmbr v1 : 'Z'
+chr v2 : (v1 / v1 - 'z') / (50 * v1 * 118)
+chr v3 : (v2 + 'x')
+flex v4 : 30 / v1 / v3 - 'Z' / v3
+chr v5 : -20
+flex v6 : ((v1 - 'a') - v4 * 'z' * v2 + 45)
+v3 : v2 * 'y' * v3
+shw v0.v5.v6.v1.(81)
+v3 : (('a' / v5) / v5 - 'c' * v0)
+v2 /: v4 - (22 - 'z') + 'A' - (71 / 36)
+v1 /: '0' - v3
+v1 : 68 * 25
+shw "s5".v0.v0.v2
+v0 -: v0
+shw v3.v2
+shw v3.v2
+v0 : v0 * 57
+shw -14.95."s4"
@@ -0,0 +1,7 @@
+nmbr v0 : 88 * 90 - 66 - 90
+chr v1
+flex v2 : v1 * -18 + 89 * ('c' - v1)
+shw "s3".v0
+shw v0.78.v2.'A'
+v0 *: (79 - 1 - 101 + v1 / v2)
+v2 : 'y'
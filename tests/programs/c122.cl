@@ -0,0 +1,15 @@
+nmbr v0 : 'z'
+nmbr v1 : (v0 - (51 - 100) / v0 + 114)
+flex v2 : ((v0 / '9') - v1) * (v1 * '9' + v0 + 3)
+flex v3
+nmbr v4
+chr v5
+flex v6 : v3
+v5 : 63
+v3 : (('Z' - 'A') / 2) + 83
+shw v0
+shw "s4"."s9".((v2 * (113 + 94 * v2 * v6))).v3."s0"
+shw v2."s0"
+v5 : ('c' - v2 / v4) * ((v5 - v5) - v1 * v6)
+v4 : ((90 - 'a') / 'y' * 115 + ((v1 + v3) / (v3 * 'c')))
+v5 : v0
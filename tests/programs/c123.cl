@@ -0,0 +1,11 @@
+chr v0 : (-7 * 66 + (91 - 76)) + (-15 + 102)
+chr v1 : ('0' * v0 / v0 - (v0 * -2 + (v0 * 'z')))
+flex v2 : (v0 - v1) / v0 + v1 + v1 + (v0 + 76)
+v1 : 86
+v2 : (('c' / -6 - 79) - ((v2 / '0') * 90))
+shw 'Z'.v0."s5".v2
+v2 : ('x' * v1)
+v0 -: 1 + v2 + 'Z'
+v2 : (-19 - '9' - 72 + 'z' * v1)
+shw (v1 / v1 - ('a' + 56) * (v1 * v2 * v2))."s0".v1.v1
+v1 -: v0
@@ -0,0 +1,13 @@
+flex v0 : (59 * (88 + 35)) + 71
+chr v1 : 93 + v0 / -11 / 'Z' + (v0 - -6) / 100 / v0
+chr v2 : 111
+chr v3 : v2
+flex v4
+v0 : (v1 - 1) + 23 * v3
+v0 +: v1 + 39 * 'a' / v1 * 'b' * v0
+v2 : (v4 / 'b') + 'y' + 55 + ('b' + v3 - v3)
+v4 /: ((40 + v3) + v1 - v4 - (v0 + v4 / v3))
+v2 -: v3
+v2 : ((45 - 6) / (v1 / 'b') * (4 + 52) * v2)
+shw v1."s8".v0
+v4 : v3 * (31 - 18) / ((53 + v3) - 'Z' - -3)
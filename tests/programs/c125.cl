@@ -0,0 +1,8 @@
+nmbr v0
+flex v1 : v0 * 100
+chr v2 : 'Z' * 116 + ('c' + 'b')
+nmbr v3 : 88 * -18 + 40 * v2 + (v1 + v1 * v1)
+v2 *: v1 / 'b'
+v2 *: ('A' / v1 * 'x' * 'a' * v3 * 98 - 79)
+v0 : 63 + v0 + v2 + v1 / (41 + v2 + 'A' - v3)
+v0 /: (-6 - ((v0 / v2) - (v3 * v1)))
@@ -0,0 +1,13 @@
+nmbr v0 : (104 / 117) - -12
+chr v1 : v0 + ('a' - v0) + (v0 - 'z' - v0 - v0)
+nmbr v2 : 'a' - v0 - v1 + 'b' / ((v0 / 'Z') - v1 * 117)
+nmbr v3
+nmbr v4 : (('b' / v1 * (22 + v0)) * v0 * v1)
+flex v5 : (v1 + (43 + v4)) - (v2 + 'c')
+nmbr v6 : v2
+v4 : v2
+v2 : (16 / 64 * -11 / v4) + v4
+v6 : ((79 - v2) / v3 / ((77 * v3) + v1))
+v6 : 46
+shw v6
+shw "s5"
@@ -0,0 +1,7 @@
+flex v0 : ('A' + 59)
+nmbr v1 : (v0 / v0 + 75 + v0)
+flex v2 : (-12 / (v0 * 'Z') - 'x' / v0 - ('Z' / v0))
+shw v2."s4".(v1).v1."s0"
+v0 -: v1
+v0 : ('y' * 34)
+shw ((v1 * v0) / (61 / (48 * 'z'))).((v1 / v2 / 'z') + v1).'0'.(118 + (v0 * (v1 + v2)))
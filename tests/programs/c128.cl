@@ -0,0 +1,15 @@
+chr v0 : 19
+chr v1 : 56
+nmbr v2 : 11
+flex v3 : (((v2 * v2) * 'a') / v1)
+v3 : 'A'
+shw v2
+shw v3."s3".v0.v0
+shw v0
+v1 -: v1 * v0 + v0 - 114 + 'b' + -15 * v0 - 98
+shw "s3".v0
+v2 : v1 / v2 - 'Z' - 'x'
+shw "s4".v2.(((v1 + 13) - 'c' * ((v0 * v3) - v2 / v0))).v2.('Z' + v3 + 113 * v2 / 'A')
+shw "s4".v2.v1
+v0 -: (('0' - v1) - 17) - v3
+v1 : (('c' / 'y' - 68 * 'A') - 85)
@@ -0,0 +1,19 @@
+flex v0 : (120 - 50 * (97 - 6) / 24 / 'x' + 63)
+flex v1 : ((109 - (v0 * 92)) + v0 - v0 - 20)
+nmbr v2 : v0
+flex v3 : (v0 / v2 * 29 / 84 - 107 + v1)
+flex v4 : v3
+chr v5 : (v2 * -19 - v4) * v4
+chr v6 : v3
+v2 : v2 + (v2 + v3) * 'y'
+v1 : (((v0 - v0) / v5) * (v6 + v2 / v2))
+shw v0."s1"."s1".v4
+v6 : 102 - v1 / v0 - v4
+v2 : ('A' / 'z' / v4)
+v0 : (v0 * v2 + v6 - 16)
+v2 -: 19
+shw v5
+shw v6."s8".v4.(('x' * v0 / v0) / (v0 / v5 + v1)).v0
+v0 -: (v5 * (-4 - v4) * (v0 / 'x' / v1))
+v3 : 24 * v1 / 'a' * ('x' * v3)
+v1 : v1
@@ -0,0 +1,17 @@
+chr v0 : 66 * 115 + ('a' - 74) / 80 / 120
+nmbr v1
+flex v2 : (v1 / v1 - (v0 - v1) + 37)
+nmbr v3 : (57 - v1 - 62 / v1 + v0)
+nmbr v4 : v1 * v1
+flex v5 : 'A'
+chr v6 : ('a' * v5)
+v3 : (v5 - v6 * -6 - 'x') - v1
+shw ('z')."s2".v3.v0
+shw "s2"."s8".v1
+v2 : ((v5 + v4 + (77 / 'A')) - 'Z')
+v2 : 'x' - v0
+v6 : (v1 + v5 * -14) * v4 + 'A' * (v6 * 'Z')
+shw "s3"."s7".v1.(25)."s6"
+v4 /: v2 * v6
+v4 : ((v4 + 40) - ('A' / 53)) - (v2 - 103) - v4 - v6
+shw v2."s9".v1
@@ -0,0 +1,13 @@
+chr v0 : 79
+nmbr v1 : (('x' / '0') - v0 + 'Z' + 19)
+flex v2 : (v1 / (v1 - v1) + v0 + 'b')
+nmbr v3
+flex v4 : ('z' - (-5 + v0) * (v1 - '0'))
+v1 : v4
+shw v0.v3.v4.v4
+v1 *: v1 / ((17 + v4) * (v1 - 108))
+v4 : v0
+v4 : 7 - 'z'
+v4 : ((v3 / 'A' * v3) - v2)
+v0 : (v4 + 'c' + v1) - (v4 - v2 * v3)
+v3 : (70 + v0 * 37 / v4 + (90 / v0 - v2))
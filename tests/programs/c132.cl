@@ -0,0 +1,13 @@
+nmbr v0 : ('0' + 'y')
+chr v1 : 107 / v0 * v0 * v0 - v0
+nmbr v2 : v0 * 1 + v0 - 'c' - -18
+flex v3 : ((-15 + 36) * 83 / v2 - 98)
+chr v4 : v3 - 'z' - (v2 + 14) * ((v2 * 66) / 5 + v2)
+flex v5
+v5 : ((v1 + -11 - v2) - 'z')
+shw v4.112."s2"
+shw v2
+shw v3.v0
+shw v3.v2.v1
+shw "s2".((4 * 16) / v4 + 45 + (v3 + ('y' * v3)))."s0".('A' + 40)."s1"
+v4 : ('b' * v2 * v4 * v5 - v4)
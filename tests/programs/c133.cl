@@ -0,0 +1,13 @@
+chr v0 : ((47 * 'x') + (18 - 'A') * '9' * 1)
+chr v1
+nmbr v2 : v1 - ('9' + v1 * 88 - v1)
+nmbr v3
+flex v4 : v0 + v3 - 64 - v3
+chr v5 : (26 + 97 + v4 / 'x' + 'A' + v4 + 99)
+v0 : 'z' * (v5 * v1)
+v3 : (('a' / v2) - 32 * '0' / v0 / v2)
+v1 : v4 * (v4 - 58) * v3
+shw "s0".v3
+shw v3.v0."s0"."s1"
+v0 -: ((v0 - v1 / v5) / 83 - v5)
+shw v1."s8"."s7"
@@ -0,0 +1,11 @@
+flex v0 : 8 - (96 - 'b') - -3 * 47
+flex v1 : '9' / 'y' - v0 + v0 * 'x'
+chr v2 : 19
+flex v3 : 'x'
+chr v4 : (7 + '9' - 62 + v3)
+nmbr v5
+v5 : 'z' + (v1 - 46 + ('Z' + 2))
+v2 *: v5 * v1 * v2 / v0 / ('0' - v1 + (v2 / '9'))
+v5 : -20
+v0 : (v0 / 'a' - 'a' - v2 * v2 / v2 / 115 + 112)
+v2 : (v1 / 'b') - 'b' / 102 * 71 + v0 + v3 / -8
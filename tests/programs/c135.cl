@@ -0,0 +1,17 @@
+flex v0 : 10
+chr v1 : (((v0 * 'y') * v0) - v0 + v0 * -7 / 101)
+nmbr v2 : 'Z'
+flex v3 : v0 * 24
+nmbr v4 : v3 - (72 / v3 - v3)
+v4 *: 1 / v3 + v1 - (v4 - v0)
+v1 : (v2 * 'y' / v4) * (('c' - v1) - v3)
+v3 : 116
+v1 : ((91 / v1) * (-20 * 17) + v2 / v3 - (v4 / v2))
+shw "s8".v3.'a'.v0
+v4 : v0
+v2 +: 'c'
+v4 -: v1
+v2 /: v1
+shw (((v3 * 53 - v4 / 71) / (v2 + v2 / 'y')))."s0".v0.v3
+v3 : 'c'
+v0 : v0
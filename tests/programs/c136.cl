@@ -0,0 +1,17 @@
+chr v0 : 21 - 51 + 83 - 'y'
+nmbr v1 : 63
+flex v2 : v0
+flex v3 : (v2 / v1 - 18 * v2 + v1 - v0)
+chr v4 : v2 / v0 - v0 - (0 * v0 - -6 / 76)
+nmbr v5 : 'A'
+nmbr v6 : 'b' / 1
+v4 -: v4 / 'x' / 71 - 88 / v3
+v6 : ('0' - (v6 - v3 + v4 - 'c'))
+v6 : v5 / 86 + v0 * 'Z'
+v5 +: 'A'
+v0 : (100 / ('x' - 'a' + v5))
+shw v4
+v3 : ('9' + (v6 * 76 / v0 - v2))
+v1 : 40
+v5 +: v0 + 4 * v5 + v6
+shw v1
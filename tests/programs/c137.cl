@@ -0,0 +1,12 @@
+nmbr v0 : ('0' * 89 + 16 - ('z' / -18 * 110))
+chr v1
+flex v2 : 5 * ('x' - v1) + v1 - v1
+shw v2.v0."s1".(v0)
+v2 *: v2 - v0 - v1 / 4 * 'A' * v2
+v1 /: 14
+shw "s4"."s7"
+v2 -: (v0 / ((v1 * v2) * (65 / 'a')))
+v1 : (v0 * v2 - (v0 * 44) + v2)
+v0 : (112 * 'a' - (v0 - v2)) * (v1 + '9' + v2 + v1)
+v1 : v2 * v2 * v2 + v0 / (v2 - v0 + v2)
+v2 /: 'a'
@@ -0,0 +1,12 @@
+chr v0 : 93 * 32 - (37 + 63) / 'a' * 46
+chr v1 : v0 + v0 / (v0 / v0) / v0
+chr v2 : (v1 * v1)
+chr v3 : (v0 / 38 / v1 - v2) / v2
+v3 : 'A' + 83 * v3 / v3
+v0 +: (v1 - 82 + 'b' + v0)
+v2 -: 9
+v0 : (v3 - 2) * v1 / v3 - 32
+v0 : ((v3 - v3) + 'c' * v3)
+shw v0."s1".v3
+v1 : v0 / v1
+shw "s6".v0.v2.v3
@@ -0,0 +1,11 @@
+flex v0 : 69 * 18 + ('9' * 105) * (119 + 109 * 117)
+nmbr v1
+nmbr v2 : ((v1 + 'y' - 'y') / (v1 / v1 - v0))
+v2 : (((-20 + 'x') * (v2 - v0)) * v2 + 51 * (98 - v0))
+v2 +: ((18 - v2) / '0' * v1) + v1 - '9' / -7
+v0 +: '9'
+v0 : v0
+v2 : (v0 * v2 * (v0 * 38) + 'b')
+shw "s6".v1."s6"
+v1 : ('c' - 'A') / v2 * (('0' / 2) + v2 + 115)
+v1 : 76
@@ -0,0 +1,8 @@
+nmbr v0 : 77 - -8 / 'x' + (88 + 105) / 23 - 6
+chr v1 : 111
+chr v2 : v1 - 79 / 57 / 'A' * v1
+shw v1."s1"
+v0 : ((v2 + 35) * v1) * 90
+shw v2.v2.v1.8
+v1 : (v2 + (v1 - v2 / 'A' - v0))
+shw "s2"."s5"."s1".78.v0
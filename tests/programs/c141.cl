@@ -0,0 +1,12 @@
+nmbr v0 : -17 / ((103 * 'c') * 118)
+chr v1 : (v0 / v0) + 99 - (v0 / v0) - v0
+nmbr v2 : -17
+nmbr v3 : v2
+flex v4 : (v3 - 24)
+chr v5
+flex v6 : 59
+v1 +: 25 * 'x'
+shw v4
+v4 : 'a'
+v2 : 'y'
+v6 : (v1 + v6 - v2 + '0') - ((-4 * v1) * v6 + v1)
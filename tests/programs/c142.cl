@@ -0,0 +1,16 @@
+flex v0 : 47 / 32
+flex v1
+chr v2 : v1
+nmbr v3
+chr v4 : -19 + (63 - 'b') / v0
+flex v5 : v0 - (v2 - '9') * ('c' - v1)
+nmbr v6 : 'A'
+shw 'a'.v4."s0"."s9"
+shw "s8".v1.((v3 / 'y' * 36 / -16 / v1 / (v1 + v2))).v4.v5
+shw (113).v6
+v0 : 80 / v3 + 'a' * ('A' / v6 * v2 * v0)
+v2 -: (74 * 'Z' + 80 - 16)
+shw v3
+v5 : (v2 * v1 - v6) * (v5 * (33 / v1))
+v4 : (v5 + v5)
+v2 *: (('c' - v0) + (32 * 66)) + 'b'
@@ -0,0 +1,12 @@
+nmbr v0 : 84
+chr v1 : v0
+chr v2 : 'y' * v0 + 62 / 110 - v0 / 77 * v0
+nmbr v3 : 'c'
+shw "s0"
+shw "s7".v1."s0".v3
+v0 +: (v1 - v1 + v2) - 69 * v0 * '0'
+v2 : 51
+v1 : (v0 - (59 - v2)) + v1 / v2 * v1
+v0 : v3
+shw "s1".90.v1.v0."s7"
+shw v1."s6".v0.v0
@@ -0,0 +1,15 @@
+nmbr v0 : (99 / 36 + ('y' - 46) - (92 / 29 - ('y' * 94)))
+flex v1 : 22 / 76
+nmbr v2 : -5 + v1 / 45 + 34 + v1
+nmbr v3 : ((v1 / v0) - v1 * (v0 - v2 / v1))
+flex v4 : (v1 - v0) - ('9' * v1) * '0'
+chr v5 : (v4 - v0)
+shw "s1".v2.'9'."s2"
+shw "s4"
+v1 -: 39
+v2 : (15 * v0)
+v2 : (v0 + v1 * (v1 / 'z')) + v0
+shw (v0 - 67 - 35 - 'Z').v3.v3.72.v0
+shw (v3).v3.v0."s1".((('0' / v4 / 'y' / v5) - v1 / 'y' / 'Z' * -17))
+shw v0
+v1 : v1
@@ -0,0 +1,16 @@
+flex v0 : 100
+flex v1 : 'a'
+flex v2 : v0 * 'c' + '9' + 90
+chr v3 : v0 / 45 - v0 / v2 / ((26 * v2) / v1)
+nmbr v4 : v3
+nmbr v5 : v0 - 'b' * -15 + 15
+v3 +: 'b'
+v0 : ((v5 + 38 - v2) - (101 / v5 * v0))
+v3 : ((34 * -8 + (v4 + v1)) - ((v0 - v4) - v4 + 12))
+shw "s5".v3.(-8).v2."s4"
+v0 : v2
+v5 : 91
+v1 : v0
+v5 *: v1 * 'A' - (v0 + v5) + (v0 / v2) / v3
+v3 -: (84 - 'A') - 'a' + v4 + v4
+v2 : v3
@@ -0,0 +1,15 @@
+nmbr v0 : (1 + 85)
+flex v1 : ('Z' + 'A' + (v0 - 'A')) * (17 / v0) / v0
+chr v2 : v1
+nmbr v3 : ((v1 / 'Z' * v2 / v0) * v1)
+shw "s7".v2."s7".v1."s2"
+shw v0
+v3 /: v1
+shw "s0"."s5"
+v0 : 4
+v3 : ((v0 / v3) / v1 / v3 - (v2 / 'a'))
+v1 : (96 + 34 - v0 / '0')
+shw v0
+v2 : v3 / ('c' + (v3 - 'A'))
+shw 'A'.v2.((((v3 * '9') + (v0 * v2)) - v0)).v2."s0"
+shw v0.v3."s8"."s1"."s0"
@@ -0,0 +1,15 @@
+flex v0 : (97 * 98) - (31 * 'x') / (28 * 27) - 104
+nmbr v1 : v0 + 68
+nmbr v2 : (16 - '0' * v0 / 109 + 59)
+flex v3 : (v0 + v0 * v0 - 41 / v0 * 'A' * 109)
+nmbr v4
+flex v5 : (v1 / '0')
+chr v6
+v3 : v0 - '9' + v4 * -15 / 'z'
+v2 : ('9' * (90 + 'y') - 33)
+v5 : (v2 * 117 + v0 + 'Z')
+v2 : (70 / v0 - 0 * v5)
+v4 : v1 - 77 / v3
+v5 : v4
+v0 : v3
+shw v1.v1.v4.v2.v6
@@ -0,0 +1,11 @@
+flex v0 : 29 * -1 / (84 - 76) + 'z'
+flex v1 : v0
+chr v2 : v1 * v1 / 19 / ('y' - 'A') * v0 * -8
+flex v3 : (v0 / 'a' * v0 / v2 / v0)
+chr v4 : (-5 - v1 * 'A' * (v0 + v3))
+nmbr v5 : 'c' + 'Z' - v3
+v5 : (v3 + v3 - 'z' - (v1 - v4 - v2))
+v1 : 35 / v0 * 'x' + v1
+v0 : v1 / 119 / v0 + v3 / v1
+v4 +: '9' - (v4 + v0) - (26 / v4)
+v5 -: ('x' * v5 * v4) - (v5 / 76) + v4
@@ -0,0 +1,12 @@
+nmbr v0 : 25
+flex v1 : v0
+nmbr v2 : v0
+v1 : (v2 / v1)
+v1 : -13 - ('c' / v0) * (v1 + v2) - ('a' - 46)
+v2 -: 'a'
+shw v1
+shw v1
+shw "s5"
+v0 : -12 / ((v1 / 'a') * (v1 - v1))
+v1 : 30 - (42 - v0) * 20 - v1
+shw v0
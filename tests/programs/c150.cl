@@ -0,0 +1,13 @@
+chr v0 : 21
+chr v1 : ('Z' * ('c' / (v0 - 103)))
+nmbr v2 : v1
+chr v3 : v1 / v1 * 'a' + v0
+flex v4 : v0
+shw 'b'.54
+v3 /: ('A' - v2)
+v2 : ('x' / v4 / v2) + v1 * -17
+v3 +: (v4 - v2 - v2) - v3
+v3 : v2
+v3 *: 62
+v3 : v1
+v2 -: v3
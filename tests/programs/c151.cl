@@ -0,0 +1,14 @@
+flex v0 : 'z'
+flex v1 : (10 - v0 / (v0 - v0) + v0)
+nmbr v2 : (v1 / 38 + (57 / 100)) / 104 + v1 + (v1 - 6)
+flex v3 : v1
+nmbr v4 : ((v0 * v2) / 107) + (v0 - v0 / 27 * 36)
+flex v5 : ((15 + v1) - v1 - 'Z' + (v4 - v1) * v1 / v3)
+v1 : v4
+v2 : v1
+v3 : 101 - 'z' + 'Z' / v4 * v3 + v1
+v5 -: v4 - v3 + v1 * (v3 + v2) + (109 * 26)
+shw v0.v3."s6"."s3"
+v1 /: v2 - (48 + 35 * 69 + 'Z')
+v4 : v3
+v2 : 11
@@ -0,0 +1,9 @@
+flex v0 : (105 + 97) + 119 + 57 + ((5 / 'b') * -18 - 29)
+nmbr v1 : ((38 * 115 * v0) + v0 / '9' / 'x')
+flex v2 : v0
+nmbr v3 : v1
+flex v4 : v3 / v0 / (v1 * 'a')
+flex v5
+v2 /: ((59 - 114 / 'c' * v5) * (v4 - v1) + v5 * 'z')
+v5 *: v3
+v0 *: v0 / v5 - '9' / v2
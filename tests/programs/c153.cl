@@ -0,0 +1,10 @@
+nmbr v0 : '0' - 32 * -2 - 44 / 85 * 22 / 23
+flex v1 : v0
+flex v2 : v1 + '9' / v1 - v0 * 'a' * v1 + 10
+nmbr v3 : (v0 + v2 - 'x' - v1 / -20)
+flex v4 : v1
+nmbr v5 : v1
+v4 : v2 / v4 + (31 - -16) * (v4 - v3 - 20)
+shw v3
+v0 : v5
+shw (((v5 + v0) * -10 * ((-17 * -8) + v5)))
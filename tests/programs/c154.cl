@@ -0,0 +1,10 @@
+chr v0 : 95
+chr v1 : ((118 + v0 / 'c' * 70) + ('y' / (v0 - 'b')))
+flex v2 : -16
+chr v3
+v3 : ('a' * v3 - 'Z' / v2)
+shw "s2".v1."s8"."s8".v3
+v0 : 'c'
+shw (v3)
+v1 : 32
+v3 : 'b'
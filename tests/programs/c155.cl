@@ -0,0 +1,19 @@
+flex v0 : ('a' * 114) / 'b' / (33 - 35)
+chr v1 : ((v0 + 25) / (v0 / v0) * v0 - -5)
+flex v2 : v0
+chr v3 : (v0 * v1 / v2) / 116 + 107 / 109 - v0
+chr v4 : v1 / 109 / v1 * 'z' / 'y'
+flex v5
+chr v6 : (42 - (-9 + 'A') * (v0 + v3))
+shw v4.v3.v0.v3.v2
+v5 : (v0 - (68 - 37 / (v6 + 100)))
+v5 /: (66 - v3)
+v2 : '9'
+v4 : (43 * ('A' - v4 - v6))
+shw ((v6 / v2 * v0) / 93).v5
+v4 : (((v3 * 86) / v4) / (v1 / 'x') / 36 / v0)
+v1 -: 23
+shw ((v5 / v0 - (v4 / v0)) * v1 + v6 + v1).v6
+v4 : 'Z'
+v3 *: v3
+v2 : 72 - 'z' * 60 / 101 * v6
@@ -0,0 +1,9 @@
+chr v0
+nmbr v1 : 'c'
+flex v2 : (v1 - (('z' + v1) / (v1 - 'y')))
+chr v3 : '9'
+nmbr v4 : (('0' - 'z') + 65 / v0) + (-17 * v0 / v2 / v1)
+nmbr v5 : '9' * 69
+v4 : (65 + (v2 + v5 - v0 * v0))
+shw "s9"."s6"
+v2 : v2
@@ -0,0 +1,11 @@
+chr v0 : 39
+chr v1
+nmbr v2 : (80 + v0 + -14 * (75 * '9'))
+nmbr v3
+chr v4 : v0
+flex v5 : 74 * (('c' / v4) - v3 + -3)
+chr v6 : v3 * v0 * '9' + 32 - v3 + v4
+v0 : (((v5 + v3) * '9') - (v1 / -8 * '9'))
+v0 +: 55 + ('z' - 94 / 58 * v5)
+v1 : (v1 / 52 + ('A' * 115)) + (67 / 39) / (89 - v5)
+v6 +: (40 + '0') / (v4 - 111) + (v1 * v2 + '9')
@@ -0,0 +1,7 @@
+nmbr v0 : (('a' + -8) / (-6 * 40)) * 15 - '0' + 59 * 44
+flex v1 : (v0 - 91 + 'x' - v0) * v0
+flex v2 : v0
+chr v3
+v0 : 95
+v3 : 'x' + 'z' * 118 - ('c' + 85 + v3 + 'A')
+v1 : v1 + 0
@@ -0,0 +1,9 @@
+nmbr v0 : '9'
+nmbr v1 : ((v0 - v0) * 34 / 67 + v0 - v0)
+nmbr v2 : v1
+flex v3 : (v0 / (1 + v1 / v2))
+flex v4 : 0 - v2 / v1 * v1 * (v1 / v0 * (v2 + '9'))
+nmbr v5
+v4 : v1
+v5 *: ('y' / ('Z' * v2 + v2))
+v1 : 112 + 'b' / 'Z' / v2 + v2
@@ -0,0 +1,14 @@
+flex v0 : 113
+chr v1 : (v0 * v0 * ('x' * v0) / (v0 + -20))
+nmbr v2
+shw v2."s9".v1."s8"."s1"
+shw v2
+shw "s0".v0."s7"
+v0 : 'Z'
+shw v0.(v2)
+shw v2.v2
+v1 : 'Z'
+shw v2."s6".((v1 * v0 + v0 - v1))
+v1 *: v2
+v1 : 'A' - (85 - (v0 - v0))
+v0 *: (v2 + v1 / 119 / v2)
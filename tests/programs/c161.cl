@@ -0,0 +1,11 @@
+nmbr v0 : '9'
+chr v1 : v0 + -19 + v0 * v0 / v0
+nmbr v2 : v1
+nmbr v3 : (('y' + '0') - ('x' * v2)) / 39 + 73 / -7
+nmbr v4 : (v0 - v2 - 75)
+flex v5 : v0
+flex v6
+v0 : (15 / v5 * 'A')
+v6 : 'Z'
+shw v3.52.v0.'Z'
+v3 : 99
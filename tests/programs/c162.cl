@@ -0,0 +1,12 @@
+flex v0
+nmbr v1 : v0 + (v0 + 50) * 'c' - v0 + v0 * 'A'
+chr v2 : (-13 - 75 + '9' * 59 - ('y' / '9'))
+v2 -: 71
+shw v1."s9"
+v2 : v1
+shw v2
+v2 +: v0 - (v2 + v0 - v1 * v0)
+v0 : v1 + ((v2 * '9') * 'A' - 83)
+v2 +: ((-14 / (v2 - v0)) - (v2 / v1) - (v1 - v2))
+v1 : (v0 * v1) + v0 - v1 - ((v2 * v2) + 68 / v2)
+v0 +: v0
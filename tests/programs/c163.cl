@@ -0,0 +1,15 @@
+flex v0 : (15 * -3) / 'b'
+nmbr v1 : v0
+flex v2 : 73 - v0 + v0 / v0
+nmbr v3 : v0 * v0 * v1 - v0 * -6 + v1 + v0
+chr v4 : 60
+nmbr v5 : 'x'
+flex v6 : ((v2 / 'a') + 15)
+shw v3.v1.v3.v5.(v2 - ('c' - v5 / 'A' / 'x'))
+shw v6."s1"."s5".v4
+v4 : v2
+shw v2."s7"
+v1 : 118
+v2 : ('Z' / v3 / 'y' * 81) + (v6 / (v2 * v1))
+v0 : v3 + 73 * v0 + 86 - (v1 * v3) * 53
+shw "s8".v1."s8"."s2"
@@ -0,0 +1,9 @@
+flex v0 : (-19 / 58 - 8 / '0')
+nmbr v1 : v0 + '0'
+chr v2 : v0
+shw "s0".v0.v1."s2"
+v2 *: v0
+v1 : 92
+v1 *: 'x' - v2
+shw (59 - (v0 - 'A') - (v1 / v1))
+v1 : v1 - v0 / (55 + v1) / ((v1 - v2) * (v1 - v0))
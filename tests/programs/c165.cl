@@ -0,0 +1,9 @@
+nmbr v0
+chr v1 : v0
+flex v2 : v0 - v1 / v1 + 47
+v2 : v2 - ((v0 * v2) + v2)
+shw "s1".v2.v0.v1."s0"
+v1 : ('y' + v2 - '9')
+shw v2."s2"."s0"
+v1 +: v2
+shw 38
@@ -0,0 +1,7 @@
+flex v0 : (31 * 'a' / 'A') * 110 - 95 * 99
+nmbr v1 : 0 + v0 * ('0' / 'z') - (v0 * '9') * 115 - v0
+nmbr v2 : (('0' - v0) + v0 + v0 + 'A')
+chr v3 : v0
+v2 : '0'
+shw v1.v1."s4"
+v2 : v2 / 95 / 'c' + (61 - v1)
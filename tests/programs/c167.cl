@@ -0,0 +1,16 @@
+nmbr v0 : 'b'
+flex v1 : (3 - 'A') / ('b' * v0)
+chr v2 : v1
+nmbr v3 : (('9' - v0) * 'b' - (v1 / v2) - -18 * v2)
+v1 +: ((v3 * v3) * 20 - v2 - (v1 * v0))
+v2 /: (v1 + (v2 - 43 + ('Z' * 'b')))
+shw ((-16 / v3 - 93) / (v2 * v2 + v1))."s1".v1.v2
+v0 : -19
+shw v3.v1.v2
+v0 -: v1
+v1 /: v0
+v3 : ((v1 - (53 * 'y')) - '9')
+v1 -: v3
+v3 : 27 + v1 - v2 / 102
+v0 +: ('A' + '0' * v0) * v3
+v3 : v2 * v1 / 'x' - 71 + 'a'
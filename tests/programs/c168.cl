@@ -0,0 +1,15 @@
+flex v0 : 30
+flex v1 : ('A' / v0 * v0) - v0
+flex v2 : (v0 + -19) / 'c' / 'z' * v0
+v0 : '0'
+v0 : '0'
+shw v0.v1."s4"
+shw v0
+v2 : v1
+v2 : '0'
+shw v1.v1."s1"."s4".'x'
+v1 : (v1 - '0' + ('b' * 62) / (v0 + v1))
+v2 : 25
+v2 : v2
+v2 : 37
+shw v2."s6".107.v0.v2
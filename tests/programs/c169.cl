@@ -0,0 +1,17 @@
+flex v0 : (((33 * '9') * (16 + 109)) + '9')
+nmbr v1 : ((v0 - v0 * v0 - 58) * v0 / v0 - v0)
+chr v2 : ((v1 - v1) + v0 / v1 + ((119 + 102) + v1))
+chr v3 : v2
+flex v4 : (v0 / 7 / (v3 / 47)) + 'z'
+v4 : (v0 * 37 + 20 * v2 / 24)
+v2 -: (v4 - 54 * v2 * (81 / 89 + v3))
+shw "s0".(98)."s8".v0
+shw v0."s8".v3
+shw v0."s6"
+v0 : v0
+v4 *: v2
+shw v0.v3.47
+v0 : v1
+shw "s6"."s9"."s3"."s0".v2
+shw v4.v4.v3
+v4 : 'a' + 'A' / v2 + v3
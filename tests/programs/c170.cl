@@ -0,0 +1,17 @@
+flex v0 : 11
+nmbr v1 : 'y'
+flex v2 : ('Z' - '9')
+nmbr v3 : ((v0 + v1) + 'b') + v2
+nmbr v4 : 'y' - 'a'
+shw v4
+v0 : (-13 - ((67 + 75) + 30 + v1))
+v2 : ((v1 + v4) * (v3 * v2)) * 'y'
+v0 : 105
+v1 +: 0
+v2 : v1
+shw v3
+v0 : v0 / v0
+v1 : (v1 / 113) + ((v4 + 'c') - 'z' / v3)
+shw v0.v2.v2."s7".v3
+v4 : (v4 / v4 * (v0 + v1)) * ((v4 / 73) / v0)
+shw "s3".v1.v3
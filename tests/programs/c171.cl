@@ -0,0 +1,19 @@
+chr v0
+nmbr v1
+chr v2
+nmbr v3 : v0
+nmbr v4 : v0 - v2 * 'b' - (-14 / v1) / ('0' * 'x')
+flex v5
+flex v6 : ('Z' * v4) - (v0 / v5) / -14
+v0 : 'Z'
+v4 : v0 / (v1 * v0) * (v5 / v4)
+v1 : 'b' - (v5 * 82 + (v5 - '9'))
+shw v1
+v5 : v3 + v6
+v0 : v3 * v6 * 21 * v6
+v1 : (((v5 + 2) - v1 / 'y') / 15)
+shw "s6".(v0 / ('9' * v6) + ('Z' + v2) * -16 - 23)."s3"
+v0 : '0'
+v0 *: v6 - v6
+v2 : 70
+v6 +: (v3 * 'a') * (v3 * 20) - (v4 * 'b')
@@ -0,0 +1,10 @@
+nmbr v0 : ((-8 - 56 / 115) + 68)
+nmbr v1 : v0 / v0 / '9' / 'a' / (58 - v0) / v0 - v0
+chr v2 : (v0 + (v0 / ('b' - v1)))
+flex v3 : (v2 * (v2 + -15 * v1))
+chr v4 : (v1 + v1 * v1 - v2 - v3)
+shw v4
+shw "s2"."s3"
+v2 : ((v2 * v0) - ('A' + v0) - 'x')
+shw "s2".v1.v1
+v2 : v1
@@ -0,0 +1,9 @@
+chr v0 : (-19 + 95 - -1 - -20) * 77 / (23 + 0)
+flex v1
+chr v2 : 97 + v1 * 91 + 'y' * (v1 / v1) * v0
+flex v3 : 10 * v0
+flex v4 : 'y'
+v1 : v3
+v1 : 8 / v0 * '0' / (v2 * v3)
+shw v3.v0.v2.v0."s4"
+v0 : v4
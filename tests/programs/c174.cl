@@ -0,0 +1,9 @@
+chr v0
+chr v1 : v0
+chr v2 : (-16 * v0 * v1 * v1) + 22 + 72 - v0
+v2 : ('c' / v0 - (91 * v0) * (56 - v2 * v0))
+v2 : (89 / v1 - v0 + (89 * v2))
+shw "s4".v0.v2.v1."s1"
+v2 : v1 / v0 * v0 / -20
+v2 : ('z' * (v1 + v0 * 'z'))
+v2 : 54
@@ -0,0 +1,13 @@
+nmbr v0 : -12 / 26 + 99 * 69 - (-9 + 68) / (78 * 48)
+chr v1 : (v0 * v0)
+nmbr v2 : v0 / v0
+flex v3 : 87
+chr v4 : (85 - v2 * v2)
+flex v5 : 'y' + (102 + v1 + v2)
+shw v2.v3.v0.v1
+v4 : (v2 * -17)
+v0 -: v4
+v1 +: v1
+shw "s6"
+v1 : 65 / (v3 * v5) - -18 - -1 - 81 / 7
+shw "s5"."s5".v4
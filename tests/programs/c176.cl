@@ -0,0 +1,13 @@
+nmbr v0 : 78
+flex v1 : ('y' / v0 * v0 / v0)
+nmbr v2 : (v1 * v1)
+v0 : 'z'
+v1 *: (('y' * v1) + ('y' + (25 - v0)))
+shw 0."s3"
+v1 : 'A' - v1
+shw (1 * 'Z' * (v1 / v1))."s9".((0 + ('Z' - v1)) - (v1 + 111) - (28 - v0))
+shw (v1).v2.v0."s1"."s4"
+v0 /: 27 * (120 * v1 - v1)
+v0 : v2
+v2 : (v1 * v1 - 'b' - 'x')
+shw v2.(('z' + v2) / v2 - v2 + 77 * v1)
@@ -0,0 +1,8 @@
+chr v0 : 'A'
+nmbr v1 : (v0 + 'z' * 'b' / 'b') * (v0 + 'z') - ('z' * -17)
+flex v2 : -7
+chr v3 : 64 * 94 + v1 * v2
+v2 *: 44
+v2 : 101 * 73
+v3 : 40
+shw "s5"."s0".v3
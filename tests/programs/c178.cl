@@ -0,0 +1,8 @@
+flex v0
+flex v1 : ((v0 - v0 * v0) / 'y')
+flex v2 : ('a' * 'x' * 118 / 'z' / v0)
+v2 : 'z' / 52 - 44 / 86 * v1
+shw "s9".(v0)."s4".v0
+v2 : ('A' + ('a' - ('y' + v1)))
+shw v2
+shw v0.v2
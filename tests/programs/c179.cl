@@ -0,0 +1,10 @@
+nmbr v0
+nmbr v1
+chr v2 : 'y'
+nmbr v3
+v3 : (v2 - v2)
+v3 : -7
+v0 /: -17
+shw v1.v1.(((-11 / v2) / (v0 - v0) - v1)).v1.v2
+shw "s2".v2.v1
+shw v1.v0
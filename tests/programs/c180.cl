@@ -0,0 +1,11 @@
+nmbr v0 : (10 / 29) + 101
+flex v1 : -5
+nmbr v2 : 109
+flex v3 : (((v0 - 'A') + (v2 + 85)) * v0 * v1 * v0 * v0)
+shw v0."s5"
+shw v0
+v1 +: (('x' + v2) * v0 / v2 - (49 * v1))
+v0 : '0'
+v3 : (v0 * -17 + (v0 / 'z')) + v3
+v1 : (v0 / v1 / v2) + 'a'
+v3 +: (v2 + 'y' - v2 - 'A') * (v3 * v2) / 'y'
@@ -0,0 +1,14 @@
+flex v0 : 29
+chr v1 : v0
+nmbr v2 : 'y'
+chr v3 : 72
+chr v4
+chr v5
+nmbr v6 : 12 / 'c' / -9 / '0'
+v3 : (v5 - v3 * v5 * v1 * (v5 + v5))
+v0 : (72 * (v6 * 'b' + v5 - v5))
+v3 : v1
+shw v3."s1".v5.v3
+v2 : ((v0 - '9') * 63) + 'Z' / v6 * (v5 / v2)
+shw v4.v5.((v3 / 'b' * v2 + v4) / 62)
+shw v3.v6.v5
@@ -0,0 +1,14 @@
+chr v0 : ((109 * 50) + -13 * 116 - -15 - 13)
+flex v1 : ((v0 / v0) - 'A' / (v0 - 'a') / (v0 - v0))
+flex v2 : 'z'
+flex v3 : 83
+flex v4 : v2 * 52 / v0 / v2 + (v2 + 49)
+nmbr v5 : v1
+v0 : v4 - (v0 - v3) + 1 + 44 - v0
+v4 : (103 + (v5 * 48))
+shw v0."s7".v4.v0
+shw "s1"."s4".((('A' - v1) + 'x' / v5) + (v0 / 4) - v2).v5.v3
+v4 : v0
+v3 +: v4
+shw v3.v4
+v2 : (79 - v4 - 6) / ((v1 + 90) + v5 - 12)
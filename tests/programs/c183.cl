@@ -0,0 +1,14 @@
+nmbr v0 : 36
+nmbr v1 : -12
+nmbr v2 : ((85 + v0 + 'A' * v1) - (v0 + v0 / -3 * 'x'))
+v1 : v0
+v1 -: 83
+shw v0.(v1)."s8"."s9"
+v0 : (18 * 'z' / v1 * ((v2 + v0) * v1 / v0))
+shw "s3"
+shw v2
+v0 : (('9' + 7 / 'a' - v2) + v0 + 66 + (v0 - v1))
+v1 : 115 / 29 / 'c'
+shw v0.'x'.v2
+v2 : ((v0 * v0) - (65 / v0) + ((-3 - v1) + ('c' * 'z')))
+shw v2.v2.v0."s6"
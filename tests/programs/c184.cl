@@ -0,0 +1,9 @@
+nmbr v0 : ('9' * (51 + 71) - (6 * 118))
+chr v1 : ('A' * v0 + 40) + (56 + v0 * v0)
+flex v2
+chr v3 : 'y'
+nmbr v4 : (v3 * v0 / v3) + (v0 - v2) + (28 - v3)
+shw "s6"."s4"."s6".(v0)
+v3 : 54 + 79 * v4 * v1 / 38
+v0 /: ((84 / 'x') * ((v2 / v3) + v0 * v0))
+v1 : (v2 * -19 + v2) - (v4 / v1) + (v3 * v3)
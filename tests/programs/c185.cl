@@ -0,0 +1,8 @@
+nmbr v0 : ('x' / 116 * 33) / (77 - 13) * -9
+chr v1 : ('z' - (87 - v0 - (102 / v0)))
+nmbr v2
+v0 : 34
+v1 : (v0 / (v1 * 'y')) - 18 + '0' * (-7 / v0)
+v0 +: v2 * 91 - v1 + 56 * 42
+v1 : 37 + (v2 - v2) * ('9' + 'c')
+v2 : 'c' + ((v2 / v2) - 'a' * -4)
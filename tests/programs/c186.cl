@@ -0,0 +1,9 @@
+flex v0 : ((66 + 93) / 14 / 5) / 'b'
+flex v1 : -19
+flex v2 : v0
+nmbr v3 : (('x' * v1 / (v0 - v2)) * (104 + (110 - v1)))
+flex v4 : 105
+v4 +: v1
+v0 : -7
+shw v4
+v4 -: v0
@@ -0,0 +1,15 @@
+chr v0
+nmbr v1 : 42
+chr v2 : v1 * v0 * '0' - 'Z'
+flex v3
+chr v4 : (v3 * v3)
+shw v2."s9"
+shw v0.v2.v3
+v1 -: ((v0 + v3 * (v4 / v4)) + 'y' + (v3 + 105))
+v1 : (v0 / v0 + ('b' - 'A')) * ('b' - v0 + v3 / v4)
+v3 -: v0
+v1 : (v3 + v4 - v2 / v3 - 80)
+shw v4.v4.((29 - 'Z' - v2)).v2
+v4 +: 'x'
+v4 : v1
+v4 : ('c' + 35)
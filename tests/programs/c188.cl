@@ -0,0 +1,12 @@
+chr v0
+nmbr v1 : v0
+chr v2 : v1
+chr v3 : 'a'
+v3 : ('0' + v2)
+shw "s8".v3.21."s9"."s7"
+v1 : (('A' + 44) / 2) + ((v3 / 'x') + v3 + 'z')
+v3 : 'y'
+v0 : ('b' * 'x' * (v0 + '9')) + v2 / 12 * v2 - 28
+v2 *: v3 - 44
+shw "s6"
+v0 : v0
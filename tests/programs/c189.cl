@@ -0,0 +1,12 @@
+flex v0 : (31 + -11 + 96 + 37)
+nmbr v1 : (v0 * v0 + 25 / v0 - v0 + 11)
+flex v2
+chr v3
+chr v4 : 40 + '0' * v1 * v3
+flex v5 : v0
+v0 : v5 * v0 + v5 - 24 + 107
+v3 : v3 + (v1 / '9' + -10)
+shw v5
+v3 : (v1 / (v1 * 68)) + 18
+v4 *: '9'
+v2 : 'Z' / ('c' * v2) - v0
@@ -0,0 +1,14 @@
+nmbr v0 : (-2 - '0')
+flex v1 : v0 * 'Z' + 11 * 76
+nmbr v2 : (((50 - v0) / 'b') / '0')
+shw v1.v1
+shw v1."s0".v2."s6"
+v1 *: v0 / v1 - v2 / v0
+v0 : 111 - 3
+v2 *: 'y' * 72 / 20 / v0 * v0 * v2 / v0
+shw v2
+v1 /: (v1 / v2 - '0' - 98 * 10 / v1 / 48)
+shw (((v0 + v1 / 'A' / v2) / v2))
+shw "s3"."s8"."s4"
+shw v0."s3".v0
+v0 : 119 * 42 * 21 + 79 / 'y' * v2 / 58 * 'Z'
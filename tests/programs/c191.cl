@@ -0,0 +1,18 @@
+flex v0
+flex v1 : v0 / 37 + 'a' * ('y' * v0)
+flex v2 : ((v1 - v1) * (v0 - v1)) - -15
+flex v3 : ('b' + ('A' + v0)) * 85 * (51 / v2)
+chr v4 : v2
+nmbr v5 : v2 + 'a' / 73 - v0
+nmbr v6 : 'b'
+v0 /: 108
+v5 : ((v0 / (v2 - v3)) / v1 - 59 - (-4 + v0))
+v2 : 'z' - 89 * 39 - v5
+shw "s4".v6.v1.v3.v4
+v1 : ('z' * '9') - 106
+v3 +: ((v3 + v4 - v2 - v4) - (53 * '9' + (v6 - 71)))
+shw v2.v4.(('9' - v0 / (v6 + v0 + 112 / v6))).(v6 + v1 / v2 - v6 - 'z')
+v1 +: v3 * v6 + v1 / ((v3 + '0') * 39 * v0)
+v5 : (v3 + 'a' + v6 - 56 + 'z')
+v2 : (v2 - 'b' / -16 - ('z' * (101 - 47)))
+v0 : v3 / v6 + v1 / v2
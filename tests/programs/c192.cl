@@ -0,0 +1,11 @@
+chr v0 : 89
+chr v1 : ((v0 * v0 - 'x' - v0) - ((6 * -7) - ('y' - v0)))
+flex v2 : v1 - (v0 + 'Z') * 57
+nmbr v3 : (v1 / 24 - 108) + 63 + (v2 - v2)
+flex v4 : v3
+v2 /: (((49 / v2) + v2) + (98 * v3) * ('Z' / 'b'))
+v0 *: ((v4 * v1) - 'c' - (v2 - 105))
+v3 : (96 + -16 * v1)
+v1 : 'Z' + v2
+shw "s6".(28)."s2".v2.'b'
+v2 : 2
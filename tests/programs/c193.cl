@@ -0,0 +1,10 @@
+chr v0
+nmbr v1
+flex v2 : ('0' + v1 / 68 - v0 - v1)
+nmbr v3 : (v2 * v2 * v1) + 'Z' / v1 * 82 + v2
+nmbr v4 : v0
+flex v5 : (v1 / v3 + 114 - 'z' - v3 - v3)
+flex v6 : (46 / v4 - 77 + v2)
+v3 : v5 / 33 / '9' - v5
+v1 /: 23
+shw "s0".v0
@@ -0,0 +1,10 @@
+nmbr v0 : (84 / 7 / 35 + 17 * 97 - 'Z')
+nmbr v1 : (20 / 69 / (v0 * v0))
+flex v2 : 3 / v0
+flex v3 : v2 + v2 * 'x' - v1 - 108 / v1
+nmbr v4 : 62 * 80 - 'x' - v0
+nmbr v5
+chr v6
+v6 : 64 + v2
+v3 : 117 - v1 / v2 * v5 * v4
+v0 +: ((v2 * v5) * v6 + 'x' - ((59 + 81) - v5 / 33))
@@ -0,0 +1,15 @@
+chr v0 : 33
+chr v1 : 30
+flex v2 : v1
+flex v3 : (('a' + v2 + (v0 - v2)) - 87)
+flex v4 : ('a' - 94)
+nmbr v5 : ((v0 + v2) - 102 + ((v4 - 'b') - v2 / 'z'))
+chr v6 : v1
+v5 : 'x'
+v2 /: v5
+v5 +: v3
+v2 *: v2
+v5 : ('Z' - 'y')
+shw v5
+v2 : (35 / (v0 / (v1 * v4)))
+v4 : v1
@@ -0,0 +1,19 @@
+flex v0 : 'A'
+flex v1 : '0' + v0 - (v0 / v0) * v0 - v0 + 71
+flex v2 : ((3 * v1) * 'a' + 107)
+flex v3 : (((v0 * 'Z') / v1 - v2) - (v1 * 'c' / 11))
+flex v4 : (((v2 / 30) * (113 * -14)) + 'c' + v2 + 36)
+flex v5 : ('Z' * (v2 + v3)) - v0
+flex v6 : 109 * 'c' + 'y' + 3 - (16 + v0 / '0')
+v4 +: v5
+v6 : '0' - 112 / (27 - 'a') / v6
+shw ((2 - v1))
+shw v4
+shw v5
+v1 -: v3
+v1 : (27 * v2) - 80
+v0 : (-5 + v2 / (0 - v1)) - 85 + v2
+shw v6
+v1 : ('9' + 1 - v4 + '0' * 15 * 45)
+v5 : v2
+v1 *: ((15 / 97) - v6 - 'Z' - v5)
@@ -0,0 +1,16 @@
+nmbr v0 : 10
+nmbr v1 : (v0 - v0 / v0 + v0) - (107 * (v0 + 'z'))
+flex v2 : ('A' * v0 - v1 - v1 - v0 / 19)
+flex v3
+flex v4 : v1
+nmbr v5 : v4 * ('x' + 'Z')
+flex v6 : v4
+v5 : (118 * 115)
+shw "s6"."s9"
+shw "s1".(('z' + v5))."s0"
+v5 : (v5 - 'x')
+v6 : 5
+v6 : v0
+shw "s5".(v3 - 51 / ('A' + v1))."s1".v4.v5
+v4 : v0
+v6 +: v3
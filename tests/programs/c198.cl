@@ -0,0 +1,9 @@
+flex v0 : 102
+chr v1 : v0
+nmbr v2 : v0 * (v0 - v1 + v1)
+shw "s6"."s8"
+v2 : 'Z'
+v1 : ((v0 + '0') - v0 / 9)
+shw "s1".v2."s1".(119 / (v1 - (v1 * v2)))
+v0 : v0 / v1 - ('A' * 103) * v0 / 'c' - 60
+shw "s0".v0.v0.v2
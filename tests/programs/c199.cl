@@ -0,0 +1,8 @@
+flex v0 : -18
+chr v1 : v0
+flex v2 : ((113 - v1 - v0) / 'y')
+nmbr v3
+flex v4 : ('a' / (-17 + 'z') - v0 / 109 + v3)
+shw v2.(v2).v4."s3"."s6"
+v0 : ((v2 * ('9' + 'A')) - (-13 - 'z') * 'c' - 116)
+v4 : 'c'
@@ -0,0 +1,6 @@
+nmbr v0 : 48
+nmbr v1 : ((10 - v0) / v0) + (v0 / v0 - 17 * 'x')
+chr v2 : (v0 * 72 * v1) / (v0 + v0)
+shw "s3"."s8".v1
+shw "s7"
+shw v0."s4".v0
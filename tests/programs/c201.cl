@@ -0,0 +1,6 @@
+flex v0 : 100
+flex v1 : (102 / v0)
+nmbr v2 : v1
+shw v2.v1.v2.v1
+shw "s7".v1
+shw "s2"
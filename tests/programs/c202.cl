@@ -0,0 +1,11 @@
+flex v0 : (115 / 40 + 'z' - 88 - (106 * -9 + 5))
+nmbr v1 : v0
+flex v2 : 'y'
+flex v3 : v1
+nmbr v4
+nmbr v5 : (v4 * (v1 * -17) / 'c' * 107)
+v5 /: v0
+v5 : v4 - ('b' + v0) / v0 + (107 * v5)
+v0 -: v0 - 'A' / 104 + v0
+shw v4."s3".v2.v4
+shw ('0' / v2).v4."s1"
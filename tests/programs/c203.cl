@@ -0,0 +1,11 @@
+nmbr v0
+flex v1
+nmbr v2 : (13 * v1 + v0 / v0 * 'A' + (v1 - v1))
+v0 : 'c'
+v0 : v1
+shw "s2".-12.v0.'z'.v2
+v0 : v1 / 'Z'
+v0 /: v0
+v2 +: v0 - (v1 + 85) * v0 * v2
+shw v0."s4"."s3"
+v1 : v2
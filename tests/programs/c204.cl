@@ -0,0 +1,10 @@
+nmbr v0
+nmbr v1 : (63 * (114 / 'c' + 'x'))
+chr v2 : v0 * (v1 / '0') - v1 * v0
+nmbr v3
+chr v4 : 'y' + v0 * 'Z' / (v3 * 'b' / v2 * 25)
+chr v5 : v1
+v3 : (97 * (51 - v5 / 'Z'))
+shw 'a'
+v2 : v2
+v3 -: v1 * (v0 - 'c') + v2 * v1
@@ -0,0 +1,10 @@
+chr v0 : ((38 - 31 - 62 + 50) / 37)
+flex v1
+flex v2 : 9
+chr v3
+chr v4
+flex v5 : 'x'
+shw v2.(v3 * v2 - v0 - v2 + (v4 * v1)).(v2).v1.v2
+v3 +: ((42 - v5 * v3) + '0' / ('a' - v1))
+shw v2."s4"
+v4 : 'a' - v5 / (v1 + 'x' - v4 - 52)
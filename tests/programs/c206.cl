@@ -0,0 +1,14 @@
+nmbr v0 : 114 - 14 - 58
+nmbr v1 : 73 * v0
+nmbr v2 : ((v1 + ('c' / 'b')) + v1 / -11 + v1)
+v2 : v0
+shw v2.v2.v0.v1.v0
+shw v1
+v1 -: ((v2 * v0) - v0)
+v0 *: v2
+v0 /: '9'
+shw (((2 + v2) * v0 * (('y' / 108) / 6 * v0))).v1.v0
+shw 112."s8"
+shw "s2".v0.v0
+v1 : '9'
+shw v2
@@ -0,0 +1,16 @@
+flex v0 : ((104 * 'a') + 97) - (110 + 5) - (12 * -6)
+chr v1 : ('0' - 52 - ('Z' * v0)) * (v0 * (95 / 'b'))
+flex v2 : ((v0 * v0 + 101) / 'A')
+nmbr v3 : (('c' - ('0' - v0)) * v0)
+nmbr v4 : (35 * v3 - 92 * '9' * (v0 / v2 + v0))
+nmbr v5 : (114 + v2 + v2 + v3)
+nmbr v6
+shw v3.v2.v6
+shw v6.v1
+v2 : (v3 + 103 * v5 - v4)
+shw (61 + (('A' + v3) / (16 + 'a')))."s5"."s9"
+shw "s6".61
+v2 /: v2 * v1 * 'c' / (v3 + v5)
+v5 /: v2 + v3
+v5 : 'b'
+shw v4.v5
@@ -0,0 +1,10 @@
+flex v0 : 45
+flex v1 : v0 / '0'
+chr v2 : v0
+flex v3 : 75
+nmbr v4
+shw v2
+v0 -: 80 - 89 * v1 + v1 / v3 / v1 * v0 / v1
+shw v2."s5"."s3"
+v1 /: v1
+v3 : v4
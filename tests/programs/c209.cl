@@ -0,0 +1,18 @@
+flex v0 : -1 * 52 * 105 - 'x'
+flex v1 : ('c' + 16 - -19) - ('z' / v0)
+flex v2 : -13 / 'A'
+nmbr v3 : ('y' * 53) - v2 / v0
+nmbr v4 : (v1 - v3 * v2) / v3
+nmbr v5 : 4
+nmbr v6 : (v0 + (117 / v3) - (v2 - 'a'))
+v1 : v1 + (v6 - 'A' - 18)
+shw v1.v3
+shw ('z' - v5 - v3 + v0 - 'Z' - v2).v5."s5"
+v0 : v6
+shw v4
+v5 -: v0 + v2
+shw v1.v1.v1.v1
+v1 /: 'b'
+v1 -: 'a'
+v6 +: 'y' - ('Z' / 'b' - 'y' + -8)
+v5 : (106 - 63) * ((v1 - v5) + 'b' / -4)
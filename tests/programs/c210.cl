@@ -0,0 +1,10 @@
+nmbr v0 : 14 - 103 + 85 + 'z' / (-1 * 61 * -17 * 'x')
+flex v1 : (120 + v0 - v0 * v0 * 'c')
+chr v2 : (-5 + '0' / v0 - 'x' / v1)
+nmbr v3
+flex v4 : 60 + v0 / v3 * 'y'
+chr v5 : (72 / v3)
+v0 : v5
+v4 +: v1
+v4 /: 74 / -10 + v1 + (v5 * v0 / 113)
+shw v1.v5
@@ -0,0 +1,13 @@
+chr v0 : '0'
+flex v1
+flex v2 : v0 - 'z' / 21 - 113 - v1
+nmbr v3 : 'y'
+flex v4 : (v2 + v2 * 91 / (v3 - v2 + 50 * v2))
+nmbr v5
+flex v6
+v3 : v2
+v6 : v1
+v3 -: (('z' * 115) * (v2 / 'b') * (v3 - '9' / (v2 - v6)))
+shw (103 + 'Z' / v3 + 'A' - v5)
+v1 : (32 + 'b')
+shw v2."s1".v3."s4"
@@ -0,0 +1,16 @@
+flex v0
+flex v1 : v0
+chr v2
+flex v3 : ((21 / v1) + v1)
+flex v4 : 5
+flex v5 : 'x' + ('9' / v2) + (v0 - v4) * 'y'
+shw v3
+shw "s3"
+shw (v1)."s1".((-20 + v0))."s3".v1
+v1 : v1 - '9' * 114 / v4 * 95
+v5 +: 'a' + 9 * (74 / -2) * v1 + -2
+v2 : 'A' * -6
+v3 : (v1 - (v5 - v5 + v2 * '9'))
+v0 : (15 - 26) + (v5 + v3) - 44
+v2 +: 74
+v0 +: v3
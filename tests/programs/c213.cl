@@ -0,0 +1,11 @@
+chr v0 : 110
+chr v1 : ('9' - 55 / v0 - v0 + 'b' / 19)
+flex v2
+nmbr v3 : ('9' * v2)
+shw v3."s1"
+v1 : 'Z'
+v2 : v1 + (v0 * v3 + v0)
+v1 : v3 + v1 - 56 * 114
+v2 : v3
+shw "s9"
+v3 +: v2 + v2 - (v1 - v3) + 25
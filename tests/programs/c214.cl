@@ -0,0 +1,18 @@
+flex v0 : 92
+nmbr v1 : 42
+nmbr v2 : v0
+nmbr v3
+flex v4 : (v3 * 'Z' * v1 - (v3 + v2))
+chr v5 : 'x'
+flex v6 : v4
+v6 *: 'c'
+v3 : ((v6 * (32 + v6)) * ('c' - v6) * v6 / 82)
+v2 /: ((66 + 'a') + v6 / v3 / v4 - 'c' / (89 - v6))
+shw v4.v1.v6
+shw "s2".v0.v5."s2"
+v2 : v3
+v2 : (v3 - '9') - v4 / (v4 / 'A' + -4)
+v4 *: v6
+shw v3."s5"
+shw "s7".v4.v6."s4"
+v4 : 'b'
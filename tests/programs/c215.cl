@@ -0,0 +1,7 @@
+flex v0
+nmbr v1
+nmbr v2 : v0
+v0 *: (85 / v0 / ('x' / v2)) / 'A'
+v1 : -17
+v2 : (107 - v1 + v0) * ((66 + v2) * -5)
+v2 : (v0 - 104 - (v2 - v2)) * 'a' - 86 + 'y' * 'a'
@@ -0,0 +1,16 @@
+flex v0 : ('0' + (51 - -11) + -18)
+chr v1 : (v0 * 'A') + 97 / (v0 + v0) / -16
+chr v2 : 50
+chr v3 : (v1 / v2) * v2 / v1 / (v0 * v1 - v1)
+v1 : v3
+v1 : v0
+v3 -: v0 / 104
+v1 : (((v2 * 21) * v0) * (v0 - v1 * 'a'))
+shw v1."s1"."s6".v2
+v0 : (v0 / v1 / v3) - -5 - '0' / -3
+v2 : 'a'
+shw v1.(v1 + v3 + v3 + v2).v0.v2."s5"
+shw v3
+v1 : 13
+v0 : (v0 + 37 * v2) / ((v3 + '0') / 18 - v1)
+v1 : ('Z' * (v2 * 62) - 'a' - v2)
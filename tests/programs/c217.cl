@@ -0,0 +1,8 @@
+nmbr v0 : (62 + 53 - 'a' / (61 + 21))
+nmbr v1 : 'a' / 67 + v0 / v0 * 60 / v0
+nmbr v2 : 31
+nmbr v3
+nmbr v4 : 106
+v4 /: ('9' - v3) / 'Z' * v3 - v2
+v4 : (((v2 / v4) - v0) / (v4 * 'a' * (v3 + v3)))
+v3 : (v2 + 25) * v1 * 'Z'
@@ -0,0 +1,15 @@
+nmbr v0 : 'a' * (43 * 98 * 14 / 13)
+flex v1 : 'c' / 29
+flex v2
+flex v3 : (72 - v1) + -3 + v1
+nmbr v4 : 'y'
+v1 : (v1 + 'z' - v2) - v0 + v0 + v4
+shw v3."s9"."s3"."s2".v4
+v0 : v1
+shw v3.v0
+v3 : v2
+v2 /: (20 - v3 - (v1 * 10))
+shw v0."s2"."s2"."s6".v2
+v2 : 29 - 80
+v1 : v2
+v3 -: v2 / 53
@@ -0,0 +1,9 @@
+flex v0 : (('a' / 92) + -10)
+chr v1
+flex v2 : (('a' + v1 * v1 + v0) + (v1 * -16) * '0')
+flex v3 : v0
+chr v4 : 43 / v3 * (v0 - v0) / v0
+v4 : ((v4 * 73 / 38 + v1) * (('z' * 29) / 'x'))
+v0 : v4 - '0' / (-20 * v4) + (v1 - v1 + v3)
+v2 : (('y' * v3 * v0) + 'Z')
+shw "s4".v2.v1.v3.v3
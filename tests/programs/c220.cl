@@ -0,0 +1,16 @@
+flex v0 : 105
+nmbr v1 : 'A'
+chr v2 : -1
+nmbr v3 : (v0 * (63 - v2 - v0 - 'b'))
+shw v1.v0."s8"
+v3 /: ((36 + v2) * (v1 - v1)) + 120
+shw v2.v0."s5".v0."s2"
+shw "s0"."s3"
+v1 : 51
+v3 : 106
+v0 : (v0 / 110)
+shw "s0".v0.v2.v1."s4"
+v0 : v1
+v2 : ((71 * v0) / v2) + (v3 * v1)
+v3 *: (v3 * v2 * v0 * 'c' + (v2 + v3) / 1 / v0)
+v1 : v3
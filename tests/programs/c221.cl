@@ -0,0 +1,16 @@
+chr v0 : 'x'
+chr v1 : v0 + v0
+nmbr v2
+nmbr v3 : 23 + 'y' / (-13 + v0)
+v3 : v0
+shw v0."s2".v2.v1
+shw (v0)."s6"
+v0 : v3 / (v3 - v3) + v2 * v0
+v2 : 72
+v0 : 84 / 14 - (v0 * 'x') - (77 + 78) * (v2 / 4)
+v1 : 'Z'
+v3 -: 52
+shw v2.v0
+shw v3."s9"."s7"."s6"."s3"
+v1 -: (v2 - v2 / v2 * 31)
+v0 : ((v0 - v0) / '9') + (50 - v2)
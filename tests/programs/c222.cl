@@ -0,0 +1,13 @@
+nmbr v0 : 93
+flex v1 : (v0 + v0 - 'x' - 'A' + v0)
+chr v2 : ((21 - 31) - (v1 + v0) - v1)
+v0 : (v2 / 60) / -13 * 25
+v0 : v0 + (84 + 27 - 'x')
+v2 *: (v2 / v2 + -5 + -5 * 47)
+v0 : ((17 + 42) + (v0 * 'A')) + v0
+v2 /: v0
+v2 : v0
+v1 : (83 - 39) * v1
+v2 -: ('Z' - 'A' / (v1 * 'y')) / (v0 * 48 - 'A')
+v2 : '0'
+v1 -: 27
@@ -0,0 +1,12 @@
+chr v0 : (('a' * 'b') + -3 * 26) + 10 * (-6 * 119)
+flex v1 : v0
+chr v2 : -1 + '0' + v1 - v0
+nmbr v3 : ('0' / v0) * 101 + (114 * v1) + v2
+nmbr v4 : 10 - v1 + v0 / v3
+shw v1.v0.v3.(v1)
+v0 : v4
+v0 : v4
+v3 : v1
+v4 *: (66 - v4) / (v2 - v2 + v3)
+v1 : v2
+shw v3.v4.'a'
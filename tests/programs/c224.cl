@@ -0,0 +1,9 @@
+nmbr v0 : '0' - 'y'
+nmbr v1 : (76 * ('A' / '0' + v0 + 'a'))
+flex v2 : 'Z' / (v1 - v1) + 115 / 'b'
+v1 : 5 - 'A'
+v2 /: v0 * v2 + 'y'
+v1 : 66 - (v2 / v2 * v1)
+v1 : '0' - v1 * v1 / -6 + v2
+v1 : v2
+v0 : (('A' - v1) / 70 / v1)
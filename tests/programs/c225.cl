@@ -0,0 +1,8 @@
+nmbr v0 : 'c' - ((34 * 52) - -7 / 86)
+flex v1 : 1
+flex v2 : ('z' * (52 * 73)) * 'b' / 'b' - 11
+flex v3 : (v1 / 'c' + v0 - (v1 / v0 + 61))
+v1 : 50
+v3 +: (v3 - 3) - (v0 / 26) / (v1 * 51 + v1)
+shw v3."s8".v0
+shw "s9"."s7".v3."s9".v3
@@ -0,0 +1,12 @@
+nmbr v0
+flex v1 : (('0' / 2 / v0 + v0) - (v0 + v0))
+flex v2
+chr v3 : v0
+chr v4 : ((v3 - v0) * v1 * 'b')
+chr v5 : (v1 / v2) + ((v3 - 67) * v0)
+v4 : v4
+shw "s2".v5.v2.v0."s6"
+v3 -: -14
+shw "s6"
+v2 -: 'x'
+v2 : v0
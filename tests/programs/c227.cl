@@ -0,0 +1,12 @@
+flex v0 : (27 / ('Z' + 'a')) - (40 / 94 - 16)
+chr v1 : 'b' * (v0 + '0') + (27 * v0)
+chr v2 : 69 - (41 - v0)
+nmbr v3 : (v2 - (v0 + 'Z') + v0 / 'Z')
+chr v4 : v1
+chr v5 : v1
+v5 : v1 + 4
+v3 : (119 + 114 - 109 * v0)
+shw "s3".v2.((v5 * (95 + v2 - 'x')))."s3"
+shw v2.v4.v3.v3
+shw ((v4 + (v3 - 110 - v2 / v3))).((v3 * v5))."s8".v0
+v5 : ('x' + ('y' * v4) - v3)
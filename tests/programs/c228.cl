@@ -0,0 +1,9 @@
+flex v0 : 'c' + 84 - 83 * 2 / ('9' * 42) + 2 * 14
+chr v1 : v0
+flex v2 : (v1 + v1)
+chr v3 : 44 / v2 * v0 * (v1 / 107)
+v0 /: 'a' * v1 - (v3 - 'z') / (33 * v0)
+v3 /: v3
+v3 *: 'Z'
+shw v0."s9"."s1".v2
+v3 *: (((27 / v2) + v1) + v0)
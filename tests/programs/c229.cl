@@ -0,0 +1,10 @@
+nmbr v0 : (-1 / 24) - -6 * (57 + 38 - ('b' / 93))
+flex v1
+chr v2 : '0' / v1 * v0 + (57 - 'y') + (v1 + 43)
+chr v3 : v2
+chr v4 : 92
+nmbr v5 : -2
+chr v6 : (17 * ('Z' + v1 + 45))
+v1 -: ((v4 / 'b' / 110) / v5 / 65 - 9 - 119)
+v5 : (109 - v0 - 'z' - v6 + v1 - v1 / v5 - v5)
+v5 +: 'b' + (v2 - v2 - 62 * v1)
@@ -0,0 +1,7 @@
+chr v0
+flex v1
+flex v2 : (('a' * v0) / 'c' * v1) + 'z' * v1 / 'x'
+chr v3 : v2 * ('b' - v0 / 6)
+v0 : (65 * 109 * v3 * v1 * v0)
+shw v2
+shw v3.v1
@@ -0,0 +1,10 @@
+nmbr v0
+chr v1 : ('y' - ((85 * v0) * 48))
+nmbr v2 : ((('a' + '0') + 72) / (-18 * v1) * v0 - 75)
+v0 : ((v0 + v2) / v1 - v1 / 59 - v0)
+shw 'y'.v1."s9"
+v2 : v1 * v1 / 'c' + 32
+shw "s5".v1.95.v1.v2
+v1 : v1 * 87 - v0 + v1 * (101 / 70) - 'x' + 'x'
+shw v1."s0".v2.v0
+v2 : (v2 + v0)
@@ -0,0 +1,9 @@
+nmbr v0 : 'y'
+chr v1
+nmbr v2 : v0 + ((91 - -3) * v1)
+flex v3 : v0
+chr v4 : v1
+shw v4.v3.v2
+v3 : 'Z'
+v1 +: 81
+shw v1
@@ -0,0 +1,8 @@
+flex v0 : 39 - 38 + 35 + 54
+flex v1 : ((-6 / 9) / 112 * v0 / (v0 * '0') + (-2 / v0))
+flex v2 : v0
+chr v3 : 109
+v3 : (109 * v0 + v3) * v0
+shw (((v3 * '0') - v0 / v0) + ((v3 / 'c') / v1)).v3.v1.v3
+v2 : ((70 / -3 - 120) + v2)
+shw v0.v1.v3."s0"
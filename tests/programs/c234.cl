@@ -0,0 +1,17 @@
+chr v0
+flex v1
+flex v2 : (v1 + -14) * (-16 * 56) - v0 * 'a' / v0
+flex v3 : (17 + (v2 * v0)) + (v0 / v2 + v0 + 'a')
+flex v4 : 'x' - 'b'
+v1 : (v0 / v3) - 46 - 'b' + v1
+v4 : v3
+shw v2."s8"."s3".v3
+v3 /: ((v4 - 4 - v3) * (v2 + v2 / 'A'))
+v1 +: '9' + ('Z' / 62) - 'b'
+v4 : (v0 + 'Z' * 106 * -15 + 48)
+shw v2.v4
+shw v0.v4
+v3 : v4
+v2 /: v1
+v0 +: (((-9 * 40) * (v3 * 58)) * (56 / (v1 * v2)))
+shw v1."s2"
@@ -0,0 +1,14 @@
+flex v0 : -15
+chr v1
+nmbr v2 : v1 / 'c'
+flex v3 : v2
+flex v4 : v1 / ('z' / 'Z')
+shw 'A'."s4".v4.v3
+shw v0.v4.((('z' * 'a') - 90 + 'c' / (v1 + v4) / v2 / v0))
+shw v1.'Z'."s4".v3
+shw "s6"
+shw v3
+v3 /: (83 - v4 * v3 * 1 * ('b' / v1))
+shw v1."s5"."s0"
+v3 /: ('c' * v4 * v1 + v0) - v4
+v4 -: v2 * -13
@@ -0,0 +1,10 @@
+chr v0
+chr v1 : ((v0 * v0 * 'a') * v0 + v0 * v0)
+chr v2 : 'c' - (-9 * (v1 / v1))
+flex v3
+flex v4 : ((('Z' * v3) + (67 + 'A')) / 22)
+v0 : 82 / 115 + 'c' - (v2 - v1 - v2 * v1)
+v1 *: v2 + v2 - v2
+v0 *: ((v2 - v0 + v1) + 21)
+shw v1.v4
+shw v2.v0.v2
@@ -0,0 +1,10 @@
+chr v0
+nmbr v1 : v0
+flex v2 : (((v1 * v1) * v1 * v1) + (v1 * v0 - v0 - 13))
+flex v3 : 'b'
+nmbr v4 : (87 + v2 + 11) * 106 / -1 - v2
+chr v5
+flex v6
+v1 : 48
+v1 : (v5 - 'a' / v1) + 'Z'
+v4 +: v0
@@ -0,0 +1,10 @@
+nmbr v0 : ('c' + -10)
+chr v1 : v0
+nmbr v2
+nmbr v3 : 'c'
+flex v4 : (v2 + ('y' * v1 * (v0 - 91)))
+v1 : ((-15 * v1) * v1) * ('c' + v2 / v4 - v1)
+shw "s7".v0.v4.v1.v4
+shw v1.v1
+shw "s3".v4.v0
+shw "s1"
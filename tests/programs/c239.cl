@@ -0,0 +1,13 @@
+nmbr v0
+nmbr v1 : ('c' * (v0 + v0)) * 91
+chr v2 : 81 + v0 - v1 - 57
+v0 /: 101 * v1 - (v1 + v1)
+shw v2
+shw v1
+v1 : v1 * '9'
+v1 : (v1 + (v2 - 'a') - (102 / v0) + (71 - 'Z'))
+v0 : v2 / ((v2 + v0) + v1 * 'a')
+v2 *: v0 * v0 + v0 / v0
+v0 /: v1 / v1 * 'A' / v0
+shw v0."s7"."s5".'9'
+v2 -: v2
@@ -0,0 +1,18 @@
+nmbr v0 : (-20 * (119 / '9') - -20)
+flex v1 : (v0 * v0 - 'x') + (104 + v0) + v0 + v0
+flex v2 : 34 * '9' * v1 + (v0 - 60)
+nmbr v3 : 'y' * v2 * 29 * 31
+flex v4 : v0 * v1 * v0 * 51
+nmbr v5
+chr v6 : 63
+shw "s8".v2
+shw v1.v1.v5.v5."s7"
+v2 : (v5 + 'z' * (85 - v3) * 'a' / v6 * v1)
+shw "s3".(v0 + v2 + v1 * 'a' - ('Z' - 79) * v1 / 'a').(v2 - (('9' - 'z') + (81 - 43)))."s7"
+shw "s7".v0.v3.v4
+shw v4.'a'
+shw v6.v3.v6."s5".v0
+shw v1.v1.v6."s2".v4
+shw "s3"."s3"
+shw "s2".((v4 / 'Z' * v2 * 49 - v2 + 'b' / (96 * v5)))
+shw v6
@@ -0,0 +1,16 @@
+nmbr v0 : (119 + -17 * 39 * 21 - 4)
+nmbr v1
+flex v2 : ((v1 + (v1 - 51)) + v0)
+chr v3 : ('x' + v1 / (12 * v0) * v1)
+chr v4 : v3
+chr v5 : 'A' - 'a' / -3 / v0
+nmbr v6 : v3 / (118 / v2)
+v2 : ((16 - (v6 / 34)) + v6)
+v6 : ((86 + v5 - '9') - (v0 / v1))
+shw "s1".v5.((0 * 76 + v1) * ('9' + v3)).'9'."s6"
+v0 -: 83
+v1 : ('z' - v4) / 'y' + v5 + v3 - v1 + v5
+shw "s1".v5.v2.v1
+v0 *: v6 + 'a' * v0 / 5 + v3
+v5 : (v2 * (82 - v2 + 77))
+v3 -: v5
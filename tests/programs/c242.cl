@@ -0,0 +1,17 @@
+nmbr v0 : (33 - -10 / 36)
+flex v1 : 118 * v0
+chr v2 : (v0 - 23)
+nmbr v3 : v1
+flex v4
+shw '0'.v0
+shw v2.v1.v3.v0."s1"
+v4 *: v3
+v3 -: v3 / 75
+v2 : v0 / v4
+v1 *: 'a'
+v0 +: v2
+shw "s9".v3.v2."s7"."s5"
+shw v1
+v1 : ((v1 * v3 - (-1 - 'c')) * 8 / (v1 - v1))
+shw v4
+shw "s7".v3.v0
@@ -0,0 +1,12 @@
+chr v0 : (7 * -12 - 20 * 36 + 6)
+nmbr v1 : ((87 + (v0 / v0)) - ('a' / -18 - (v0 + v0)))
+chr v2 : (v0 - 'A' * (v1 + v1)) - v0
+chr v3 : v1 + 97 / v2 - 74 * (-15 * v2) - (v1 - v1)
+chr v4 : v3
+chr v5
+nmbr v6 : -9
+shw v1
+v1 /: ((v4 + 90) / v1) * (v3 - v4) - 'Z'
+v0 -: v1 + v6 - v1 * (62 + 83)
+v4 : 88 * (-20 - 'b')
+v6 : v0 + 'c'
@@ -0,0 +1,18 @@
+chr v0 : 64 * '9'
+nmbr v1 : v0 + (v0 - v0 + v0)
+flex v2 : ('c' / v0 * v1) * 99 + v0 / v1
+chr v3 : ((('z' + v0) / 105 + 4) * v0)
+flex v4 : ((v2 / v1 - '0' + v3) - 'y')
+flex v5 : v0 * v1
+v1 : ((13 - v2 / v3) + 30)
+v4 : (101 * 47)
+v0 : (83 + (23 - 'A' * v2))
+v0 : (('c' - (-2 / v5)) + (v0 * 113 * v2))
+v3 : v4 / v0 * v3 + ('A' / v4 * (v4 * v2))
+shw v4.('A').v1
+shw v5.v5.v3."s6".v3
+v0 -: v3
+shw v4.v4.v1.v0.v0
+v5 : v0
+v3 : (26 / v5 * v1 * 52)
+shw v3."s8".v0
@@ -0,0 +1,14 @@
+chr v0 : 'Z' - 58 - 51 / (-7 * (2 / 'c'))
+flex v1 : v0
+flex v2
+chr v3 : (((v2 - 'A') + 'a' + 'z') + 'z')
+shw v0
+shw v3."s0".v2.v1
+v3 /: v1
+v3 +: ((v1 - v0) + v3 * 'A')
+v3 : ('9' - 99 * v2 / 62) * ('9' - 'z' - ('a' + v3))
+v0 *: (v2 - 73 * 'c') - v1
+shw "s4"."s9".((v1 - 'c' / 'c' + v0)).v1.(v3)
+v1 : ((v3 * v2) * v2) / v0
+v3 : v0
+v3 : (v2 * 39 + v3 / 62)
@@ -0,0 +1,9 @@
+flex v0 : (4 / (3 * -13) * 116 + 109)
+flex v1 : 'b'
+nmbr v2
+shw "s7"."s7".v2.v0
+v1 /: 'y' + v1 - v0 + v1
+shw v1."s9".v1.v0
+v0 : v1 / v2 + 'y' + (v2 - 'b')
+v0 : v1 + v2 - v2 + 58 - (v1 + v2) / v0 * v2
+shw "s6".v1.((((105 / 60) * 16 + v0) * (v2 + v0 * v2 * v1))).v2
@@ -0,0 +1,14 @@
+chr v0 : 33 - 87 - 2 + 'b' * ('a' / 'y')
+chr v1
+nmbr v2 : v0 * (v1 * v0 * (5 + 74))
+nmbr v3 : (40 / 25 - v1 - v2 + ((93 / 65) + v0))
+nmbr v4 : (v1 - ((93 * 48) + 30 / 41))
+chr v5
+shw v1.'0'."s6"."s8"
+v0 /: (11 + v4 - v3 / v5)
+v1 : v2
+v3 : v1 / 9
+shw v0.48.v2.('y' / (('9' / v1) * 'A' * v5))
+v5 : ('A' / v0 + v2 / v4)
+v4 +: v3
+shw "s9"
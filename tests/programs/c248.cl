@@ -0,0 +1,15 @@
+flex v0
+chr v1 : 'Z' + v0 / 105 + v0
+flex v2 : 'A'
+chr v3 : v2
+flex v4 : v2
+chr v5 : v1
+v0 : 'x' + '0' + v1 + v1
+v0 : 68 + ((9 * 70) - v1 / 'z')
+shw v3."s7".v1
+shw "s4".v3.v4
+v3 : (v5 * v5)
+v5 -: ('x' * 73 + 74 + v5) + 60
+shw v2.v5.v4
+shw (v0 * v4 - (v1 * v4) + 81).v0.v4.((101 - v4 - ('Z' / v3)) * (v0 + v0 + 'b'))
+v5 : v3 - 'z' + '9' / 105
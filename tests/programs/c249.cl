@@ -0,0 +1,14 @@
+flex v0
+chr v1
+flex v2 : v1 - ((v0 - v1) * v1 - v0)
+flex v3 : -16
+nmbr v4 : v0
+v4 : v1 * v2 - v1 * (v3 - 'y') / v2 - v0
+v1 +: 'a'
+shw v1.(v0 * '0' * v0 - v0 / v4)
+shw v0.v0.v4
+shw v4.v4.v2.((('z' * -12) * v0 - v2) + v4).v0
+shw v3.v3."s2"
+shw v2.('A' * ((v1 - 'c') - v0 / v1)).(v0)
+shw v0.v4.v1
+v4 +: v0 + 8
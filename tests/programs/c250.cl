@@ -0,0 +1,13 @@
+chr v0
+flex v1 : (('Z' * 59 * 24 - v0) - (v0 - v0) / 'z')
+nmbr v2 : v1 - 108 / 29 + ((v0 + 'c') + v0)
+nmbr v3 : (((v1 * 'c') * (v2 - 'c')) + v2)
+nmbr v4 : (90 * v3) + 91 * v0 * (v2 - (v0 - 'c'))
+nmbr v5 : 63 - v1 / v0 * v0
+v5 : 'x'
+v1 : v5
+v4 : 'x'
+v0 *: (v4 - v1 + v1 * 'Z')
+v5 +: v0
+v3 : 20
+v0 : 'c'
@@ -0,0 +1,17 @@
+flex v0 : (3 / 'A')
+flex v1 : v0
+chr v2 : v0 - 'c' - ((-11 - v1) + v0)
+chr v3 : v2
+chr v4 : (v0 + '9')
+nmbr v5 : ('Z' - v1) * 20 - v2
+shw v1.v2.v1.v3
+v1 : (120 / v1 - (v0 * v2)) * (v5 + v1 + (108 - 'z'))
+v0 : v4 - v2 - v5 / 67
+v0 : v2 + ((v2 + '9') * 37 * v1)
+v5 : ('z' * v3 * v1) * '0' - 'c' * v0
+v0 -: (('b' - v1 * (v3 + v0)) - 86)
+v0 : v3 - 'Z'
+v3 *: -6
+v0 *: (v1 - v1 * 'a' + '0' - '9' - v1)
+shw '9'
+v1 -: v5
@@ -0,0 +1,18 @@
+nmbr v0
+chr v1 : v0 * (0 * -10) + -16 * v0
+flex v2 : v0
+flex v3 : (((v2 - v0) - ('0' * 54)) * v0)
+flex v4 : (v3 + 'c') * v3
+flex v5 : '0'
+nmbr v6 : ('9' * v4 - 'c' / (v1 + v2 + v0))
+v6 : (v1 + v5 / v5) * (v2 * 96) - v4 - 'b'
+shw v2.v5."s3".v3
+v2 : '9' / v0 + (48 + -15) - v2
+v2 : 6
+shw v0.v0.v1
+shw v2.v2."s7"
+shw v3.v5.v5.v2
+v5 : (('9' * -2) - v1 / v1)
+shw v3
+v5 : (((v6 + 'c') + 'Z') / 'c')
+v6 *: (v2 - v5 * v1 + (v0 - v5))
@@ -0,0 +1,19 @@
+flex v0 : 17 - 120
+chr v1 : v0
+chr v2 : 44
+flex v3
+chr v4 : v1 - v3
+flex v5 : (v3 - v1 * v1) / v3
+chr v6 : ((v2 / v0 + v1) * v5)
+shw (((v5 / 48 - 'x' - 'A') + 3))."s1".v1.v0
+v5 +: v5 + (34 + 76 * 'c')
+shw "s6".'9'.v1."s2".v3
+shw v3.v5.v4
+shw "s3".v5
+shw (((v6 / (v2 + v6)) + 'z' / (v0 / '9')))."s3".v0.v1.v0
+v2 -: (v2 * v3 * v5) * v0 - 'z' + (51 / 59)
+v3 : 100 + 37 / ('c' + 'A') / ('y' - ('A' / v6))
+v1 : 5 - 77 - (v5 / 44) * v0
+shw v5.v5
+shw v3
+shw v1.v2."s3".v5
@@ -0,0 +1,15 @@
+flex v0 : (63 - 42 + '9' - 115)
+nmbr v1 : (v0 * 26)
+flex v2 : -18 / (v1 / v0) / '0' + v0 - v1
+flex v3 : (((v0 - v1) * v1) + v0)
+chr v4 : (v2 + 'A') + 10 * v1 / (v3 + v1) + ('A' - v3)
+v3 : v1 * (v0 / 43 * v1 * v2)
+v1 : 30
+v3 : v4
+shw 'b'."s9"
+v4 /: (v2 * v1) + v3 * v1 + v2 - v4 / v3
+v4 : (((v4 - v4) - (115 / 2)) / -7 * 'a' / -15 * v2)
+shw v3."s5".(v2 / ('y' * v3 - 'z' - 'Z')).v4.v1
+shw "s0".v1."s8"
+shw "s2".v0."s0".'b'.v3
+v2 : v4 - v4 - v2 - v0
@@ -0,0 +1,12 @@
+chr v0 : (118 - 78 * 'Z' - -3) + (82 * 34) - 89 - -4
+flex v1 : 80
+flex v2 : 36 * '9'
+shw ((((63 + 'A') + v0 / 'Z') * 58)).v0."s6"
+v0 : (v0 / v0) / 113 - ('y' - -4 / v2)
+v2 -: v0
+v2 *: 'A' / (v1 - 'x' * '0' - 31)
+v2 : (v1 + v1 / (14 + v2) * -3 + 68 * -14)
+shw v2.v0.((v2 - v0 / (63 * '9') / (-6 - 31))).v0.(117)
+shw v1."s5".v1
+shw (('y' * (v0 / v2 * (102 / 'c'))))."s9"
+v1 : (v0 - 112 + v0)
@@ -0,0 +1,12 @@
+chr v0 : (53 / ('9' * 119)) + 'Z'
+flex v1
+nmbr v2 : -14
+flex v3 : v1
+chr v4 : v3 + ('9' - (v0 + 'c'))
+nmbr v5
+v1 : 72 / 'a' * -20 / 75 - (v2 / v4 - 9)
+v0 : v3
+v5 : 'x'
+shw v1.v2.v2."s8"
+shw "s1".v1.63.99
+v4 : 32
@@ -0,0 +1,9 @@
+chr v0 : 'Z' - (102 - 'c' - 'c')
+nmbr v1 : ((v0 - 'c') / ('y' / v0)) / 37 - v0 * v0
+nmbr v2 : 109
+nmbr v3 : (v0 - 'y')
+flex v4
+v4 -: ('0' - 117 + (v0 / v1)) + v4
+shw "s7".v0
+v0 : '0' / 103 / 90 / 6
+v2 -: ('x' / v2 - ('Z' + v0)) * (v3 / v0 * v2)
@@ -0,0 +1,12 @@
+nmbr v0
+chr v1 : (v0 - 'b') - 90 + v0 * v0 + v0
+flex v2 : 65
+shw "s7"."s3".'b'
+v1 : v0
+v0 : v2
+v2 *: v0 * v0
+shw "s3".v2.v2."s7"."s1"
+v0 : v1 + 'y' - v1 + (v2 * v0)
+shw v0
+shw 37
+v0 -: ('a' + v2 - 97 * v0 / 24 - 3)
@@ -0,0 +1,11 @@
+flex v0 : ((1 + '9') - 100 / 'Z' / (79 + '0'))
+flex v1
+chr v2 : v1
+v2 : v0
+shw v2
+shw v2.99.-16.v1."s4"
+v0 : 14
+shw v0."s4".v1.(v1 + 80 / 'c' / 45 / 'A')
+v0 -: (v0 - -6 - v0)
+shw v2.v1.v0
+shw v2.v0
@@ -0,0 +1,9 @@
+nmbr v0
+flex v1 : v0
+chr v2 : v1 - 'A' * v1 + (27 - -7) - (v1 + 66)
+chr v3 : (('c' * 'A' - v0) + (89 * 88 * v1 - v0))
+shw v3.v1."s6"
+v1 -: 'z'
+v2 /: (v2 * v2 - v1) * v0
+v0 : v1 / 119 - ('c' * v1) / ((v1 + 'A') / (120 * v3))
+v0 : (61 - v3 / (v2 + v3) * (v2 - '0'))
@@ -0,0 +1,15 @@
+nmbr v0 : '9'
+chr v1 : v0 / v0 + v0 * (55 + ('9' / 'z'))
+chr v2 : v0 / '9'
+nmbr v3 : (v2 + v2 * v1 - 'z')
+nmbr v4 : (('9' + v3) - 78 / v1) / (v0 - 'c' + v3 * 62)
+chr v5 : v4 + 90 * (v4 / 97) / (('Z' - v2) * v3)
+shw v1."s3".((('a' + v0) - 'A' + 'c') * 4 * (v4 - '0')).14."s5"
+shw (('z' - 'x' / 'b' * v1 * v3 * v0)).v5
+v4 : (v2 / ((v3 - 16) * v5))
+v4 : (v3 * v5 / v4 + v2 * v4 - v1)
+v0 : (72 / v2 + 'b') / (v5 / v2) * (v3 - 'A')
+v5 : v1 / (v4 / 'x') * 114
+shw v0.((v3 + (v5 + v5) + v0 / 'x'))
+v4 : '9' * v4
+v1 /: v2
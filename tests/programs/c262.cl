@@ -0,0 +1,15 @@
+flex v0 : 'x'
+nmbr v1 : (('x' - v0 * 'A') - ((v0 / '0') * (v0 * v0)))
+chr v2 : v0 + v0 + v1
+nmbr v3 : v2 / -17 / ('x' + v2)
+nmbr v4 : (v1 * v0 - 'a') - (v1 + v3 * 5 + 'z')
+v0 *: 'b'
+shw v4.v1
+shw 'z'.(v2)
+shw "s6"
+v2 : v4
+shw v1.v0
+v2 : '0'
+v3 -: (v4 * 'c')
+v1 : (52 + 27 - 'Z' - v3)
+shw "s3".(v3 / -6)
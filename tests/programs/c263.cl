@@ -0,0 +1,13 @@
+chr v0 : -20 * 116
+flex v1 : v0
+nmbr v2 : v0 - (v0 + 'A' - v1 + v0)
+chr v3 : ('9' / v1 - v2) / (59 / v1 * v1)
+flex v4 : v3
+chr v5 : 'x' / 'y' * v3
+shw v0.('0')
+shw v0."s4"
+v0 : (v4 / 45 * 'b' + v5 / 48)
+shw v5.v4.v2.v0
+v3 : v1 + v4 - v1 - 'y' + v2
+v1 -: (8 + v1 + v2 + v2 - (v3 * 114) - (77 * v2))
+v4 : (('9' * v4) - (104 - v3)) + v1
@@ -0,0 +1,13 @@
+flex v0 : 36
+flex v1 : ((93 * v0) + 'a' * v0)
+chr v2 : v0
+chr v3 : ('Z' + ('0' - 'a') + ('0' + v2))
+chr v4 : 26 - 'z' + v0 - v0
+flex v5 : 47 + 84
+nmbr v6 : (v4 * v2 / 'c' - '9' / '9')
+v0 : 'z'
+shw v3."s5".v6
+v2 : (('c' + '9' * v4 / v0) * 96 - 'z' - 'x')
+v4 *: ('a' + 'y') / 'Z' * v6 - 16 / v1 - 12
+shw v1.v0."s6".v5."s5"
+v5 -: 'c' + v2 / v2
@@ -0,0 +1,17 @@
+chr v0
+chr v1 : 29
+chr v2
+nmbr v3 : 'A'
+chr v4 : 32 * v0
+nmbr v5 : v0
+v2 : '0' / (v0 / 37 * (v2 / v5))
+v2 : -6
+v5 : (v2 * (v5 - (v1 * v0)))
+v0 +: 80 * (v4 + 'z' / v1)
+shw v3.(((v4 / v0) * v1 / (('b' / v1) + -9)))
+v1 *: 57 - 54 * 64 - (v1 * v1)
+shw "s6".v5."s0"
+shw v3.v3
+v4 : 103 / -6 * ('x' * v0)
+v5 : (89 / (v0 / -13) / (v1 + 44) * 58)
+shw "s6".v3.('b' * v5 * 'a' - v1 * v5 + 'z' - v5).v1.-13
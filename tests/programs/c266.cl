@@ -0,0 +1,14 @@
+flex v0 : 120
+chr v1 : 114 + ((v0 - 22) * v0 / v0)
+chr v2 : 'Z'
+v1 : ((v1 / 3) / v0) * 'x' - v0 + 16 / v2
+v1 : ((111 + v2) - 0 / v2) - 91 + 46 + (v2 / 'c')
+v1 : 'A'
+v1 -: -6
+shw "s2".(v1)
+v0 *: (102 + '0') + 118 + ('a' + 88)
+v1 /: (v0 + (v1 * 'y') / ('b' - v1) / v2)
+shw "s1".v0.v1
+v2 /: (('y' + 'z') + v2) / (v2 / v0 + v0)
+v2 -: (v2 * 54 - v0 - 'x' / 'x')
+v2 : (11 / ('b' / 47)) + v2 - v1
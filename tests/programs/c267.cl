@@ -0,0 +1,15 @@
+nmbr v0 : 100
+nmbr v1
+nmbr v2 : 113
+nmbr v3
+v0 *: (v1 / '0' * (v1 + v1) + (36 * 'y' / 15 - 28))
+v1 : (v1 / 109 + v1)
+v0 : -12 * 11 + 82 / v1
+v3 : v1
+v1 : 42
+v0 : (v3 * 79 - 95) + (v3 - v0 - 100)
+v3 *: v3
+v2 : 'A' - -3 * 50
+v3 : (v1 + v2 / v2 + '0') * (v0 - ('0' + v3))
+v0 *: v3
+v3 +: v2 / 58 * (v2 * 18) + 107
@@ -0,0 +1,12 @@
+flex v0 : 37 * 76 + '0'
+chr v1 : v0
+chr v2 : v1
+nmbr v3
+flex v4 : ('c' + 65 - v0 - (19 - v1) / v3 - v1)
+chr v5
+chr v6 : v1 / (93 / 103 * v5)
+shw ((v1 - v4 + 80 * (107 - (v5 + v3)))).v1."s1"."s3"
+v0 /: 104 / v0 * (v1 / 61) + v2 - v6 + v4
+shw (v0).v1
+v3 : v4
+v5 : 'A'
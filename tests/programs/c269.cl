@@ -0,0 +1,14 @@
+nmbr v0
+flex v1 : (v0 * v0 / v0 + v0)
+chr v2 : ((v0 + 'x') / 19 - 93 * (('9' + v1) * 55 * v0))
+v0 +: v2 / 'Z' / v2
+v2 : (v1 * 102 - 'b') * (v1 * '9') / v1
+v1 : v0
+v0 : v1 - (5 * v0 - 'b')
+shw "s4".(109 * (v2 / v1) + 68 * (v1 - v0))
+v0 : '9' / 'z' / v2 + v2 - 'c' - v0
+v0 : (53 / 'x') - v2 + (v1 + v0) / 63 - 57
+v2 : (93 - 33) - (116 * 'c') * v2
+v0 +: v1
+shw v0."s3".v1
+v0 : (('y' - 76) + ((v1 + v1) - 'Z'))
@@ -0,0 +1,11 @@
+chr v0
+flex v1 : 15
+nmbr v2
+chr v3 : '0'
+shw (v0 + v1 / 107 + v0).v0.v2
+v2 : v3 - 59 + 36 / -4 / 75
+v0 : (v0 * -7 - 88 * 'a') - v3 + v3 / 100 / v3
+shw "s9"."s1"."s9".v1
+shw "s8"
+v1 *: 'y'
+v0 -: (v0 * '0')
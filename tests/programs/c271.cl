@@ -0,0 +1,17 @@
+flex v0 : 85 + 87 / 2 * 16 * 'y'
+flex v1
+chr v2 : 98 - v1
+flex v3
+nmbr v4 : v0 - v1 * (v1 / 78) - v1 * '0' * (-1 + -7)
+nmbr v5 : 64 - v3
+v1 : (v5 * 'Z')
+shw v0."s2".v1.-11.v0
+v2 : (v5 * v2) * v5 * (v4 + 84) + 'z' + 109
+v2 -: 'c' / 118
+shw v5.v3
+v4 : 13
+v2 : v3 + 'Z' / (59 * v5)
+v1 : 'b' / v3
+v1 : 109 + v0 + v3 - v1
+v3 *: v1 / 'y'
+shw "s1"
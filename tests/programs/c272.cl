@@ -0,0 +1,13 @@
+chr v0 : (('z' - 'c') * 14 - 'x' * 85 / 19 - 65 / 96)
+flex v1 : v0
+flex v2 : (v0 * v0 - v1) * 'A' - (36 / v1)
+nmbr v3 : v0 * v0 - v0 * 'A' * '0'
+flex v4
+chr v5
+shw v2."s2".(-17)
+v1 : v4
+v2 : '0' * v1 * 36 - v5 / v0
+v1 /: ((v2 + v5 * 20 / 11) - ((v3 + 'b') - v0 * v4))
+v0 -: v3
+shw (v3)."s6"."s4".v4
+shw v1.(v3 + 'c').31
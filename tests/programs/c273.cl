@@ -0,0 +1,11 @@
+flex v0 : 54
+nmbr v1 : v0
+chr v2
+chr v3
+shw "s2"."s8".v2
+v2 : 'b' * (v3 - 119) * (14 - 48)
+v2 : 'a' + 'y' - 113 - v1 + 61 * v3
+shw v3
+shw v0."s0".v0
+shw 'y'.'z'.v0
+shw v3
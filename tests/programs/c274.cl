@@ -0,0 +1,8 @@
+chr v0 : 48
+nmbr v1 : 'Z' - v0
+flex v2
+chr v3 : (90 * 112)
+v0 +: '9'
+v2 : ('z' - '9' + (83 + '9')) * (v1 / v0 - 40 - v3)
+v2 : 'z'
+v2 : 115 * (v3 + 113) + 'y' / v1
@@ -0,0 +1,10 @@
+flex v0 : (13 * ('x' / -9 * 69))
+chr v1
+flex v2 : v1 / 64 / (37 - v0)
+shw "s6"."s7"
+v2 : '9'
+v0 *: v0 * 112
+v2 /: (((v2 / v2) * 111) * v2 + v2 + 39)
+v0 : (v0 * 1 / v2 - v1) - v0 * 100
+v0 : (v1 + ((v1 * 66) / 44 / v1))
+v2 : (v1 - (v0 - v0)) / v0 * v1
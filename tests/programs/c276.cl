@@ -0,0 +1,11 @@
+nmbr v0 : (77 * 30)
+chr v1 : -12 - v0
+chr v2 : v1
+nmbr v3 : v0 + v2 + v2 - 9
+nmbr v4 : ('c' + -14 / v2 + v3 / v1)
+v4 : (((5 - v0) * v4 * 'b') - v2 / (v1 / 84))
+v1 : (11 - v4 - v1 + v2)
+v2 : ((12 - -19) * v0 + ((12 * -15) * v2 + 'a'))
+v2 : v2 / 'a' * 78 - ((v0 / -9) - 'b')
+v1 : 44
+v2 : ((-10 * v4) + (v4 * 101)) - (v1 * v3 + (v0 * v0))
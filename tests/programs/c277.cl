@@ -0,0 +1,11 @@
+nmbr v0 : 12
+flex v1 : ('y' - (v0 / v0) + (v0 + v0))
+chr v2 : (v0 - v1 + v1 * v1 * v0)
+shw (((v1 + v1 - '9') / v2 + v0 + 70 - 9))
+v1 : (v2 * 'b') + (12 + 56) + 78
+shw 76.v2
+v2 +: (v1 + 66 * v1 / v2 + 94 / v1 * 93)
+v0 : v1 - 'Z' - ('A' + v1)
+v1 -: 55
+v1 -: (2 - 39 + (66 * v1)) - v1 - v0 - 42 + 'a'
+shw v1.(7)."s3".v2
@@ -0,0 +1,9 @@
+chr v0 : ((69 * 116 / 82 + '9') / (-12 / 111 - (74 + 39)))
+flex v1 : 'b'
+chr v2 : v1
+chr v3
+chr v4
+shw "s0".(62 / (v2 / v2) + (v2 + v3))
+v0 /: v0
+v0 : ((27 / v1) + 47 / v3 + -1)
+v2 : v3
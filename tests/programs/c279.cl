@@ -0,0 +1,17 @@
+chr v0 : 27
+chr v1 : (v0 / v0 + v0) - 99
+chr v2 : v1 - 'a'
+nmbr v3
+nmbr v4 : (v1 / (('Z' + v0) / v0 + 'c'))
+nmbr v5 : v4
+v4 : v3
+shw v5.v5.v3.v5.(-5 + 103 - 13 - v2)
+v0 : 29 / 'c'
+v1 : ((88 + v3) + v2 * v4 / 0)
+v1 -: (v5 / v4) - v4 + 7 * v0
+v5 : ('c' + ('b' + 'b' - '0' / v3))
+v1 : v2
+shw v1
+v3 : (('0' - v4) * v1 * v4 + v5)
+v5 : (v4 - v0) / 29 * 'y' / ('a' - v4 + (v1 - v1))
+v4 : (((61 / v5) / -11 / '9') - v3)
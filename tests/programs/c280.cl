@@ -0,0 +1,13 @@
+chr v0 : ((-9 + 'x' * ('Z' / 75)) * (93 + 16 + 47 / 98))
+flex v1 : ('a' + (3 - 101) * 'Z' * 77)
+nmbr v2 : 58
+chr v3 : 'b' * 33
+chr v4 : ('b' + (-5 / v0))
+v4 : (('a' - -18) * ('a' / v4) * 'Z' * (v3 - v1))
+v3 /: (v4 * v2 * (v1 + v0) + v2)
+v4 : -12 - (v1 - '9' / (v1 - v0))
+v2 : ((v4 / v0 - v0 + v0) / 'z')
+shw "s1".v1
+v2 -: 'A' + 37 / 103 * 21
+v1 : 16 - v4
+v0 : -9 / v1 - v2 + v3 / -4 - 49
@@ -0,0 +1,14 @@
+chr v0 : ((-1 * 16) + 99 / '0') - 44
+chr v1 : 'c' - 'Z' / v0 * (9 / ('Z' / v0))
+flex v2 : v0
+v0 : (v2 * (v0 / v1 / v0))
+shw v2
+shw (((16 / v2 / '0') - (22 / v0 - (v0 * 0))))."s1".v2
+v0 -: v0 - v2 / v2 + 31 * (v1 * -6)
+v1 *: -1
+v0 /: (v0 / (v0 + -3) / 'x')
+shw v1."s4"
+v2 : v1
+shw v2.v1
+v2 : ('9' - 'z' - 'A' - 99)
+shw v2."s3".v0.v2
@@ -0,0 +1,10 @@
+flex v0 : 110 - 93 / 22 / (67 * 43)
+chr v1
+chr v2 : 111
+shw v1.v1.v0
+shw v1."s2"."s8".v0.(87)
+v2 : 'A'
+v1 +: v1 + '0' + v2 + v2 + 'b'
+v1 -: (107 * '9') * 'y' - v2 * v2
+v1 /: v0
+v2 : 0 * v1
@@ -0,0 +1,12 @@
+nmbr v0
+chr v1
+chr v2
+v2 : (v1 - v1) + (v1 / -4) - v2 + v0 / v1
+v0 : 75 - 'z' - v2 * v0
+v0 : (('y' / 'A') + v1 - v0) - v0
+v0 : v0
+v1 +: v2
+shw v0.v2.v0."s1"
+v1 -: (v2 - 95) / v2 - v1
+v2 -: ('x' * 'A')
+shw v0
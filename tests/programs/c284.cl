@@ -0,0 +1,11 @@
+chr v0 : (64 - 'a' - 111 - 16) * (70 / 4)
+nmbr v1 : v0
+nmbr v2 : 117
+shw "s3"
+v2 /: ('Z' - 45)
+shw v0
+shw "s5"
+shw v0
+shw (v0 - ('y' - v2 + '0' * v0))."s2"."s2".v1.v0
+shw v1."s7"."s2"."s8"
+v1 : v0
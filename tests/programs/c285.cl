@@ -0,0 +1,10 @@
+chr v0 : 96 + 16
+flex v1 : 'b'
+chr v2 : (v1 * v1 - 92) - 98
+chr v3 : v2
+nmbr v4
+nmbr v5 : v1
+nmbr v6 : v4
+v2 : (66 + v4 + 85 / v0)
+v0 -: (v5 - v3 + v5) * ((v3 - v1) + (v2 / v5))
+v4 : v2
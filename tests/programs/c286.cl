@@ -0,0 +1,15 @@
+nmbr v0 : 84
+chr v1
+flex v2 : v0 - (v0 + v0) - v1 / 107
+flex v3
+chr v4 : (((v2 + v0) * 105 - v3) / v0 - 'c' + v1)
+chr v5 : v4 * ((v3 * 'x') + v3 + v1)
+v2 : -18 - v4 / v4 / (v3 - v4)
+v3 : 'b'
+v2 /: v5 + v2 * 40 - (v3 - v3 * ('x' - v0))
+v0 : v5
+v4 : v3
+v3 /: 115 * 32 / v2 - '9' / v1 * 'c' / v5
+shw v4.(v0 / ('a' * 'z'))."s5"
+shw v0
+shw (((v0 - v0 / v0 * '0') + (v0 + v2 * 32)))
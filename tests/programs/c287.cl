@@ -0,0 +1,13 @@
+nmbr v0 : 111
+nmbr v1 : 'b' * v0
+chr v2 : 115 / ((v0 / v1) * 62)
+chr v3 : (v0 * v0) - v1 / 17 * '0' * 'c' * '0'
+nmbr v4 : (v2 * v0)
+flex v5 : (v4 / v2)
+chr v6 : (((v3 / 'x') * v0 - v3) / (v5 + 'y') - v5 - v3)
+v2 : ('9' + (105 * 117 + v3))
+v3 : v4
+shw (((v0 * v4) / (27 * -15)) * 'a' - 'c' / 'y').(v1).'c'.(v2)
+v5 : v5
+shw v2.v2."s0"."s3"
+v1 *: '9'
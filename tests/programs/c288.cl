@@ -0,0 +1,17 @@
+chr v0 : (102 / 62 + 'z' + 81) + 86
+nmbr v1 : (v0 * (v0 + v0 / v0))
+flex v2
+nmbr v3 : ((-7 + v1) / v1 + 'a' / v0)
+chr v4 : '0' / v3
+v3 -: v3 + ((v2 + v2) * 95 + 110)
+v2 : v3
+shw "s8".v1.((v3 - v3) / v2 + '9' * 93 - v0).v0."s0"
+shw v2.v4.v3.v4
+v2 : v3 + v1
+shw v1."s0".41.v1
+shw v2.v0.v1.((((v3 / v1) * (v1 / v3)) + (v2 - v3) / v3 / v0)).v1
+v1 : (('y' + v1 / ('x' * 'c')) + (v3 - 4) + v0 - v3)
+v2 /: v1 * -14 - (v4 + '0') / v1
+v3 : '9'
+v0 +: v0 * (6 - v1) * v4
+shw v2."s3".v4.v2
@@ -0,0 +1,11 @@
+flex v0 : (10 / 86 / 'a' + 'a' + ('x' + -10) + 51 - 42)
+nmbr v1 : ('Z' + -17 * v0 * ((v0 * 'a') / (v0 - v0)))
+nmbr v2 : v1
+flex v3 : (v1 * v2 + 'b' + v2 + v2 - 28 - 98)
+flex v4 : (v0 + -19 * -17 * 6)
+shw (42).v3."s4"."s5".('x')
+shw "s7"
+v4 : (v2 * v0 * v3 + -15)
+v0 : -10
+shw v2
+v4 /: v2 / 'c' * 112 * v2
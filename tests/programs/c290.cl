@@ -0,0 +1,12 @@
+chr v0
+flex v1 : 9
+nmbr v2 : ('y' / v1)
+flex v3 : v1 / v2
+nmbr v4 : (v0 - v2 * 64 + 'z' - (v2 - 3))
+flex v5
+flex v6 : 43
+v3 /: 'Z' / ('a' - 41 / (93 - v1))
+v3 : v2
+v6 /: v0
+shw v4.v4
+shw "s5"
@@ -0,0 +1,13 @@
+flex v0 : ((32 / '9') + (63 - 95) - 'y')
+flex v1 : (115 + v0 * 'x' + -8 + (v0 / 72 - '0'))
+flex v2 : (-6 * v1) + -2 / '0' / v0
+chr v3 : v2
+flex v4 : v3
+flex v5 : v0 + v2
+v1 : 35 + (-15 + v5) - 'c'
+v5 : -5 * v3 * (40 + 'z') * v5
+v5 : v2 * 43 / 83 - v2
+v0 : (v2 - ((v4 - v4) * 'z'))
+shw v1.v1.v2.v5.v4
+v2 : v5 / 'y' + v1
+shw v0.v1
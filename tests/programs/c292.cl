@@ -0,0 +1,16 @@
+chr v0 : 87 * (117 + 'c') - 'c' - 40
+chr v1 : -16 + 'b' + v0 - v0 * (89 + 'y') / v0
+flex v2 : (v1 / v0 / v0) - v1 / 30 * v0
+nmbr v3 : 110
+v2 -: 65
+v2 : 'y'
+shw v0
+shw "s0".v2
+shw v3."s9"
+shw v2."s3".v2.v3.v2
+v2 : ((('y' - v0) / v2 - v3) / v0 + (v3 * v2))
+shw v2.v3.v2.v2
+v0 : -19
+v2 : 20
+v3 +: (('9' + '0' * 52) * (18 / v1 + 'y'))
+v2 : 'Z' + 40 - 'b' + v1 - v3
@@ -0,0 +1,15 @@
+chr v0 : (32 / 'Z')
+nmbr v1 : v0 + 34
+chr v2 : 'b' - v0 / v1 - v0
+flex v3 : 76 / (v2 - v0 - 'Z' * v1)
+nmbr v4 : v2
+flex v5
+v2 *: v1 / ('a' - v5) - ('9' - v5)
+v4 : v1
+shw v1
+shw v5.v5.v5
+v4 -: (v0 + v0 / v3 + v2)
+v4 : v3 - v3 - v0
+v2 : 'c'
+v1 : (v5 + v2 / 7 * ((v0 / v1) + ('0' - 'x')))
+shw (((v3 * 'c') / '0' / 74 * (('b' + 'y') - v3 - v5)))
@@ -0,0 +1,8 @@
+nmbr v0 : 91
+flex v1 : (70 / v0) / v0 - v0 / (46 - v0)
+nmbr v2 : 98
+chr v3 : 76
+v0 : ((120 - v1 + 48) - v1 * 19)
+shw "s3"."s1".v2.v3."s7"
+v0 : v3 / (v3 * v3) * 43 - 95 / '0' + 83
+v0 +: 44
@@ -0,0 +1,15 @@
+flex v0 : 'x' / 57 + 37
+flex v1 : 62
+chr v2 : 'b'
+nmbr v3 : v0 / v2 - (v1 - v1)
+nmbr v4 : v1
+shw "s0"."s8"."s9"."s9"
+shw v1.v3.v4
+shw "s8".v0
+v4 : (109 / (41 * 49)) - 'x'
+v4 /: (v1 + v4)
+shw (v0).v0.v2.v1
+shw v2
+v2 : (v2 * v2 + v1) / 'y'
+v3 : v0
+v1 : '0' * v1 - 30 - 55 - (v2 * 104 * 'a' / v4)
@@ -0,0 +1,10 @@
+chr v0 : (23 * 39 + 75) / 92 - 'z' - 116 - 95
+flex v1 : (v0 * 'a') * v0
+chr v2 : ((v1 + v1) / 'y') + 38
+v2 : v2 + 86 / v1 * ((v1 * v1) * '9' + 'Z')
+v0 /: v2
+v0 : v1
+shw ((v2 + v0 / v1) * -14 + v0 - 117).v0
+shw v0.(v0 / 106 - 'y' + (47 / (v2 + 'x')))."s0"
+v1 /: v2 / v2 * 34 * ('c' + v2)
+shw "s3".v2.93."s1"
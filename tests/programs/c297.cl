@@ -0,0 +1,14 @@
+chr v0 : (95 + 81 / 54 + 33 * 106 - -15)
+nmbr v1 : 53 / 21 * (28 + v0) / 'A' / v0 - v0
+flex v2 : 'z'
+nmbr v3 : v0
+flex v4 : v0 - v3 + ('9' + v2) * v1
+flex v5
+flex v6
+shw v0."s4".v4."s9"
+v5 : (59 / 'Z' / v1 - (v3 * 119 + '0'))
+shw v2
+v6 : v3
+v6 /: v4 * v5 - 'x' / v2 + v0 / v3 * -11
+shw "s0".v5."s1".v1.(v5)
+shw v6.v0
@@ -0,0 +1,7 @@
+flex v0 : 97
+chr v1
+chr v2 : 14 + v1
+flex v3 : v2
+v1 : 34
+v1 : (48 - v2 * v1 - v1 * (93 * v0))
+shw v3.(38 - (v3 - 21) / ((41 + v2) / 'b' + 53)).v3
@@ -0,0 +1,10 @@
+flex v0 : '9'
+chr v1
+flex v2 : v1 / 'x' * 'A' + ((14 + 23) * 106 * v0)
+nmbr v3 : 110
+flex v4 : -19 + (-18 / 'c' / 'a')
+v4 *: 'x'
+shw v4.v2."s4"
+v1 : 'z'
+shw v1.((('9' * v0 / 9 + 'A') + v1))."s9".18."s0"
+v1 : 'Z'
@@ -0,0 +1,4 @@
+nmbr a : 5
+nmbr b : 0
+b : a
+shw b
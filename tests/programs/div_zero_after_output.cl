@@ -0,0 +1,3 @@
+shw "before"
+nmbr z : 0
+nmbr q : 5 / z
@@ -0,0 +1,8 @@
+chr c : 'A'
+flex f : c
+flex g : 'B' + 1
+f +: c
+g : c * 2
+shw f
+shw g
+shw c
@@ -0,0 +1,9 @@
+nmbr a : 12
+chr b : 'A'
+flex c : 33
+flex d : 'A'
+nmbr x : 10, y : 3
+x +: a * 2
+y : x / y - 1
+shw "hello! I'm ".x." years old!"
+shw b.c.d.' '.y
@@ -0,0 +1,12 @@
+nmbr a : 5, b : 7, c
+chr z : 'z'
+flex f
+c : a * b + a * b - b / a
+f : c - 100
+z -: 1
+shw "c=".c." f=".f." z=".z
+shw 'q'.(a+b)*2."-".-a
+nmbr big : 30000
+big *: 3
+big +: big / 7
+shw big
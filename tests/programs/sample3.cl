@@ -0,0 +1,11 @@
+nmbr x : 1
+nmbr y : x + 1, z : y * 3
+chr c : 'A'
+c +: 2
+nmbr n : c
+flex q : c
+shw x.y.z.c.n.q
+x : x + y + z + n
+y : x * x - z * 2 + (x - y) * (z - n)
+z : y / 3 + x / 2
+shw "x=".x.", y=".y.", z=".z
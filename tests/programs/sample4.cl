@@ -0,0 +1,4 @@
+nmbr a : 10, b : 0
+shw "before"
+a : a / b
+shw "after"
@@ -0,0 +1,8 @@
+nmbr a : 3, b : 4
+nmbr c : a
+nmbr d : c + b
+d *: d
+a : d - c
+b : a
+c : b + b
+shw a.",".b.",".c.",".d
@@ -0,0 +1,14 @@
+flex f : 'a'
+flex g : 65
+chr c : 'b'
+nmbr n : 'c'
+c : c + 1
+f : c
+g : f + c
+shw f."|".g."|".c."|".n."|".'x'.'y'.(c+1)
+chr d : c * 2
+flex h : d - 1
+shw d.h
+n : c / 2 - f
+f +: 1
+shw n.f
@@ -0,0 +1,5 @@
+nmbr x : 4
+chr c : 'q'
+shw "a".5." b ".'k'." ".x." ".c
+shw 7
+shw "z".(2+3)
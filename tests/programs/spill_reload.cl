@@ -0,0 +1,7 @@
+nmbr a : 3
+nmbr b : 7
+flex y : 2
+nmbr x : (a*b) + ((a*b) + ((a*b) + ((a*b) + ((a*b) + ((a*b) + ((a*b) + ((a*b) + ((a*b) + ((a*b) + ((a*b) + ((a*b))))))))))))
+chr c : 5
+c : (c*y - b) + ((c*y - b) + ((c*y - b) + ((c*y - b) + ((c*y - b) + ((c*y - b) + ((c*y - b) + ((c*y - b) + ((c*y - b) + ((c*y - b) + ((c*y - b) + ((c*y - b))))))))))))
+shw x . " " . c
@@ -0,0 +1,2 @@
+shw "a\tb\\c\"d\ne"
+shw "plain"
@@ -0,0 +1,5 @@
+nmbr c : 3
+nmbr a : 2000000000
+a +: a
+a : a / c
+shw a
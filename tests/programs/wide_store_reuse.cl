@@ -0,0 +1,5 @@
+nmbr a : 2000000000
+a +: a
+nmbr b : a / 3
+shw a
+shw b
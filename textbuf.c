@@ -0,0 +1,57 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include "textbuf.h"
+
+void textbuf_init(TextBuf *b) {
+    memset(b, 0, sizeof(*b));
+}
+
+void textbuf_clear(TextBuf *b) {
+    b->len = 0;
+    if (b->data) b->data[0] = '\0';
+}
+
+void textbuf_free(TextBuf *b) {
+    free(b->data);
+    textbuf_init(b);
+}
+
+/* Room for n more bytes plus the terminating NUL */
+static void reserve(TextBuf *b, size_t n) {
+    if (b->len + n + 1 <= b->cap) return;
+    size_t newCap = b->cap ? b->cap : 256;
+    while (newCap < b->len + n + 1) newCap *= 2;
+    b->data = realloc(b->data, newCap);
+    if (!b->data) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    b->cap = newCap;
+}
+
+void textbuf_append(TextBuf *b, const char *s, size_t n) {
+    reserve(b, n);
+    memcpy(b->data + b->len, s, n);
+    b->len += n;
+    b->data[b->len] = '\0';
+}
+
+void textbuf_puts(TextBuf *b, const char *s) {
+    textbuf_append(b, s, strlen(s));
+}
+
+void textbuf_printf(TextBuf *b, const char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(NULL, 0, fmt, ap);
+    va_end(ap);
+    if (n < 0) return;
+
+    reserve(b, (size_t)n);
+    va_start(ap, fmt);
+    vsnprintf(b->data + b->len, (size_t)n + 1, fmt, ap);
+    va_end(ap);
+    b->len += (size_t)n;
+}
@@ -0,0 +1,22 @@
+#ifndef TEXTBUF_H
+#define TEXTBUF_H
+
+#include <stddef.h>
+
+/* Growable text. data is NUL-terminated once anything has been appended;
+   clearing keeps the memory so a buffer can be reused run after run. */
+typedef struct {
+    char *data;
+    size_t len;
+    size_t cap;
+} TextBuf;
+
+void textbuf_init(TextBuf *b);
+void textbuf_clear(TextBuf *b);
+void textbuf_free(TextBuf *b);
+
+void textbuf_append(TextBuf *b, const char *s, size_t n);
+void textbuf_puts(TextBuf *b, const char *s);
+void textbuf_printf(TextBuf *b, const char *fmt, ...);
+
+#endif
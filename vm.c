@@ -0,0 +1,350 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "vm.h"
+#include "symbol_table.h"
+#include "output.h"
+
+#define VM_LENGTH(name, len) len,
+const int vm_op_length[VM_OP_COUNT] = { VM_OPS(VM_LENGTH) };
+
+/* Resolved source operand */
+typedef struct {
+    int isImm;
+    int value;      // slot index or immediate
+} VMOperand;
+
+static void vm_emit(VMProgram *vm, VMWord w) {
+    if (vm->count >= vm->capacity) {
+        int newCap = vm->capacity == 0 ? 256 : vm->capacity * 2;
+        vm->code = realloc(vm->code, newCap * sizeof(VMWord));
+        if (!vm->code) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        vm->capacity = newCap;
+    }
+    vm->code[vm->count++] = w;
+}
+
+static void vm_emit_int(VMProgram *vm, int i) {
+    VMWord w;
+    w.i = i;
+    vm_emit(vm, w);
+}
+
+static void vm_emit_str(VMProgram *vm, const char *str) {
+    VMWord w;
+    w.str = str;
+    vm_emit(vm, w);
+}
+
+static int scratch_slot(VMProgram *vm) {
+    return vm->slotCount - 1;
+}
+
+static VMOperand resolve_source(VMProgram *vm, TACOperand op) {
+    VMOperand r = {1, 0};
+    switch (op.type) {
+        case OPERAND_TEMP:
+            r.isImm = 0;
+            r.value = vm->varCount + op.val.tempNum;
+            break;
+        case OPERAND_VAR: {
+            Symbol *s = lookup_atom(vm->symbols, op.val.varName);
+            if (s) {
+                r.isImm = 0;
+                r.value = (int)(s - vm->symbols->entries);
+            }
+            break;
+        }
+        case OPERAND_INT:
+            r.value = op.val.intVal;
+            break;
+        default:
+            break;
+    }
+    return r;
+}
+
+/* Destination slot plus the fixup op its store semantics need (-1 for none).
+   charStore mirrors set_operand_value's isCharType path, which is a no-op
+   for nmbr variables. */
+static int resolve_dest(VMProgram *vm, TACOperand op, int charStore, int *fixup) {
+    *fixup = -1;
+    if (op.type == OPERAND_TEMP) {
+        return vm->varCount + op.val.tempNum;
+    }
+    if (op.type != OPERAND_VAR) {
+        return scratch_slot(vm);
+    }
+
+    Symbol *s = lookup_atom(vm->symbols, op.val.varName);
+    if (!s) return scratch_slot(vm);
+
+    int slot = (int)(s - vm->symbols->entries);
+    switch (s->type) {
+        case TYPE_CHR:
+            *fixup = VM_TRUNC;
+            break;
+        case TYPE_FLEX:
+            *fixup = charStore ? VM_TAG_CHR : VM_TAG_NUM;
+            break;
+        default:
+            if (charStore) return scratch_slot(vm);
+            break;
+    }
+    vm->stored[slot] = 1;
+    return slot;
+}
+
+static void emit_fixup(VMProgram *vm, int fixup, int slot) {
+    if (fixup < 0) return;
+    vm_emit_int(vm, fixup);
+    vm_emit_int(vm, slot);
+}
+
+static void compile_move(VMProgram *vm, TACInstr *instr) {
+    int fixup;
+    VMOperand src = resolve_source(vm, instr->arg1);
+    int d = resolve_dest(vm, instr->result, 0, &fixup);
+
+    vm_emit_int(vm, src.isImm ? VM_LOADI : VM_MOV);
+    vm_emit_int(vm, d);
+    vm_emit_int(vm, src.value);
+    emit_fixup(vm, fixup, d);
+}
+
+static void compile_arith(VMProgram *vm, TACInstr *instr) {
+    int base;
+    switch (instr->op) {
+        case TAC_ADD: base = VM_ADD_SS; break;
+        case TAC_SUB: base = VM_SUB_SS; break;
+        case TAC_MUL: base = VM_MUL_SS; break;
+        default:      base = VM_DIV_SS; break;
+    }
+
+    VMOperand a = resolve_source(vm, instr->arg1);
+    VMOperand b = resolve_source(vm, instr->arg2);
+
+    /* Two immediates that survived folding: materialize the left one */
+    if (a.isImm && b.isImm) {
+        vm_emit_int(vm, VM_LOADI);
+        vm_emit_int(vm, scratch_slot(vm));
+        vm_emit_int(vm, a.value);
+        a.isImm = 0;
+        a.value = scratch_slot(vm);
+    }
+
+    int fixup;
+    int d = resolve_dest(vm, instr->result, instr->result.isCharType, &fixup);
+
+    vm_emit_int(vm, base + (b.isImm ? 1 : a.isImm ? 2 : 0));
+    vm_emit_int(vm, d);
+    vm_emit_int(vm, a.value);
+    vm_emit_int(vm, b.value);
+    if (instr->op == TAC_DIV) vm_emit_int(vm, instr->line);
+    emit_fixup(vm, fixup, d);
+}
+
+/* Same decision tac_execute makes for TAC_CONCAT, taken once */
+static void compile_print(VMProgram *vm, TACInstr *instr, unsigned char *tempIsChar) {
+    TACOperand op = instr->arg1;
+    switch (op.type) {
+        case OPERAND_INT:
+            vm_emit_int(vm, op.isCharType ? VM_PRINT_CHR_I : VM_PRINT_NUM_I);
+            vm_emit_int(vm, op.val.intVal);
+            break;
+        case OPERAND_STR:
+            vm_emit_int(vm, VM_PRINT_STR);
+            vm_emit_str(vm, op.val.strVal);
+            break;
+        case OPERAND_TEMP:
+            vm_emit_int(vm, tempIsChar[op.val.tempNum] ? VM_PRINT_CHR : VM_PRINT_NUM);
+            vm_emit_int(vm, vm->varCount + op.val.tempNum);
+            break;
+        case OPERAND_VAR: {
+            Symbol *s = lookup_atom(vm->symbols, op.val.varName);
+            if (!s) break;
+            // Flex tags are proven by tac_generate, so no run-time check
+            int kind = s->type == TYPE_CHR || op.flexType == FLEX_CHAR ? VM_PRINT_CHR : VM_PRINT_NUM;
+            vm_emit_int(vm, kind);
+            vm_emit_int(vm, (int)(s - vm->symbols->entries));
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+VMProgram *vm_compile(TACProgram *prog) {
+    VMProgram *vm = calloc(1, sizeof(VMProgram));
+    if (!vm) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    vm->symbols = prog->symbols;
+    vm->varCount = vm->symbols->count;
+    vm->slotCount = vm->varCount + prog->tempCount + 1;
+    vm->stored = calloc(vm->varCount > 0 ? vm->varCount : 1, 1);
+
+    /* A temp prints as char when the first instruction producing it says so */
+    unsigned char *tempIsChar = calloc(prog->tempCount > 0 ? prog->tempCount : 1, 1);
+    unsigned char *tempSeen = calloc(prog->tempCount > 0 ? prog->tempCount : 1, 1);
+    if (!vm->stored || !tempIsChar || !tempSeen) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (TACInstr *instr = prog->head; instr; instr = instr->next) {
+        if (instr->result.type != OPERAND_TEMP) continue;
+        int t = instr->result.val.tempNum;
+        if (!tempSeen[t]) {
+            tempSeen[t] = 1;
+            tempIsChar[t] = (unsigned char)instr->resultIsChar;
+        }
+    }
+
+    for (TACInstr *instr = prog->head; instr; instr = instr->next) {
+        switch (instr->op) {
+            case TAC_LOAD_INT:
+            case TAC_COPY:
+                compile_move(vm, instr);
+                break;
+            case TAC_ADD:
+            case TAC_SUB:
+            case TAC_MUL:
+            case TAC_DIV:
+                compile_arith(vm, instr);
+                break;
+            case TAC_CONCAT:
+                compile_print(vm, instr, tempIsChar);
+                break;
+            case TAC_PRINT:
+                if (instr->arg1.type == OPERAND_STR) {
+                    vm_emit_int(vm, VM_PRINT_STR);
+                    vm_emit_str(vm, instr->arg1.val.strVal);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    vm_emit_int(vm, VM_HALT);
+
+    free(tempIsChar);
+    free(tempSeen);
+    return vm;
+}
+
+/* Frame values follow get_operand_value */
+void vm_load_frame(const VMProgram *vm, int *slots, unsigned char *tags) {
+    for (int i = 0; i < vm->varCount; i++) {
+        Symbol *s = &vm->symbols->entries[i];
+        slots[i] = VALUE_NUM(s->value);
+        tags[i] = (unsigned char)(get_runtime_type(s) == FLEX_CHAR);
+    }
+}
+
+void vm_write_back(const VMProgram *vm, const int *slots, const unsigned char *tags) {
+    for (int i = 0; i < vm->varCount; i++) {
+        if (!vm->stored[i]) continue;
+        Symbol *s = &vm->symbols->entries[i];
+        if (s->type == TYPE_CHR || (s->type == TYPE_FLEX && tags[i])) {
+            set_char(s, (char)slots[i]);
+        } else {
+            set_number(s, slots[i]);
+        }
+    }
+}
+
+#if VM_COMPUTED_GOTO
+#define VM_CASE(name)   L_##name:
+#define VM_NEXT(n)      do { pc += (n); goto *pc->label; } while (0)
+#else
+#define VM_CASE(name)   case VM_##name:
+#define VM_NEXT(n)      do { pc += (n); goto dispatch; } while (0)
+#endif
+
+#define VM_ARITH(name, expr, len)                                              \
+    VM_CASE(name##_SS) { int a = s[pc[2].i], b = s[pc[3].i]; expr; } VM_NEXT(len); \
+    VM_CASE(name##_SI) { int a = s[pc[2].i], b = pc[3].i; expr; } VM_NEXT(len);    \
+    VM_CASE(name##_IS) { int a = pc[2].i, b = s[pc[3].i]; expr; } VM_NEXT(len);
+
+#define VM_DIV_BODY                                                            \
+    if (b == 0) {                                                              \
+        output_flush();                                                        \
+        fprintf(stderr, "Runtime error at line %d: Division by zero\n", pc[4].i); \
+        status = 1;                                                            \
+        goto done;                                                             \
+    }                                                                          \
+    s[pc[1].i] = a / b
+
+int vm_execute(VMProgram *vm) {
+    if (!vm) return 1;
+
+#if VM_COMPUTED_GOTO
+#define VM_LABEL(name, len) &&L_##name,
+    static const void *labels[VM_OP_COUNT] = { VM_OPS(VM_LABEL) };
+    if (!vm->threaded) {
+        for (int i = 0; i < vm->count; ) {
+            int op = vm->code[i].i;
+            vm->code[i].label = labels[op];
+            i += vm_op_length[op];
+        }
+        vm->threaded = 1;
+    }
+#endif
+
+    int *s = calloc(vm->slotCount, sizeof(int));
+    unsigned char *tags = calloc(vm->varCount > 0 ? vm->varCount : 1, 1);
+    if (!s || !tags) {
+        fprintf(stderr, "Failed to allocate temp storage\n");
+        free(s);
+        free(tags);
+        return 1;
+    }
+    vm_load_frame(vm, s, tags);
+
+    int status = 0;
+    const VMWord *pc = vm->code;
+
+#if VM_COMPUTED_GOTO
+    goto *pc->label;
+#else
+dispatch:
+    switch (pc->i) {
+#endif
+    VM_CASE(HALT) goto done;
+    VM_CASE(LOADI) s[pc[1].i] = pc[2].i; VM_NEXT(3);
+    VM_CASE(MOV) s[pc[1].i] = s[pc[2].i]; VM_NEXT(3);
+    VM_ARITH(ADD, s[pc[1].i] = a + b, 4)
+    VM_ARITH(SUB, s[pc[1].i] = a - b, 4)
+    VM_ARITH(MUL, s[pc[1].i] = a * b, 4)
+    VM_ARITH(DIV, VM_DIV_BODY, 5)
+    VM_CASE(TRUNC) s[pc[1].i] = (char)s[pc[1].i]; VM_NEXT(2);
+    VM_CASE(TAG_NUM) tags[pc[1].i] = 0; VM_NEXT(2);
+    VM_CASE(TAG_CHR) s[pc[1].i] = (char)s[pc[1].i]; tags[pc[1].i] = 1; VM_NEXT(2);
+    VM_CASE(PRINT_NUM) output_num(s[pc[1].i]); VM_NEXT(2);
+    VM_CASE(PRINT_CHR) output_chr(s[pc[1].i]); VM_NEXT(2);
+    VM_CASE(PRINT_NUM_I) output_num(pc[1].i); VM_NEXT(2);
+    VM_CASE(PRINT_CHR_I) output_chr(pc[1].i); VM_NEXT(2);
+    VM_CASE(PRINT_STR) output_str(pc[1].str); VM_NEXT(2);
+#if !VM_COMPUTED_GOTO
+    default:
+        goto done;
+    }
+#endif
+
+done:
+    output_flush();
+    vm_write_back(vm, s, tags);
+    free(s);
+    free(tags);
+    return status;
+}
+
+void vm_free(VMProgram *vm) {
+    if (!vm) return;
+    free(vm->code);
+    free(vm->stored);
+    free(vm);
+}
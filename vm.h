@@ -0,0 +1,71 @@
+#ifndef VM_H
+#define VM_H
+
+#include "tac.h"
+
+/* Compact bytecode for tac_execute's semantics. Operands are resolved at
+   compile time: variables and temps become frame slots, constants become
+   immediates, and every opcode is specialized by operand kind. */
+
+/* Use computed-goto (threaded) dispatch where the compiler supports it */
+#ifndef VM_COMPUTED_GOTO
+#if defined(__GNUC__) || defined(__clang__)
+#define VM_COMPUTED_GOTO 1
+#else
+#define VM_COMPUTED_GOTO 0
+#endif
+#endif
+
+/* Opcode, instruction length in words.
+   Naming: S = frame slot operand, I = immediate operand. */
+#define VM_OPS(X)                                                          \
+    X(HALT, 1)                                                             \
+    X(LOADI, 3)       /* d imm */                                          \
+    X(MOV, 3)         /* d s */                                            \
+    X(ADD_SS, 4) X(ADD_SI, 4) X(ADD_IS, 4)                                 \
+    X(SUB_SS, 4) X(SUB_SI, 4) X(SUB_IS, 4)                                 \
+    X(MUL_SS, 4) X(MUL_SI, 4) X(MUL_IS, 4)                                 \
+    X(DIV_SS, 5) X(DIV_SI, 5) X(DIV_IS, 5)   /* d a b line */              \
+    X(TRUNC, 2)       /* chr store: keep the low byte */                   \
+    X(TAG_NUM, 2)     /* flex store of a number */                         \
+    X(TAG_CHR, 2)     /* flex store of a char */                           \
+    X(PRINT_NUM, 2) X(PRINT_CHR, 2)                                        \
+    X(PRINT_NUM_I, 2) X(PRINT_CHR_I, 2)                                    \
+    X(PRINT_STR, 2)
+
+#define VM_ENUM(name, len) VM_##name,
+typedef enum { VM_OPS(VM_ENUM) VM_OP_COUNT } VMOp;
+
+extern const int vm_op_length[VM_OP_COUNT];
+
+typedef union {
+    int i;              // opcode, slot index or immediate
+    const char *str;    // string literal to print
+    const void *label;  // threaded dispatch target
+} VMWord;
+
+typedef struct {
+    VMWord *code;
+    int count;
+    int capacity;
+    SymbolTable *symbols;   // the compiled program's variables
+    int varCount;       // slots [0, varCount) mirror symbols
+    int slotCount;      // vars, temps, then one scratch slot
+    unsigned char *stored;  // vars written by the program, copied back to symbols
+    int threaded;       // opcodes already replaced by labels
+} VMProgram;
+
+VMProgram *vm_compile(TACProgram *prog);
+
+/* Run the program; variables are loaded from and written back to the
+   symbol table. Returns 0 on success, 1 on a runtime error. */
+int vm_execute(VMProgram *vm);
+
+/* Frame slots for variables, as tac_execute would read them, and the copy
+   back of every variable the program stores to */
+void vm_load_frame(const VMProgram *vm, int *slots, unsigned char *tags);
+void vm_write_back(const VMProgram *vm, const int *slots, const unsigned char *tags);
+
+void vm_free(VMProgram *vm);
+
+#endif
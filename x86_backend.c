@@ -0,0 +1,241 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "x86_backend.h"
+#include "target.h"
+#include "native.h"
+#include "symbol_table.h"
+
+#define X86_BENCH_RUNS 5
+
+/* Callee-saved, so calls into the C library keep allocated values */
+static const char *reg64[] = {"%rbx", "%r12", "%r13", "%r14", "%r15"};
+static const char *reg32[] = {"%ebx", "%r12d", "%r13d", "%r14d", "%r15d"};
+static const char *reg8[]  = {"%bl", "%r12b", "%r13b", "%r14b", "%r15b"};
+
+typedef struct {
+    FILE *out;
+    const char **strings;   // literals printed by shw, emitted into .rodata
+    int stringCount;
+    int stringCap;
+} X86Context;
+
+static void x86_load_var(void *ctx, int reg, Symbol *s) {
+    X86Context *x = ctx;
+    if (s->type == TYPE_CHR) {
+        fprintf(x->out, "    movsbl v_%s(%%rip), %s\n", s->name, reg32[reg]);
+    } else {
+        fprintf(x->out, "    movl v_%s(%%rip), %s\n", s->name, reg32[reg]);
+    }
+}
+
+/* Mirrors tac_execute's setters: chr keeps the low byte, a char store into
+   nmbr is dropped and a char store into flex keeps it sign-extended */
+static int x86_store_var(void *ctx, int reg, Symbol *s, int charStore) {
+    X86Context *x = ctx;
+    switch (s->type) {
+        case TYPE_CHR:
+            fprintf(x->out, "    movb %s, v_%s(%%rip)\n", reg8[reg], s->name);
+            return 0;
+        case TYPE_FLEX:
+            if (charStore) {
+                fprintf(x->out, "    movsbl %s, %%eax\n", reg8[reg]);
+                fprintf(x->out, "    movl %%eax, v_%s(%%rip)\n", s->name);
+                return 0;
+            }
+            fprintf(x->out, "    movl %s, v_%s(%%rip)\n", reg32[reg], s->name);
+            return 1;
+        default:
+            if (charStore) return 0;
+            fprintf(x->out, "    movl %s, v_%s(%%rip)\n", reg32[reg], s->name);
+            return 1;
+    }
+}
+
+static void x86_load_imm(void *ctx, int reg, int imm) {
+    X86Context *x = ctx;
+    fprintf(x->out, "    movl $%d, %s\n", imm, reg32[reg]);
+}
+
+static void x86_move(void *ctx, int dst, int src) {
+    X86Context *x = ctx;
+    fprintf(x->out, "    movl %s, %s\n", reg32[src], reg32[dst]);
+}
+
+static void x86_arith(void *ctx, TACOp op, int dst, int left, int right, int line) {
+    X86Context *x = ctx;
+    if (op == TAC_DIV) {
+        fprintf(x->out, "    testl %s, %s\n", reg32[right], reg32[right]);
+        fprintf(x->out, "    jnz 1f\n");
+        fprintf(x->out, "    movl $%d, %%edi\n", line);
+        fprintf(x->out, "    call colang_div_error\n");
+        fprintf(x->out, "1:\n");
+        fprintf(x->out, "    movl %s, %%eax\n", reg32[left]);
+        fprintf(x->out, "    cltd\n");
+        fprintf(x->out, "    idivl %s\n", reg32[right]);
+    } else {
+        const char *mnemonic = op == TAC_ADD ? "addl" : op == TAC_SUB ? "subl" : "imull";
+        fprintf(x->out, "    movl %s, %%eax\n", reg32[left]);
+        fprintf(x->out, "    %s %s, %%eax\n", mnemonic, reg32[right]);
+    }
+    fprintf(x->out, "    movl %%eax, %s\n", reg32[dst]);
+}
+
+static void x86_spill(void *ctx, int reg, int tempNum) {
+    X86Context *x = ctx;
+    fprintf(x->out, "    movq %s, colang_temps+%d(%%rip)\n", reg64[reg], tempNum * 8);
+}
+
+static void x86_reload(void *ctx, int reg, int tempNum) {
+    X86Context *x = ctx;
+    fprintf(x->out, "    movl colang_temps+%d(%%rip), %s\n", tempNum * 8, reg32[reg]);
+}
+
+static void x86_print_reg(void *ctx, int reg, PrintKind kind) {
+    X86Context *x = ctx;
+    fprintf(x->out, "    movl %s, %%edi\n", reg32[reg]);
+    fprintf(x->out, "    call %s\n", kind == PRINT_AS_CHAR ? "colang_print_chr" : "colang_print_num");
+}
+
+static void x86_print_imm(void *ctx, int imm, int isChar) {
+    X86Context *x = ctx;
+    fprintf(x->out, "    movl $%d, %%edi\n", imm);
+    fprintf(x->out, "    call %s\n", isChar ? "colang_print_chr" : "colang_print_num");
+}
+
+static void x86_print_str(void *ctx, const char *str) {
+    X86Context *x = ctx;
+    if (x->stringCount >= x->stringCap) {
+        x->stringCap = x->stringCap ? x->stringCap * 2 : 16;
+        x->strings = realloc(x->strings, x->stringCap * sizeof(const char *));
+        if (!x->strings) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+    }
+    fprintf(x->out, "    leaq .LS%d(%%rip), %%rdi\n", x->stringCount);
+    fprintf(x->out, "    call colang_print_str\n");
+    x->strings[x->stringCount++] = str;
+}
+
+static const TargetDesc x86_target = {
+    "x86-64", 5,
+    x86_load_var, x86_store_var, x86_load_imm, x86_move, x86_arith, x86_spill, x86_reload,
+    x86_print_reg, x86_print_imm, x86_print_str,
+};
+
+/* Runtime routines appended to every program */
+static const char *x86_runtime =
+    "colang_print_num:\n"
+    "    subq $8, %rsp\n"
+    "    movl %edi, %esi\n"
+    "    leaq .Lfmt_num(%rip), %rdi\n"
+    "    xorl %eax, %eax\n"
+    "    call printf@PLT\n"
+    "    addq $8, %rsp\n"
+    "    ret\n"
+    "\n"
+    "colang_print_chr:\n"
+    "    jmp putchar@PLT\n"
+    "\n"
+    "colang_print_str:\n"
+    "    movq stdout@GOTPCREL(%rip), %rsi\n"
+    "    movq (%rsi), %rsi\n"
+    "    jmp fputs@PLT\n"
+    "\n"
+    "colang_div_error:\n"
+    "    pushq %rbx\n"
+    "    movl %edi, %ebx\n"
+    "    movq stdout@GOTPCREL(%rip), %rdi\n"
+    "    movq (%rdi), %rdi\n"
+    "    call fflush@PLT\n"
+    "    movl %ebx, %edx\n"
+    "    movq stderr@GOTPCREL(%rip), %rdi\n"
+    "    movq (%rdi), %rdi\n"
+    "    leaq .Lfmt_div(%rip), %rsi\n"
+    "    xorl %eax, %eax\n"
+    "    call fprintf@PLT\n"
+    "    movl $1, %edi\n"
+    "    call exit@PLT\n";
+
+static void emit_asciz(FILE *out, const char *s) {
+    fprintf(out, "    .asciz \"");
+    for (const unsigned char *p = (const unsigned char *)s; *p; p++) {
+        if (*p == '"' || *p == '\\') {
+            fprintf(out, "\\%c", *p);
+        } else if (*p < 0x20 || *p >= 0x7F) {
+            fprintf(out, "\\%03o", *p);
+        } else {
+            fputc(*p, out);
+        }
+    }
+    fprintf(out, "\"\n");
+}
+
+void x86_emit(TACProgram *prog, FILE *out) {
+    X86Context x;
+    memset(&x, 0, sizeof(x));
+    x.out = out;
+
+    fprintf(out, "# Generated by the Colang x86-64 backend\n");
+    fprintf(out, "    .text\n    .globl main\n    .type main, @function\n");
+    fprintf(out, "main:\n");
+    fprintf(out, "    pushq %%rbx\n    pushq %%r12\n    pushq %%r13\n    pushq %%r14\n    pushq %%r15\n");
+
+    tac_lower(prog, &x86_target, &x);
+
+    fprintf(out, "    xorl %%eax, %%eax\n");
+    fprintf(out, "    popq %%r15\n    popq %%r14\n    popq %%r13\n    popq %%r12\n    popq %%rbx\n");
+    fprintf(out, "    ret\n    .size main, .-main\n\n");
+    fputs(x86_runtime, out);
+
+    fprintf(out, "\n    .section .rodata\n");
+    fprintf(out, ".Lfmt_num:\n    .asciz \"%%d\"\n");
+    fprintf(out, ".Lfmt_div:\n    .asciz \"Runtime error at line %%d: Division by zero\\n\"\n");
+    for (int i = 0; i < x.stringCount; i++) {
+        fprintf(out, ".LS%d:\n", i);
+        emit_asciz(out, x.strings[i]);
+    }
+
+    /* Every variable is a 32-bit slot; chr uses its low byte */
+    fprintf(out, "\n    .data\n");
+    for (int i = 0; i < prog->symbols->count; i++) {
+        Symbol *s = &prog->symbols->entries[i];
+        fprintf(out, "v_%s:\n    .long %d\n", s->name, s->hasInitValue ? s->initValue : 0);
+    }
+    fprintf(out, "\n    .local colang_temps\n    .comm colang_temps, %d, 8\n",
+            (prog->tempCount > 0 ? prog->tempCount : 1) * 8);
+    fprintf(out, "    .section .note.GNU-stack,\"\",@progbits\n");
+
+    free(x.strings);
+}
+
+int x86_backend_run(TACProgram *prog, const char *sPath, FILE *report) {
+    FILE *out = fopen(sPath, "w");
+    if (!out) {
+        fprintf(stderr, "Could not open '%s' for writing\n", sPath);
+        return 1;
+    }
+    x86_emit(prog, out);
+    fclose(out);
+
+    const char *cc = native_compiler();
+    if (!cc) {
+        fprintf(stderr, "No assembler/linker driver found; wrote '%s' without building it\n", sPath);
+        return 0;
+    }
+
+    char exePath[1024];
+    native_exe_path(sPath, exePath, sizeof(exePath));
+    if (native_build(cc, sPath, exePath) != 0) {
+        fprintf(stderr, "x86-64 backend: '%s' failed to assemble\n", sPath);
+        return 1;
+    }
+
+    NativeResult res;
+    int status = native_check(prog, exePath, X86_BENCH_RUNS, &res);
+    fprintf(report, "interpreter: %.3f ms\n", res.interpMs);
+    fprintf(report, "native: %.3f ms (including process start-up)\n", res.nativeMs);
+    fprintf(report, "output: %s\n", res.matches ? "matches tac_execute" : "differs from tac_execute");
+    return status;
+}
@@ -0,0 +1,17 @@
+#ifndef X86_BACKEND_H
+#define X86_BACKEND_H
+
+#include <stdio.h>
+#include "tac.h"
+
+/* GNU as x86-64 assembly (System V ABI, Linux) lowered through the shared
+   register allocator in tac.c. Variables live in .data, shw output goes
+   through the C library, so the result links with the system compiler. */
+void x86_emit(TACProgram *prog, FILE *out);
+
+/* Write the assembly to sPath and, when a compiler driver is available,
+   assemble and link it, check its output against tac_execute and print a
+   timing report to `report`. Returns 0 on success. */
+int x86_backend_run(TACProgram *prog, const char *sPath, FILE *report);
+
+#endif